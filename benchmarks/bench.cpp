@@ -0,0 +1,222 @@
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "reader.h"
+#include "compiler/lexer.h"
+#include "compiler/parser.h"
+#include "compiler/bytecode_compiler.h"
+#include "vm/virtual_machine.h"
+
+#ifdef _WIN32
+
+#include <windows.h>
+#include <psapi.h>
+
+#else
+
+#include <sys/resource.h>
+
+#endif
+
+/*
+ * Throughput of every stage of the interpreter over generated scripts
+ * - Usage: bench [lines...], the default sizes are 1000 and 100000 lines, pass 10000000 for the biggest runs
+ * - The scripts are generated the same way on every run, each stage is measured a few times and the best time is
+ *   kept
+ * - Workloads: script mixes functions, loops and conditions, nested is made of deeply nested expressions and
+ *   strings of long literals with escapes
+ * - Stages: lex counts tokens, parse counts AST nodes, compile counts instructions and execute counts allocated
+ *   values, every stage includes the stages before it
+ * - Prints one JSON object per line with the workload, size, stage, count, seconds, rate and peak RSS of the
+ *   process so far in KiB
+ */
+
+static std::string generate_script(size_t lines) {
+    std::string script = "total = 0\n";
+    // Every block is 14 lines long
+    for (size_t block = 0; block * 14 < lines; block++) {
+        std::string name = "accumulate_" + std::to_string(block);
+        script += "def " + name + "(values, start)\n"
+                  "    result = start\n"
+                  "    for index in range(0, 8, 1)\n"
+                  "        if index % 2 == 0 and values[0] != 1_000\n"
+                  "            result += index * 3 // 2\n"
+                  "        elif index < 0b101\n"
+                  "            result -= 0x1F\n"
+                  "        else\n"
+                  "            result = result + 2.5e+3 // 7\n"
+                  "        end\n"
+                  "    end\n"
+                  "    return result\n"
+                  "end\n"
+                  "total = total + " + name + "((1, 2, 3), " + std::to_string(block) + ")\n";
+    }
+    return script;
+}
+
+static std::string generate_nested(size_t lines) {
+    const size_t depth = 32;
+    std::string expression = "index";
+    for (size_t level = 0; level < depth; level++) {
+        expression = "(" + expression + (level % 2 == 0 ? " + " : " * ") + std::to_string(level) + ")";
+    }
+    std::string script;
+    for (size_t line = 0; line < lines; line += 2) {
+        script += "index = " + std::to_string(line) + "\n";
+        script += "value = " + expression + "\n";
+    }
+    return script;
+}
+
+static std::string generate_strings(size_t lines) {
+    std::string literal = "\"";
+    while (literal.size() < 240) {
+        literal += "{\\\"key\\\": \\\"value\\\", \\\"euro\\\": \\\"\\u20ac\\\"}\\n";
+    }
+    literal += "\"";
+    std::string script;
+    for (size_t line = 0; line < lines; line++) {
+        script += "text = " + literal + "\n";
+    }
+    return script;
+}
+
+static size_t peak_rss_kib() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return (size_t) usage.ru_maxrss / 1024;
+#else
+    return (size_t) usage.ru_maxrss;
+#endif
+#endif
+}
+
+// Runs the stage the given number of times, the count is the one of the fastest run, 0 when the stage failed
+static void measure(const std::string &workload, size_t lines, const std::string &stage, const std::string &unit,
+                    size_t repetitions, const std::function<size_t()> &run) {
+    double best = 0;
+    size_t count = 0;
+    for (size_t repetition = 0; repetition < repetitions; repetition++) {
+        auto start = std::chrono::steady_clock::now();
+        count = run();
+        auto end = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        if (repetition == 0 || seconds < best) {
+            best = seconds;
+        }
+        if (count == 0) {
+            break;
+        }
+    }
+    std::cout << "{\"workload\": \"" << workload << "\", \"lines\": " << lines
+              << ", \"stage\": \"" << stage << "\", \"unit\": \"" << unit << "\", \"count\": " << count
+              << ", \"seconds\": " << best << ", \"per_second\": " << (best > 0 ? (double) count / best : 0)
+              << ", \"peak_rss_kib\": " << peak_rss_kib() << "}" << std::endl;
+}
+
+static size_t lex(plasma::reader::string_reader *reader) {
+    plasma::lexer::lexer lexer(reader);
+    plasma::lexer::token token;
+    plasma::error::error error;
+    size_t tokens = 0;
+    while (lexer.hasNext()) {
+        if (!lexer.next(&token, &error)) {
+            std::cerr << error.string() << std::endl;
+            return 0;
+        }
+        tokens++;
+    }
+    return tokens;
+}
+
+static size_t parse(plasma::reader::string_reader *reader) {
+    plasma::lexer::lexer lexer(reader);
+    plasma::parser::parser parser(&lexer);
+    parser.parse();
+    if (!parser.Errors.empty()) {
+        std::cerr << parser.Errors.front().string() << std::endl;
+        return 0;
+    }
+    return parser.Arena.object_count();
+}
+
+static bool compile(plasma::reader::string_reader *reader, plasma::vm::bytecode *code) {
+    plasma::lexer::lexer lexer(reader);
+    plasma::parser::parser parser(&lexer);
+    plasma::bytecode_compiler::compiler compiler(&parser);
+    plasma::error::error error;
+    if (!compiler.compile(code, &error)) {
+        std::cerr << error.string() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static size_t execute(plasma::vm::bytecode *code) {
+    std::istringstream stdinFile;
+    std::stringstream stdoutFile;
+    std::stringstream stderrFile;
+    plasma::vm::virtual_machine vm(stdinFile, stdoutFile, stderrFile);
+    plasma::vm::context c(1);
+    vm.initialize_context(&c);
+    code->index = 0;
+    bool success = false;
+    plasma::vm::value *result = vm.execute(&c, code, &success);
+    if (!success) {
+        std::cerr << plasma::vm::error_report(result) << std::endl;
+        return 0;
+    }
+    return c.statistics.allocatedValues;
+}
+
+int main(int argc, char **argv) {
+    std::vector<size_t> sizes;
+    for (int argument = 1; argument < argc; argument++) {
+        sizes.push_back(std::strtoull(argv[argument], nullptr, 10));
+    }
+    if (sizes.empty()) {
+        sizes = {1000, 100000};
+    }
+    const std::pair<std::string, std::string (*)(size_t)> workloads[] = {
+            {"script",  generate_script},
+            {"nested",  generate_nested},
+            {"strings", generate_strings},
+    };
+    for (size_t lines : sizes) {
+        size_t repetitions = lines <= 100000 ? 3 : 1;
+        for (const auto &[workload, generate] : workloads) {
+            plasma::reader::string_reader reader;
+            plasma::reader::string_reader_new(&reader, generate(lines));
+            measure(workload, lines, "lex", "tokens", repetitions, [&]() {
+                return lex(&reader);
+            });
+            measure(workload, lines, "parse", "nodes", repetitions, [&]() {
+                return parse(&reader);
+            });
+            plasma::vm::bytecode code;
+            measure(workload, lines, "compile", "instructions", repetitions, [&]() {
+                code = plasma::vm::bytecode{};
+                return compile(&reader, &code) ? code.instructions.size() : 0;
+            });
+            if (code.instructions.empty()) {
+                continue;
+            }
+            measure(workload, lines, "execute", "values", repetitions, [&]() {
+                return execute(&code);
+            });
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,47 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "tools.h"
+
+/*
+ * Escape decoding benchmark
+ * Decodes string literals of 64 bytes to 16 MiB with general_tooling::replace_escaped and reports the throughput,
+ * the literals are base64 blobs without escapes, embedded JSON with escaped quotes and text with newline, tab and
+ * unicode escapes
+ */
+
+static std::string make_literal(const std::string &piece, size_t length) {
+    std::string literal = "\"";
+    while (literal.size() < length) {
+        literal += piece;
+    }
+    literal += "\"";
+    return literal;
+}
+
+int main() {
+    const std::pair<std::string, std::string> pieces[] = {
+            {"base64", "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu"},
+            {"json",   "{\\\"name\\\": \\\"plasma\\\", \\\"values\\\": [1, 2, 3], \\\"nested\\\": {\\\"ok\\\": true}}, "},
+            {"text",   "Line of text with a tab\\t and a euro \\u20ac sign\\n"},
+    };
+    for (const auto &[name, piece] : pieces) {
+        for (size_t length : {64, 4096, 1048576, 16777216}) {
+            std::string literal = make_literal(piece, length);
+            size_t iterations = 268435456 / literal.size();
+            size_t decoded = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t iteration = 0; iteration < iterations; iteration++) {
+                decoded += plasma::general_tooling::replace_escaped(literal).size();
+            }
+            auto end = std::chrono::steady_clock::now();
+            double seconds = std::chrono::duration<double>(end - start).count();
+            std::cout << name << " " << literal.size() << " bytes: "
+                      << (double) (literal.size() * iterations) / seconds / (1024 * 1024) << " MiB/s, "
+                      << decoded / iterations << " bytes decoded" << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+
+#include "vm/virtual_machine.h"
+
+/*
+ * Hashing benchmark
+ * - Throughput of hash_string for short and long inputs
+ * - Collision rate of the hashes and of the table buckets they land in for string, integer and tuple keys
+ */
+
+static void report_throughput(plasma::vm::virtual_machine *vm, size_t length, size_t iterations) {
+    std::string input(length, 'a');
+    for (size_t index = 0; index < length; index++) {
+        input[index] = (char) ('a' + (index * 7) % 26);
+    }
+    int64_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        input[iteration % length] ^= 1;
+        sink ^= vm->hash_string(input);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "hash_string " << length << " bytes: "
+              << (double) (length * iterations) / seconds / (1024 * 1024) << " MiB/s, "
+              << seconds * 1e9 / (double) iterations << " ns/hash"
+              << " (" << (sink & 1) << ")" << std::endl;
+}
+
+static void report_collisions(const std::string &name, const std::vector<int64_t> &hashes) {
+    // Same bucket selection as a power of two table with a load factor of 1/2
+    size_t buckets = 1;
+    while (buckets < hashes.size() * 2) {
+        buckets <<= 1;
+    }
+    std::unordered_set<int64_t> distinct;
+    std::unordered_set<uint64_t> usedBuckets;
+    for (int64_t hash : hashes) {
+        distinct.insert(hash);
+        usedBuckets.insert(((uint64_t) hash) & (buckets - 1));
+    }
+    // Expected number of occupied buckets for uniformly distributed hashes
+    double expected = (double) buckets * (1 - std::exp(-(double) hashes.size() / (double) buckets));
+    std::cout << name << ": " << hashes.size() << " keys, "
+              << hashes.size() - distinct.size() << " full hash collisions, "
+              << usedBuckets.size() << " buckets used of " << (size_t) expected << " expected" << std::endl;
+}
+
+int main() {
+    std::istringstream stdinFile;
+    std::stringstream stdoutFile;
+    std::stringstream stderrFile;
+    plasma::vm::virtual_machine vm(stdinFile, stdoutFile, stderrFile);
+
+    for (size_t length : {4, 8, 16, 32, 64, 256, 4096}) {
+        report_throughput(&vm, length, length < 256 ? 10000000 : 1000000);
+    }
+
+    const int64_t side = 1000;
+    std::vector<int64_t> hashes;
+    hashes.reserve(side * side);
+    for (int64_t first = 0; first < side; first++) {
+        for (int64_t second = 0; second < side; second++) {
+            hashes.push_back(vm.hash_array({first, second}));
+        }
+    }
+    report_collisions("tuple (i, j)", hashes);
+
+    hashes.clear();
+    for (int64_t index = 0; index < side * side; index++) {
+        hashes.push_back(vm.hash_string("key" + std::to_string(index)));
+    }
+    report_collisions("string key<i>", hashes);
+
+    hashes.clear();
+    for (int64_t index = 0; index < side * side; index++) {
+        hashes.push_back(vm.hash_float((double) index + 0.5));
+    }
+    report_collisions("float i + 0.5", hashes);
+    return 0;
+}
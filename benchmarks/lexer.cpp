@@ -0,0 +1,104 @@
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include "reader.h"
+#include "compiler/lexer.h"
+
+/*
+ * Lexer benchmark
+ * - Tokenizes generated scripts of 1 MiB to 64 MiB and reports the throughput in MiB/s and tokens per second,
+ *   the scripts mix keywords, identifiers, numbers, strings, operators and comments like real programs
+ * - Loads and tokenizes a 50 MiB script file with each reader, separating the time spent loading it
+ */
+
+static std::string generate_script(size_t length) {
+    const std::string block =
+            "# Accumulate the values of the table\n"
+            "def accumulate(values, start)\n"
+            "    result = start\n"
+            "    for index in range(0, values.Length(), 1)\n"
+            "        if values[index] >= 0x1F and values[index] != 1_000\n"
+            "            result += values[index] * 2.5e+3 // 7\n"
+            "        elif values[index] < 0b101\n"
+            "            result -= 0o17 ** 2\n"
+            "        else\n"
+            "            result = result.Add(\"accumulated\", 'value', b'bytes')\n"
+            "        end\n"
+            "    end\n"
+            "    return (result, None, True, False)\n"
+            "end\n";
+    std::string script;
+    script.reserve(length + block.size());
+    while (script.size() < length) {
+        script += block;
+    }
+    return script;
+}
+
+template<typename Reader>
+static size_t tokenize(Reader *reader) {
+    plasma::lexer::lexer lexer(reader);
+    plasma::lexer::token token;
+    plasma::error::error error;
+    size_t tokens = 0;
+    while (lexer.hasNext()) {
+        if (!lexer.next(&token, &error)) {
+            std::cout << error.string() << std::endl;
+            return tokens;
+        }
+        tokens++;
+    }
+    return tokens;
+}
+
+template<typename Reader, typename Load>
+static void report_file(const std::string &name, const std::string &path, Load &&load) {
+    auto start = std::chrono::steady_clock::now();
+    Reader reader;
+    if (!load(&reader, path)) {
+        std::cout << name << ": could not read " << path << std::endl;
+        return;
+    }
+    auto loaded = std::chrono::steady_clock::now();
+    size_t tokens = tokenize(&reader);
+    auto end = std::chrono::steady_clock::now();
+    std::cout << name << ": load " << std::chrono::duration<double, std::milli>(loaded - start).count() << " ms, "
+              << "tokenize " << std::chrono::duration<double, std::milli>(end - loaded).count() << " ms, "
+              << tokens << " tokens" << std::endl;
+}
+
+int main() {
+    for (size_t length : {1048576, 16777216, 67108864}) {
+        plasma::reader::string_reader reader;
+        plasma::reader::string_reader_new(&reader, generate_script(length));
+        size_t iterations = 67108864 / length * 2;
+        size_t tokens = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t iteration = 0; iteration < iterations; iteration++) {
+            tokens += tokenize(&reader);
+        }
+        auto end = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        std::cout << reader.content.size() << " bytes: "
+                  << (double) (reader.content.size() * iterations) / seconds / (1024 * 1024) << " MiB/s, "
+                  << (double) tokens / seconds / 1e6 << " M tokens/s" << std::endl;
+    }
+
+    std::string path = (std::filesystem::temp_directory_path() / "plasma_lexer_benchmark.pm").string();
+    {
+        std::string script = generate_script(52428800);
+        std::FILE *file = std::fopen(path.c_str(), "wb");
+        if (file == nullptr) {
+            return 1;
+        }
+        std::fwrite(script.data(), 1, script.size(), file);
+        std::fclose(file);
+    }
+    report_file<plasma::reader::file_reader>("file_reader", path, plasma::reader::file_reader_new);
+    report_file<plasma::reader::string_reader>("string_reader", path, plasma::reader::string_reader_new_from_file);
+    std::filesystem::remove(path);
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+#include "tools.h"
+
+/*
+ * Substring search benchmark
+ * Compares general_tooling::search with std::string_view::find for haystacks from 16 bytes to 100 MiB,
+ * the needle is placed at the end so the whole haystack is scanned
+ */
+
+template<typename Search>
+static double measure(size_t iterations, Search &&search) {
+    // Every result is stored, so the searches can not be optimized away
+    [[maybe_unused]] volatile size_t sink;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; iteration++) {
+        sink = search();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count() / (double) iterations;
+}
+
+int main() {
+    const std::string needle = "needle-x";
+    for (size_t length : {16, 256, 4096, 65536, 1048576, 16777216, 104857600}) {
+        // Text with frequent partial matches of the needle
+        std::string haystack;
+        haystack.reserve(length);
+        while (haystack.size() + needle.size() < length) {
+            haystack += "needle in a haystack, ";
+        }
+        haystack.resize(length - needle.size(), 'n');
+        haystack += needle;
+        size_t iterations = length < 65536 ? 1000000 : (104857600 / length) * 4;
+
+        double simd = measure(iterations, [&]() {
+            return plasma::general_tooling::search((const uint8_t *) haystack.data(), haystack.size(),
+                                                   (const uint8_t *) needle.data(), needle.size());
+        });
+        double standard = measure(iterations, [&]() {
+            return std::string_view(haystack).find(needle);
+        });
+        std::cout << length << " bytes: search " << (double) length / simd / (1024 * 1024) << " MiB/s, "
+                  << "string_view::find " << (double) length / standard / (1024 * 1024) << " MiB/s" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+#ifndef PLASMA_ARENA_H
+#define PLASMA_ARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace plasma::ast {
+    /*
+     * Bump allocator for the nodes of one compilation
+     * - Nodes and their child lists are carved out of blocks, allocating is moving a pointer
+     * - Nothing is freed one by one, the blocks are dropped together by release or the destructor
+     * - Destructors of the objects are never run, they must only own memory of the same arena
+     */
+    class arena : public std::pmr::memory_resource {
+    public:
+        arena() = default;
+
+        arena(const arena &) = delete;
+
+        arena &operator=(const arena &) = delete;
+
+        ~arena() override;
+
+        template<typename T, typename... Arguments>
+        T *make(Arguments &&... arguments) {
+            this->objects++;
+            return new(this->allocate(sizeof(T), alignof(T))) T(std::forward<Arguments>(arguments)...);
+        }
+
+        // Frees every block, the objects made by this arena are gone after it
+        void release();
+
+        // Like release but keeps the newest block to make the next objects in it
+        void reset();
+
+        // Bytes of the blocks owned by this arena
+        [[nodiscard]] size_t memory_usage() const {
+            return this->reserved;
+        }
+
+        // Objects made with make since the arena was constructed, release and reset do not clear it
+        [[nodiscard]] size_t object_count() const {
+            return this->objects;
+        }
+
+    private:
+        struct block {
+            block *previous;
+            size_t size;
+        };
+
+        static constexpr size_t FirstBlockSize = 16 * 1024;
+        static constexpr size_t MaxBlockSize = 1024 * 1024;
+
+        block *last = nullptr;
+        std::byte *position = nullptr;
+        std::byte *end = nullptr;
+        size_t nextBlockSize = FirstBlockSize;
+        size_t reserved = 0;
+        size_t objects = 0;
+
+        void *do_allocate(size_t bytes, size_t alignment) override;
+
+        void do_deallocate(void *, size_t, size_t) override {
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    // Children of a node, they must be allocated by the arena of the node, std::move them into the node
+    template<typename T>
+    using node_list = std::pmr::vector<T>;
+}
+
+#endif //PLASMA_ARENA_H
@@ -6,6 +6,7 @@
 #include <cinttypes>
 #include <any>
 
+#include "arena.h"
 #include "lexer.h"
 #include "vm/virtual_machine.h"
 
@@ -52,21 +53,25 @@ namespace plasma::ast {
         ProgramID
     };
 
+    /*
+     * Nodes are made by an arena (see arena.h) and are never deleted one by one,
+     * the whole tree goes away when its arena is released
+     */
     struct Node {
         size_t TypeID;
 
-        virtual bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) = 0;
+        virtual bool compile(vm::instruction_list *result, plasma::error::error *compilationError) = 0;
 
-        virtual Node *copy() = 0;
+        virtual Node *copy(arena *destination) = 0;
     };
 
     struct Expression : Node {
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) { return false; };
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) { return false; };
 
-        Node *copy() { return nullptr; };
+        Node *copy(arena *destination) { return nullptr; };
 
         bool
-        compile_and_push(bool push, std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+        compile_and_push(bool push, vm::instruction_list *result, plasma::error::error *compilationError) {
             if (!this->compile(result, compilationError)) {
                 return false;
             }
@@ -86,43 +91,27 @@ namespace plasma::ast {
      */
 
     struct ArrayExpression : public Expression {
-        explicit ArrayExpression(std::vector<Expression *> values) {
+        explicit ArrayExpression(node_list<Expression *> &&values) : Values(std::move(values)) {
             this->TypeID = ArrayID;
-            this->Values = std::move(values);
-        }
-
-        ~ArrayExpression() {
-            for (Expression *value : this->Values) {
-                delete value;
-            }
-            this->Values.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
-        std::vector<Expression *> Values;
+        node_list<Expression *> Values;
     };
 
     struct TupleExpression : public Expression {
-        explicit TupleExpression(std::vector<Expression *> values) {
+        explicit TupleExpression(node_list<Expression *> &&values) : Values(std::move(values)) {
             this->TypeID = TupleID;
-            this->Values = std::move(values);
         }
 
-        ~TupleExpression() {
-            for (Expression *value : this->Values) {
-                delete value;
-            }
-            this->Values.clear();
-        }
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        Node *copy(arena *destination) override;
 
-        Node *copy() override;
-
-        std::vector<Expression *> Values;
+        node_list<Expression *> Values;
     };
 
     struct KeyValue {
@@ -131,41 +120,28 @@ namespace plasma::ast {
             this->Value = value;
         }
 
-        ~KeyValue() {
-            delete this->Key;
-            delete this->Value;
-        }
-
         Expression *Key;
         Expression *Value;
     };
 
     struct HashExpression : public Expression {
-        explicit HashExpression(std::vector<KeyValue *> keyValues) {
+        explicit HashExpression(node_list<KeyValue *> &&keyValues) : KeyValues(std::move(keyValues)) {
             this->TypeID = HashID;
-            this->KeyValues = std::move(keyValues);
-        }
-
-        ~HashExpression() {
-            for (KeyValue *keyValue : this->KeyValues) {
-                delete keyValue;
-            }
-            this->KeyValues.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
-        std::vector<KeyValue *> KeyValues;
+        node_list<KeyValue *> KeyValues;
     };
 
     struct Identifier : public Expression {
         explicit Identifier(lexer::token token) : Token(std::move(token)) { this->TypeID = IdentifierID; }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         lexer::token Token;
     };
@@ -173,9 +149,9 @@ namespace plasma::ast {
     struct BasicLiteralExpression : public Expression {
         explicit BasicLiteralExpression(lexer::token token) : Token(std::move(token)) { this->TypeID = BasicLiteralID; }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         lexer::token Token;
     };
@@ -188,14 +164,9 @@ namespace plasma::ast {
             this->RightHandSide = rightHandSide;
         }
 
-        ~BinaryExpression() {
-            delete this->LeftHandSide;
-            delete this->RightHandSide;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *LeftHandSide;
         lexer::token Operator;
@@ -208,84 +179,55 @@ namespace plasma::ast {
             this->X = x;
         }
 
-        ~UnaryExpression() {
-            delete this->X;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         lexer::token Operator;
         Expression *X;
     };
 
     struct ReturnStatement : public Node {
-        explicit ReturnStatement(std::vector<Expression *> results) {
+        explicit ReturnStatement(node_list<Expression *> &&results) : Results(std::move(results)) {
             this->TypeID = ReturnID;
-            this->Results = std::move(results);
         }
 
-        ~ReturnStatement() {
-            for (Expression *result : this->Results) {
-                delete result;
-            }
-            this->Results.clear();
-        }
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        Node *copy(arena *destination) override;
 
-        Node *copy() override;
-
-        std::vector<Expression *> Results;
+        node_list<Expression *> Results;
     };
 
     struct LambdaExpression : public Expression {
-        LambdaExpression(std::vector<Identifier *> arguments, ReturnStatement *output) {
+        LambdaExpression(node_list<Identifier *> &&arguments, ReturnStatement *output)
+                : Arguments(std::move(arguments)) {
             this->TypeID = LambdaID;
-            this->Arguments = arguments;
             this->Output = output;
         }
 
-        ~LambdaExpression() {
-            for (Identifier *argument: this->Arguments) {
-                delete argument;
-            }
-            this->Arguments.clear();
-            delete this->Output;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
-        std::vector<Identifier *> Arguments;
+        node_list<Identifier *> Arguments;
         ReturnStatement *Output;
     };
 
     struct GeneratorExpression : public Expression {
-        GeneratorExpression(Expression *op, std::vector<Identifier *> receivers, Expression *source) {
+        GeneratorExpression(Expression *op, node_list<Identifier *> &&receivers, Expression *source)
+                : Receivers(std::move(receivers)) {
             this->TypeID = GeneratorID;
             this->Operation = op;
-            this->Receivers = receivers;
             this->Source = source;
         }
 
-        ~GeneratorExpression() {
-            delete this->Operation;
-            for (Identifier *receiver : this->Receivers) {
-                delete receiver;
-            }
-            this->Receivers.clear();
-            delete this->Source;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Operation;
-        std::vector<Identifier *> Receivers;
+        node_list<Identifier *> Receivers;
         Expression *Source;
     };
 
@@ -296,40 +238,27 @@ namespace plasma::ast {
             this->Identifier = name;
         }
 
-        ~SelectorExpression() {
-            delete this->X;
-            delete this->Identifier;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *X = nullptr;
         Identifier *Identifier;
     };
 
     struct MethodInvocationExpression : public Expression {
-        MethodInvocationExpression(Expression *function, std::vector<Expression *> arguments) {
+        MethodInvocationExpression(Expression *function, node_list<Expression *> &&arguments)
+                : Arguments(std::move(arguments)) {
             this->TypeID = MethodInvocationID;
             this->Function = function;
-            this->Arguments = arguments;
-        }
-
-        ~MethodInvocationExpression() {
-            delete this->Function;
-            for (Expression *argument : this->Arguments) {
-                delete argument;
-            }
-            this->Arguments.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Function;
-        std::vector<Expression *> Arguments;
+        node_list<Expression *> Arguments;
     };
 
     struct IndexExpression : public Expression {
@@ -339,31 +268,15 @@ namespace plasma::ast {
             this->Index = index;
         }
 
-        ~IndexExpression() {
-            delete this->Source;
-            delete this->Index;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Source;
         Expression *Index;
     };
 
     struct IfOneLinerExpression : public Expression {
-        IfOneLinerExpression(Expression *result, Expression *condition) {
-            this->TypeID = IfOneLinerID;
-            this->Result = result;
-            this->Condition = condition;
-            this->ElseResult = new Identifier(
-                    lexer::token{
-                            .string = lexer::NoneString
-                    }
-            );
-        }
-
         IfOneLinerExpression(Expression *result, Expression *condition, Expression *elseResult) {
             this->TypeID = IfOneLinerID;
             this->Result = result;
@@ -371,15 +284,9 @@ namespace plasma::ast {
             this->ElseResult = elseResult;
         }
 
-        ~IfOneLinerExpression() {
-            delete this->Result;
-            delete this->Condition;
-            delete this->ElseResult;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Result;
         Expression *Condition;
@@ -387,18 +294,6 @@ namespace plasma::ast {
     };
 
     struct UnlessOneLinerExpression : public Expression {
-
-        UnlessOneLinerExpression(Expression *result, Expression *condition) {
-            this->TypeID = UnlessOneLinerID;
-            this->Result = result;
-            this->Condition = condition;
-            this->ElseResult = new Identifier(
-                    lexer::token{
-                            .string = lexer::NoneString
-                    }
-            );
-        }
-
         UnlessOneLinerExpression(Expression *result, Expression *condition, Expression *elseResult) {
             this->TypeID = UnlessOneLinerID;
             this->Result = result;
@@ -406,15 +301,9 @@ namespace plasma::ast {
             this->ElseResult = elseResult;
         }
 
-        ~UnlessOneLinerExpression() {
-            delete this->Result;
-            delete this->Condition;
-            delete this->ElseResult;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Result;
         Expression *Condition;
@@ -427,13 +316,9 @@ namespace plasma::ast {
             this->X = x;
         }
 
-        ~ParenthesesExpression() {
-            delete this->X;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *X;
     };
@@ -451,14 +336,9 @@ namespace plasma::ast {
             this->RightHandSide = rightHandSide;
         }
 
-        ~AssignStatement() {
-            delete this->LeftHandSide;
-            delete this->RightHandSide;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *LeftHandSide;
         lexer::token AssignOperator;
@@ -466,401 +346,214 @@ namespace plasma::ast {
     };
 
     struct DoWhileStatement : public Node {
-        DoWhileStatement(Expression *condition, std::vector<Node *> body) {
+        DoWhileStatement(Expression *condition, node_list<Node *> &&body) : Body(std::move(body)) {
             this->TypeID = DoWhileID;
             this->Condition = condition;
-            this->Body = body;
-        }
-
-        ~DoWhileStatement() {
-            delete this->Condition;
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Condition;
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
 
     };
 
     struct WhileStatement : public Node {
-        WhileStatement(Expression *condition, std::vector<Node *> body) {
+        WhileStatement(Expression *condition, node_list<Node *> &&body) : Body(std::move(body)) {
             this->TypeID = WhileID;
             this->Condition = condition;
-            this->Body = body;
-        }
-
-        ~WhileStatement() {
-            delete this->Condition;
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Condition;
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
 
     };
 
     struct UntilStatement : public Node {
-        UntilStatement(Expression *condition, std::vector<Node *> body) {
+        UntilStatement(Expression *condition, node_list<Node *> &&body) : Body(std::move(body)) {
             this->TypeID = UntilID;
             this->Condition = condition;
-            this->Body = body;
         }
 
-        ~UntilStatement() {
-            delete this->Condition;
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
-        }
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
-
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Condition;
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
     };
 
     struct ForStatement : public Node {
-        ForStatement(std::vector<Identifier *> receivers, Expression *source, std::vector<Node *> body) {
+        ForStatement(node_list<Identifier *> &&receivers, Expression *source, node_list<Node *> &&body)
+                : Receivers(std::move(receivers)), Body(std::move(body)) {
             this->TypeID = ForID;
-            this->Receivers = receivers;
             this->Source = source;
-            this->Body = body;
-        }
-
-        ~ForStatement() {
-            for (Identifier *receiver : this->Receivers) {
-                delete receiver;
-            }
-            this->Receivers.clear();
-            delete this->Source;
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
         }
 
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
-
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
-        std::vector<Identifier *> Receivers;
+        node_list<Identifier *> Receivers;
         Expression *Source;
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
     };
 
     struct IfStatement : public Node {
-        IfStatement(Expression *condition, std::vector<Node *> body,
-                    std::vector<Node *> elseBody) {
+        IfStatement(Expression *condition, node_list<Node *> &&body,
+                    node_list<Node *> &&elseBody) : Body(std::move(body)), Else(std::move(elseBody)) {
             this->TypeID = IfID;
             this->Condition = condition;
-            this->Body = body;
-            this->Else = elseBody;
         }
 
-        ~IfStatement() {
-            delete this->Condition;
-            for (Node *node: this->Body) {
-                delete node;
-            }
-            this->Body.clear();
-
-            for (Node *node: this->Else) {
-                delete node;
-            }
-            this->Else.clear();
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Condition;
-        std::vector<Node *> Body;
-        std::vector<Node *> Else;
+        node_list<Node *> Body;
+        node_list<Node *> Else;
     };
 
     struct UnlessStatement : public Node {
-        UnlessStatement(Expression *condition, std::vector<Node *> body,
-                        std::vector<Node *> elseBody) {
+        UnlessStatement(Expression *condition, node_list<Node *> &&body,
+                        node_list<Node *> &&elseBody) : Body(std::move(body)), Else(std::move(elseBody)) {
             this->TypeID = UnlessID;
             this->Condition = condition;
-            this->Body = body;
-            this->Else = elseBody;
         }
 
-        ~UnlessStatement() {
-            delete this->Condition;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-            for (Node *node: this->Body) {
-                delete node;
-            }
-            this->Body.clear();
-
-            for (Node *node: this->Else) {
-                delete node;
-            }
-            this->Else.clear();
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
-
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Condition;
-        std::vector<Node *> Body;
-        std::vector<Node *> Else;
+        node_list<Node *> Body;
+        node_list<Node *> Else;
     };
 
     struct CaseBlock {
-        CaseBlock(std::vector<Expression *> cases, std::vector<Node *> body) {
-            this->Cases = cases;
-            this->Body = body;
-        }
-
-        ~CaseBlock() {
-            for (Expression *c : this->Cases) {
-                delete c;
-            }
-            this->Cases.clear();
+        CaseBlock(node_list<Expression *> &&cases, node_list<Node *> &&body)
+                : Cases(std::move(cases)), Body(std::move(body)) {
 
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
         }
 
-        std::vector<Expression *> Cases;
-        std::vector<Node *> Body;
+        node_list<Expression *> Cases;
+        node_list<Node *> Body;
     };
 
     struct SwitchStatement : public Node {
-        SwitchStatement(Expression *target, std::vector<CaseBlock *> caseBlocks, std::vector<Node *> defaultBody) {
+        SwitchStatement(Expression *target, node_list<CaseBlock *> &&caseBlocks, node_list<Node *> &&defaultBody)
+                : CaseBlocks(std::move(caseBlocks)), Default(std::move(defaultBody)) {
             this->TypeID = SwitchID;
             this->Target = target;
-            this->CaseBlocks = caseBlocks;
-            this->Default = defaultBody;
         }
 
-        ~SwitchStatement() {
-            delete this->Target;
-            for (CaseBlock *caseBlock : this->CaseBlocks) {
-                delete caseBlock;
-            }
-            this->CaseBlocks.clear();
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-            for (Node *node : this->Default) {
-                delete node;
-            }
-            this->Default.clear();
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
-
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *Target;
-        std::vector<CaseBlock *> CaseBlocks;
-        std::vector<Node *> Default;
+        node_list<CaseBlock *> CaseBlocks;
+        node_list<Node *> Default;
     };
 
     struct ModuleStatement : public Node {
-        ModuleStatement(Identifier *name, std::vector<Node *> body) {
+        ModuleStatement(Identifier *name, node_list<Node *> &&body) : Body(std::move(body)) {
             this->TypeID = ModuleID;
             this->Name = name;
-            this->Body = body;
-        }
-
-        ~ModuleStatement() {
-            delete this->Name;
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Identifier *Name;
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
     };
 
     struct FunctionDefinitionStatement : public Node {
-        FunctionDefinitionStatement(Identifier *name, std::vector<Identifier *> arguments, std::vector<Node *> body) {
+        FunctionDefinitionStatement(Identifier *name, node_list<Identifier *> &&arguments, node_list<Node *> &&body)
+                : Arguments(std::move(arguments)), Body(std::move(body)) {
             this->TypeID = FunctionDefinitionID;
             this->Name = name;
-            this->Arguments = arguments;
-            this->Body = body;
-        }
-
-        ~FunctionDefinitionStatement() {
-            delete this->Name;
-            for (Identifier *argument : this->Arguments) {
-                delete argument;
-            }
-            this->Arguments.clear();
-
-            for (Node *node :this->Body) {
-                delete node;
-            }
-            this->Body.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Identifier *Name;
-        std::vector<Identifier *> Arguments;
-        std::vector<Node *> Body;
+        node_list<Identifier *> Arguments;
+        node_list<Node *> Body;
     };
 
     struct InterfaceStatement : public Node {
-        InterfaceStatement(Identifier *name, std::vector<Expression *> bases,
-                           std::vector<FunctionDefinitionStatement *> methods) {
+        InterfaceStatement(Identifier *name, node_list<Expression *> &&bases,
+                           node_list<FunctionDefinitionStatement *> &&methods)
+                : Bases(std::move(bases)), MethodDefinitions(std::move(methods)) {
             this->TypeID = InterfaceID;
             this->Name = name;
-            this->Bases = bases;
-            this->MethodDefinitions = methods;
-        }
-
-        ~InterfaceStatement() {
-            delete this->Name;
-            for (Expression *base : this->Bases) {
-                delete base;
-            }
-            this->Bases.clear();
-
-            for (FunctionDefinitionStatement *functionDefinitionStatement : this->MethodDefinitions) {
-                delete functionDefinitionStatement;
-            }
-            this->MethodDefinitions.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Identifier *Name;
-        std::vector<Expression *> Bases;
-        std::vector<FunctionDefinitionStatement *> MethodDefinitions;
+        node_list<Expression *> Bases;
+        node_list<FunctionDefinitionStatement *> MethodDefinitions;
     };
 
     struct ClassStatement : public Node {
-        ClassStatement(Identifier *name, std::vector<Expression *> bases,
-                       std::vector<Node *> body) {
+        ClassStatement(Identifier *name, node_list<Expression *> &&bases,
+                       node_list<Node *> &&body) : Bases(std::move(bases)), Body(std::move(body)) {
             this->TypeID = ClassID;
             this->Name = name;
-            this->Bases = bases;
-            this->Body = body;
         }
 
-        ~ClassStatement() {
-            delete this->Name;
-            for (Expression *base : this->Bases) {
-                delete base;
-            }
-            this->Bases.clear();
-
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Identifier *Name;
-        std::vector<Expression *> Bases;
-        std::vector<Node *> Body;
+        node_list<Expression *> Bases;
+        node_list<Node *> Body;
     };
 
     struct ExceptBlock {
-        ExceptBlock(TupleExpression *targets, Identifier *captureName, std::vector<Node *> body) {
+        ExceptBlock(TupleExpression *targets, Identifier *captureName, node_list<Node *> &&body)
+                : Body(std::move(body)) {
             this->Targets = targets;
             this->CaptureName = captureName;
-            this->Body = body;
-        }
-
-        ~ExceptBlock() {
-            delete this->Targets;
-
-            if (this->CaptureName != nullptr) {
-                delete this->CaptureName;
-            }
-
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
         }
 
         TupleExpression *Targets;
         Identifier *CaptureName;
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
     };
 
     struct TryStatement : public Node {
-        TryStatement(std::vector<Node *> body, std::vector<ExceptBlock *> exceptBlocks, std::vector<Node *> elseBody,
-                     std::vector<Node *> finallyBody) {
+        TryStatement(node_list<Node *> &&body, node_list<ExceptBlock *> &&exceptBlocks, node_list<Node *> &&elseBody,
+                     node_list<Node *> &&finallyBody)
+                : Body(std::move(body)), ExceptBlocks(std::move(exceptBlocks)), Else(std::move(elseBody)),
+                  Finally(std::move(finallyBody)) {
             this->TypeID = TryID;
-            this->Body = body;
-            this->ExceptBlocks = exceptBlocks;
-            this->Else = elseBody;
-            this->Finally = finallyBody;
         }
 
-        ~TryStatement() {
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
-
-            for (ExceptBlock *exceptBlock : this->ExceptBlocks) {
-                delete exceptBlock;
-            }
-            this->ExceptBlocks.clear();
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-            for (Node *node : this->Else) {
-                delete node;
-            }
-            this->Else.clear();
+        Node *copy(arena *destination) override;
 
-            for (Node *node : this->Finally) {
-                delete node;
-            }
-            this->Finally.clear();
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
-
-        Node *copy() override;
-
-        std::vector<Node *> Body;
-        std::vector<ExceptBlock *> ExceptBlocks;
-        std::vector<Node *> Else;
-        std::vector<Node *> Finally;
+        node_list<Node *> Body;
+        node_list<ExceptBlock *> ExceptBlocks;
+        node_list<Node *> Else;
+        node_list<Node *> Finally;
     };
 
     struct RaiseStatement : public Node {
@@ -869,55 +562,35 @@ namespace plasma::ast {
             this->X = x;
         }
 
-        ~RaiseStatement() {
-            delete this->X;
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         Expression *X;
     };
 
     struct BeginStatement : public Node {
-        BeginStatement(std::vector<Node *> body) {
+        BeginStatement(node_list<Node *> &&body) : Body(std::move(body)) {
             this->TypeID = BeginID;
-            this->Body = body;
-        }
-
-        ~BeginStatement() {
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
     };
 
     struct EndStatement : public Node {
-        EndStatement(std::vector<Node *> body) {
+        EndStatement(node_list<Node *> &&body) : Body(std::move(body)) {
             this->TypeID = EndID;
-            this->Body = body;
         }
 
-        ~EndStatement() {
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
-        }
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        Node *copy(arena *destination) override;
 
-        Node *copy() override;
-
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
     };
 
     struct ContinueStatement : public Node {
@@ -925,9 +598,9 @@ namespace plasma::ast {
             this->TypeID = ContinueID;
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
     };
 
     struct BreakStatement : public Node {
@@ -935,9 +608,9 @@ namespace plasma::ast {
             this->TypeID = BreakID;
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
     };
 
     struct RedoStatement : public Node {
@@ -945,9 +618,9 @@ namespace plasma::ast {
             this->TypeID = RedoID;
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
     };
 
     struct PassStatement : public Node {
@@ -955,39 +628,26 @@ namespace plasma::ast {
             this->TypeID = PassID;
         }
 
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
     };
 
     /*
      * Program is an special node that is only used as the root of the entire program to be compiled
      */
     struct Program : public Node {
-        Program() {
+        explicit Program(arena *nodes) : Body(nodes) {
             this->TypeID = ProgramID;
         }
 
-        ~Program() {
-            if (this->Begin != nullptr) {
-                delete this->Begin;
-            }
-            if (this->End != nullptr) {
-                delete this->End;
-            }
-            for (Node *node : this->Body) {
-                delete node;
-            }
-            this->Body.clear();
-        }
-
-        bool compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) override;
+        bool compile(vm::instruction_list *result, plasma::error::error *compilationError) override;
 
-        Node *copy() override;
+        Node *copy(arena *destination) override;
 
         BeginStatement *Begin = nullptr;
         EndStatement *End = nullptr;
-        std::vector<Node *> Body;
+        node_list<Node *> Body;
     };
 
     /*
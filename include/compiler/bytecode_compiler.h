@@ -8,10 +8,28 @@
 namespace plasma::bytecode_compiler {
     struct compiler {
         plasma::parser::parser *parser;
+        // Threads used by compile, one per core by default, 1 compiles in the calling thread
+        // The calling thread is helped by the threads of thread_pool::shared, they are only made once
+        unsigned int workers;
 
         explicit compiler(plasma::parser::parser *p);
 
+        /*
+         * Compile the whole Program
+         * - Top level definitions and the runs of statements between them are compiled concurrently, scripts with
+         *   fewer of them than workers are compiled in the calling thread
+         * - The pieces are joined in the order of the script, the result does not depend on the workers
+         * - On syntax errors compilationError is the first one, parser->Errors has all of them
+         */
         bool compile(vm::bytecode *result, error::error *compilationError) const;
+
+        /*
+         * Compile without building the whole Program
+         * - Each top level statement is compiled as soon as it is parsed and its nodes are dropped after it
+         * - BEGIN and END blocks are compiled apart and placed at the start and the end of the bytecode
+         * - Produces the same instructions as compile
+         */
+        bool compile_streaming(vm::bytecode *result, error::error *compilationError) const;
     };
 }
 
@@ -2,14 +2,12 @@
 #define PLASMA_LEXER_H
 
 #include <string>
-#include <regex>
+#include <string_view>
 
 #include "reader.h"
 #include "plasma_error.h"
 
 namespace plasma::lexer {
-    const std::regex identifierCheck("^[a-zA-Z_]+[a-zA-Z0-9_]*$");
-    const std::regex junkKindCheck("^\\00+$");
     const char CommaChar = ',';
     const char ColonChar = ':';
     const char SemiColonChar = ';';
@@ -37,48 +35,49 @@ namespace plasma::lexer {
     const char EqualsChar = '=';
     const char WhiteSpaceChar = ' ';
     const char TabChar = '\t';
+    const char CarriageReturnChar = '\r';
     const char CommentChar = '#';
     const char BackSlashChar = '\\';
-    const char PassString[] = "pass";
-    const char EndString[] = "end";
-    const char IfString[] = "if";
-    const char UnlessString[] = "unless";
-    const char ElseString[] = "else";
-    const char ElifString[] = "elif";
-    const char WhileString[] = "while";
-    const char DoString[] = "do";
-    const char ForString[] = "for";
-    const char UntilString[] = "until";
-    const char SwitchString[] = "switch";
-    const char CaseString[] = "case";
-    const char DefaultString[] = "default";
-    const char ReturnString[] = "return";
-    const char ContinueString[] = "continue";
-    const char BreakString[] = "break";
-    const char RedoString[] = "redo";
-    const char DeferString[] = "defer";
-    const char ModuleString[] = "module";
-    const char DefString[] = "def";
-    const char LambdaString[] = "lambda";
-    const char InterfaceString[] = "interface";
-    const char ClassString[] = "class";
-    const char TryString[] = "try";
-    const char ExceptString[] = "except";
-    const char FinallyString[] = "finally";
-    const char AndString[] = "and";
-    const char OrString[] = "or";
-    const char XorString[] = "xor";
-    const char InString[] = "in";
-    const char AwaitString[] = "await";
-    const char BEGINString[] = "BEGIN";
-    const char ENDString[] = "END";
-    const char NotString[] = "not";
-    const char TrueString[] = "True";
-    const char FalseString[] = "False";
-    const char NoneString[] = "None";
-    const char ContextString[] = "context";
-    const char RaiseString[] = "raise";
-    const char AsString[] = "as";
+    constexpr char PassString[] = "pass";
+    constexpr char EndString[] = "end";
+    constexpr char IfString[] = "if";
+    constexpr char UnlessString[] = "unless";
+    constexpr char ElseString[] = "else";
+    constexpr char ElifString[] = "elif";
+    constexpr char WhileString[] = "while";
+    constexpr char DoString[] = "do";
+    constexpr char ForString[] = "for";
+    constexpr char UntilString[] = "until";
+    constexpr char SwitchString[] = "switch";
+    constexpr char CaseString[] = "case";
+    constexpr char DefaultString[] = "default";
+    constexpr char ReturnString[] = "return";
+    constexpr char ContinueString[] = "continue";
+    constexpr char BreakString[] = "break";
+    constexpr char RedoString[] = "redo";
+    constexpr char DeferString[] = "defer";
+    constexpr char ModuleString[] = "module";
+    constexpr char DefString[] = "def";
+    constexpr char LambdaString[] = "lambda";
+    constexpr char InterfaceString[] = "interface";
+    constexpr char ClassString[] = "class";
+    constexpr char TryString[] = "try";
+    constexpr char ExceptString[] = "except";
+    constexpr char FinallyString[] = "finally";
+    constexpr char AndString[] = "and";
+    constexpr char OrString[] = "or";
+    constexpr char XorString[] = "xor";
+    constexpr char InString[] = "in";
+    constexpr char AwaitString[] = "await";
+    constexpr char BEGINString[] = "BEGIN";
+    constexpr char ENDString[] = "END";
+    constexpr char NotString[] = "not";
+    constexpr char TrueString[] = "True";
+    constexpr char FalseString[] = "False";
+    constexpr char NoneString[] = "None";
+    constexpr char ContextString[] = "context";
+    constexpr char RaiseString[] = "raise";
+    constexpr char AsString[] = "as";
     enum {
         NotSet, // 0
         Unknown,
@@ -196,74 +195,98 @@ namespace plasma::lexer {
         Dot,
     };
 
+    // Value of a numeric literal, integer for the integer kinds and floating for the float kinds
+    union numeric_value {
+        int64_t integer;
+        double floating;
+    };
+
+    /*
+     * Tokens point into the source of the lexer, they are valid while the reader that produced it is alive
+     * - Byte strings keep their b prefix and comments their #
+     */
     struct token {
-        std::string string;
+        std::string_view string;
         uint8_t directValue;
         uint8_t kind;
         int line;
+        int column = -1; // Offset of the token in its line, -1 for tokens that were not read from the source
+        numeric_value number{.integer = 0}; // Converted while tokenizing, the compiler does not parse it again
     };
 
+    /*
+     * Table driven lexer
+     * - Characters are classified with a 256 entry lookup table
+     * - Keywords are recognized with a perfect hash over their length, first and last characters
+     * - Every token is a view of the source, nothing is copied while tokenizing
+     */
     struct lexer {
         token lastToken{"", NotSet, NotSet, -1};
         int line = 0;
-        reader::reader *codeReader;
+        size_t lineStart = 0; // Position where the current line begins
+        std::string_view source;
+        size_t position = 0;
         bool complete = false;
 
-        explicit lexer(reader::reader *codeReader);
+        // Any reader with a view of its source, see reader.h
+        template<typename Reader>
+        explicit lexer(Reader *codeReader) : source(codeReader->view()) {
+        }
 
         bool hasNext() const;
 
-        static void guessKind(const std::string &pattern, uint8_t *kind, uint8_t *directValue);
+        static void guessKind(std::string_view pattern, uint8_t *kind, uint8_t *directValue);
 
-        bool tokenizeStringLikeExpressions(char stringOpener, std::string *content, uint8_t *kind, uint8_t *directValue,
+        bool tokenizeStringLikeExpressions(char stringOpener, uint8_t *kind, uint8_t *directValue,
                                            error::error *result_error);
 
-        bool tokenizeHexadecimal(char letterX, std::string *content, uint8_t *kind, uint8_t *directValue,
-                                 error::error *result_error) const;
+        bool tokenizeHexadecimal(uint8_t *kind, uint8_t *directValue, error::error *result_error);
 
-        bool tokenizeBinary(char letterB, std::string *content, uint8_t *kind, uint8_t *directValue,
-                            error::error *result_error) const;
+        bool tokenizeBinary(uint8_t *kind, uint8_t *directValue, error::error *result_error);
+
+        bool tokenizeOctal(uint8_t *kind, uint8_t *directValue, error::error *result_error);
 
-        bool tokenizeOctal(char letterO, std::string *content, uint8_t *kind, uint8_t *directValue,
-                           error::error *result_error) const;
+        bool tokenizeScientificFloat(uint8_t *kind, uint8_t *directValue, error::error *result_error);
 
-        bool tokenizeScientificFloat(std::string base, std::string *content, uint8_t *kind, uint8_t *directValue,
-                                     error::error *result_error) const;
+        bool tokenizeFloat(uint8_t *kind, uint8_t *directValue, error::error *result_error);
 
-        bool tokenizeFloat(std::string base, std::string *content, uint8_t *kind, uint8_t *directValue,
-                           error::error *result_error) const;
+        bool tokenizeInteger(uint8_t *kind, uint8_t *directValue, error::error *result_error);
 
-        bool tokenizeInteger(std::string base, std::string *content, uint8_t *kind, uint8_t *directValue,
-                             error::error *result_error) const;
+        bool tokenizeNumeric(char firstDigit, uint8_t *kind, uint8_t *directValue, error::error *result_error);
 
-        bool tokenizeNumeric(char firstDigit, std::string *content, uint8_t *kind, uint8_t *directValue,
-                             error::error *result_error) const;
+        bool convertNumeric(std::string_view literal, uint8_t directValue, numeric_value *number,
+                            error::error *result_error) const;
 
-        bool tokenizeChars(char startingChar, std::string *content, uint8_t *kind, uint8_t *directValue,
-                           error::error *result_error);
+        bool tokenizeChars(size_t start, uint8_t *kind, uint8_t *directValue, error::error *result_error);
 
-        bool
-        tokenizeComment(std::string *content, uint8_t *kind, uint8_t *directValue, error::error *result_error) const;
+        bool tokenizeComment(uint8_t *kind, uint8_t *directValue, error::error *result_error);
 
         bool tokenizeRepeatableOperator(char op,
                                         uint8_t directValueWhenSingle, uint8_t kindWhenSingle,
                                         uint8_t directValueWhenDouble, uint8_t kindWhenDouble,
                                         uint8_t directValueWhenSingleAssign, uint8_t kindWhenSingleAssign,
                                         uint8_t directValueWhenDoubleAssign, uint8_t kindWhenDoubleAssign,
-                                        std::string *content, uint8_t *kind, uint8_t *directValue,
-                                        error::error *result_error) const;
+                                        uint8_t *kind, uint8_t *directValue,
+                                        error::error *result_error);
 
-        bool tokenizeNotRepeatableOperator(char op,
-                                           uint8_t directValueWhenOperator, uint8_t kindWhenOperator,
+        bool tokenizeNotRepeatableOperator(uint8_t directValueWhenOperator, uint8_t kindWhenOperator,
                                            uint8_t directValueWhenAssign, uint8_t kindWhenAssign,
-                                           std::string *content, uint8_t *kind, uint8_t *directValue,
-                                           error::error *result_error) const;
+                                           uint8_t *kind, uint8_t *directValue,
+                                           error::error *result_error);
 
         bool _next(token *result, error::error *result_error);
 
         bool next(token *result, error::error *result_error);
 
         bool lastTokenIsSet() const;
+
+        [[nodiscard]] bool sourceHasNext() const {
+            return this->position < this->source.size();
+        }
+
+        [[nodiscard]] char currentChar() const {
+            return this->source[this->position];
+        }
     };
 }
 
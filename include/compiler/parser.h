@@ -3,6 +3,7 @@
 
 #include <string>
 #include <any>
+#include <vector>
 
 #include "plasma_error.h"
 #include "compiler/ast.h"
@@ -72,6 +73,13 @@ namespace plasma::parser {
     struct parser {
         lexer::lexer *Lexer;
         lexer::token currentToken;
+        // Owns every node of the parsed programs, they live as long as the parser
+        ast::arena Arena;
+        // Errors found while parsing, in the order they were found
+        std::vector<error::error> Errors;
+        // Set after a lexing error, the rest of the source can not be tokenized
+        bool abandoned = false;
+        bool started = false;
 
         explicit parser(lexer::lexer *lexer_);
 
@@ -87,6 +95,18 @@ namespace plasma::parser {
 
         void removeNewLines();
 
+        /*
+         * Error recovery
+         * - A statement with a syntax error is recorded in Errors and skipped, parsing goes on after it
+         * - Statements are skipped up to the next separator, or up to the end that closes their block
+         */
+        void parseStatement(ast::node_list<ast::Node *> *body);
+
+        void recover(const error::error &syntaxError, const lexer::lexer &statementLexer,
+                     const lexer::token &statementStart);
+
+        void skipStatement();
+
         /*
          * Statements
          */
@@ -167,8 +187,17 @@ namespace plasma::parser {
 
         /*
          * Parse to a Program Object
+         * - Syntax errors do not stop it, check Errors, the statements with errors are left out
          */
         ast::Program *parse();
+
+        /*
+         * Parse the script one top level statement at a time
+         * - BEGIN and END blocks are returned as statements too
+         * - Returns nullptr when the script is over
+         * - Statements with syntax errors are skipped like in parse
+         */
+        ast::Node *parseTopLevelStatement();
     };
 }
 #endif //PLASMA_PARSER_H
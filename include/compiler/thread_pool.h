@@ -0,0 +1,48 @@
+#ifndef PLASMA_THREAD_POOL_H
+#define PLASMA_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace plasma::bytecode_compiler {
+    /*
+     * Threads kept alive between compilations
+     * - run shares one piece of work between the calling thread and some of the threads of the pool
+     * - The work must split itself, every thread that joins calls it once and it returns when nothing is left
+     */
+    class thread_pool {
+    public:
+        explicit thread_pool(unsigned int threads);
+
+        thread_pool(const thread_pool &) = delete;
+
+        thread_pool &operator=(const thread_pool &) = delete;
+
+        ~thread_pool();
+
+        /*
+         * Call work in the calling thread and in up to helpers threads of the pool
+         * - Returns once every call made by the pool returned, helpers that did not start by then are skipped
+         * - Exceptions thrown by work in the pool are thrown again here, once every call returned
+         */
+        void run(unsigned int helpers, const std::function<void()> &work);
+
+        // Pool of the process with one thread per core, made on first use
+        static thread_pool &shared();
+
+    private:
+        std::mutex mutex;
+        std::condition_variable available;
+        std::deque<std::function<void()>> tasks;
+        std::vector<std::thread> threads;
+        bool stopping = false;
+
+        void loop();
+    };
+}
+
+#endif //PLASMA_THREAD_POOL_H
@@ -1,41 +1,57 @@
 #ifndef PLASMA_READER_H
 #define PLASMA_READER_H
 
+#include <cstddef>
 #include <string>
-#include <fstream>
-#include <utility>
+#include <string_view>
 
 namespace plasma::reader {
-    struct reader {
-        virtual void next() = 0;
-
-        virtual void redo() = 0;
+    /*
+     * Readers hold the source of a script for the lexer
+     * - They are concrete types, the lexer takes the view of any of them and scans it without virtual calls
+     * - Tokens point into the source, so the reader must outlive the tokens and the AST built from them
+     */
+
+    // Source kept in a string
+    struct string_reader {
+        std::string content;
 
-        virtual bool hasNext() = 0;
+        [[nodiscard]] std::string_view view() const {
+            return this->content;
+        }
+    };
 
-        virtual int index() = 0;
+    void string_reader_new(string_reader *s_reader, std::string string);
 
-        virtual char currentChar() = 0;
-    };
+    // Reads the whole file with a single read, fails when the file can not be opened or read
+    bool string_reader_new_from_file(string_reader *s_reader, const std::string &filePath);
 
-    struct string_reader : reader {
-        std::string content;
-        int currentIndex;
+    // Source file mapped into memory, the pages are loaded by the operating system as the lexer touches them
+    struct file_reader {
+        const char *data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        void *file = nullptr;
+        void *mapping = nullptr;
+#else
+        int file = -1;
+#endif
 
-        void next() override;
+        file_reader() = default;
 
-        void redo() override;
+        file_reader(const file_reader &) = delete;
 
-        bool hasNext() override;
+        file_reader &operator=(const file_reader &) = delete;
 
-        int index() override;
+        ~file_reader();
 
-        char currentChar() override;
+        [[nodiscard]] std::string_view view() const {
+            return {this->data, this->size};
+        }
     };
 
-    void string_reader_new(string_reader *s_reader, std::string string);
-
-    bool string_reader_new_from_file(string_reader *s_reader, const std::string &filePath);
+    // Fails when the file can not be opened or mapped, empty files are valid
+    bool file_reader_new(file_reader *f_reader, const std::string &filePath);
 }
 
 #endif //PLASMA_READER_H
@@ -1,20 +1,35 @@
 #ifndef PLASMA_TOOLS_H
 #define PLASMA_TOOLS_H
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <bitset>
 #include <sstream>
 
 namespace plasma::general_tooling {
-    std::string replace_escaped(const std::string &string);
+    // Content of a string or bytes literal with its quotes, the escape sequences are decoded
+    std::string replace_escaped(std::string_view string);
 
-    std::string remove_integer_definition(std::string string);
+    /*
+     * Numbers written like the literals of the language, _ can separate the digits after the first one
+     * - Integers are decimal or have a 0x, 0b or 0o prefix, they fail when they do not fit in 64 bits
+     * - Floats need a fraction, an exponent with its sign or both
+     */
+    int64_t parse_integer(std::string_view string, bool *success);
 
-    std::string remove_floor(std::string string);
+    double parse_float(std::string_view string, bool *success);
 
-    int64_t parse_integer(const std::string &string, bool *success);
+    const size_t NotFound = SIZE_MAX;
 
-    double parse_float(const std::string &string, bool *success);
+    /*
+     * Index of the first occurrence of needle in haystack or NotFound
+     * Uses AVX2 when the CPU supports it, SSE2 on other x86-64 processors and memchr elsewhere
+     */
+    size_t search(const uint8_t *haystack, size_t haystackLength, const uint8_t *needle, size_t needleLength);
+
+    // Whether both the CPU and the operating system support AVX2, always false outside x86-64
+    bool supports_avx2();
 }
 
 #endif //PLASMA_TOOLS_H
@@ -0,0 +1,88 @@
+#ifndef PLASMA_IMMUTABLE_BYTES_H
+#define PLASMA_IMMUTABLE_BYTES_H
+
+#include <cinttypes>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace plasma::vm {
+    /*
+     * Content of Bytes objects, never modified after construction
+     * - The bytes live in a reference counted buffer, copies and slices are views over it
+     * - The hash is cached with the view, so it travels with every copy
+     */
+    class immutable_bytes {
+    public:
+        immutable_bytes() = default;
+
+        immutable_bytes(const std::vector<uint8_t> &bytes);
+
+        immutable_bytes(std::vector<uint8_t> &&bytes);
+
+        explicit immutable_bytes(std::string_view bytes);
+
+        [[nodiscard]] const uint8_t *data() const {
+            if (this->buffer == nullptr) {
+                return nullptr;
+            }
+            return this->buffer->data() + this->offset;
+        }
+
+        [[nodiscard]] size_t size() const {
+            return this->length;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->length == 0;
+        }
+
+        [[nodiscard]] const uint8_t *begin() const {
+            return this->data();
+        }
+
+        [[nodiscard]] const uint8_t *end() const {
+            return this->data() + this->length;
+        }
+
+        uint8_t operator[](size_t index) const {
+            return this->data()[index];
+        }
+
+        [[nodiscard]] std::span<const uint8_t> span() const {
+            return {this->data(), this->length};
+        }
+
+        // Bytes between start and start + count, sharing the buffer
+        [[nodiscard]] immutable_bytes slice(size_t start, size_t count) const;
+
+        // Zero means not calculated yet
+        [[nodiscard]] int64_t cached_hash() const {
+            return this->hash;
+        }
+
+        void cache_hash(int64_t hash_) const {
+            this->hash = hash_;
+        }
+
+        // Heap memory owned by these bytes, shared buffers count for each of their owners
+        [[nodiscard]] size_t memory_usage() const;
+
+        // Heap memory of the buffer split between the bytes sharing it, summed over all of them it is counted once
+        [[nodiscard]] size_t shared_memory_usage() const;
+
+        friend bool operator==(const immutable_bytes &left, const immutable_bytes &right);
+
+    private:
+        std::shared_ptr<const std::vector<uint8_t>> buffer;
+        size_t offset = 0;
+        size_t length = 0;
+        mutable int64_t hash = 0;
+    };
+
+    bool operator==(const immutable_bytes &left, const immutable_bytes &right);
+}
+
+#endif //PLASMA_IMMUTABLE_BYTES_H
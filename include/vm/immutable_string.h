@@ -0,0 +1,169 @@
+#ifndef PLASMA_IMMUTABLE_STRING_H
+#define PLASMA_IMMUTABLE_STRING_H
+
+#include <atomic>
+#include <cinttypes>
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace plasma::vm {
+    /*
+     * Text of String objects, never modified after construction
+     * - Up to InlineCapacity characters are stored inline
+     * - Longer text lives in a reference counted buffer, copies and big substrings share it
+     * - Buffers never move their characters, concatenating onto the string that ends the committed text of a buffer
+     *   appends in place while the buffer has room, whoever else shares it
+     * - The hash is cached with the text, so it travels with every copy
+     */
+    class immutable_string {
+    public:
+        static constexpr size_t InlineCapacity = 15;
+
+        immutable_string() {
+            this->inlineCharacters[0] = '\0';
+        }
+
+        immutable_string(const char *string) : immutable_string(std::string_view(string)) {
+        }
+
+        immutable_string(std::string_view string);
+
+        immutable_string(const std::string &string) : immutable_string(std::string_view(string)) {
+        }
+
+        // Takes the characters of long strings without copying them
+        immutable_string(std::string &&string);
+
+        [[nodiscard]] const char *data() const {
+            if (this->buffer == nullptr) {
+                return this->inlineCharacters;
+            }
+            return this->buffer->characters.data() + this->offset;
+        }
+
+        [[nodiscard]] size_t size() const {
+            return this->length;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->length == 0;
+        }
+
+        [[nodiscard]] const char *begin() const {
+            return this->data();
+        }
+
+        [[nodiscard]] const char *end() const {
+            return this->data() + this->length;
+        }
+
+        char operator[](size_t index) const {
+            return this->data()[index];
+        }
+
+        [[nodiscard]] std::string_view view() const {
+            return {this->data(), this->length};
+        }
+
+        operator std::string_view() const {
+            return this->view();
+        }
+
+        [[nodiscard]] std::string str() const {
+            return std::string(this->data(), this->length);
+        }
+
+        /*
+         * Characters between start and start + count
+         * Shares the buffer unless the piece is small compared with it
+         */
+        [[nodiscard]] immutable_string substring(size_t start, size_t count) const;
+
+        /*
+         * Text of left followed by right
+         * O(right.size()) amortized when left ends the committed text of its buffer, a full copy otherwise
+         * - Copies reserve room for more text, so repeated concatenations onto the result append in place
+         */
+        static immutable_string concatenate(const immutable_string &left, std::string_view right);
+
+        // Zero means not calculated yet
+        [[nodiscard]] int64_t cached_hash() const {
+            return this->hash;
+        }
+
+        void cache_hash(int64_t hash_) const {
+            this->hash = hash_;
+        }
+
+        // Heap memory owned by this string, shared buffers count for each of their owners
+        [[nodiscard]] size_t memory_usage() const;
+
+        // Heap memory of the buffer split between the strings sharing it, summed over all of them it is counted once
+        [[nodiscard]] size_t shared_memory_usage() const;
+
+        friend bool operator==(const immutable_string &left, const immutable_string &right) {
+            if (left.hash != 0 && right.hash != 0 && left.hash != right.hash) {
+                return false;
+            }
+            return left.view() == right.view();
+        }
+
+        friend bool operator==(const immutable_string &left, std::string_view right) {
+            return left.view() == right;
+        }
+
+        friend bool operator==(const immutable_string &left, const std::string &right) {
+            return left.view() == right;
+        }
+
+        friend bool operator==(const immutable_string &left, const char *right) {
+            return left.view() == right;
+        }
+
+        friend std::string operator+(std::string_view left, const immutable_string &right) {
+            std::string result;
+            result.reserve(left.size() + right.length);
+            result.append(left);
+            result.append(right.view());
+            return result;
+        }
+
+        friend std::string operator+(const immutable_string &left, std::string_view right) {
+            std::string result;
+            result.reserve(left.length + right.size());
+            result.append(left.view());
+            result.append(right);
+            return result;
+        }
+
+        friend std::ostream &operator<<(std::ostream &output, const immutable_string &string) {
+            return output << string.view();
+        }
+
+    private:
+        /*
+         * Characters of long strings, allocated with their final capacity so they never move
+         * - Only the first committed characters are in use, strings sharing the buffer never read past them
+         * - Appending claims the room after the committed characters atomically, one string wins it
+         */
+        struct shared_buffer {
+            std::string characters; // Its size is the capacity of the buffer
+            std::atomic<size_t> committed;
+
+            shared_buffer(std::string &&characters_, size_t committed_) :
+                    characters(std::move(characters_)), committed(committed_) {
+            }
+        };
+
+        std::shared_ptr<shared_buffer> buffer;
+        size_t offset = 0;
+        size_t length = 0;
+        char inlineCharacters[InlineCapacity + 1];
+        mutable int64_t hash = 0;
+    };
+}
+
+#endif //PLASMA_IMMUTABLE_STRING_H
@@ -0,0 +1,169 @@
+#ifndef PLASMA_KEY_VALUE_TABLE_H
+#define PLASMA_KEY_VALUE_TABLE_H
+
+#include <bit>
+#include <cinttypes>
+#include <cstddef>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PLASMA_KEY_VALUE_TABLE_SSE2
+
+#include <emmintrin.h>
+
+#endif
+
+namespace plasma::vm {
+    struct value;
+
+    struct key_value {
+        int64_t hash; // Cached so lookups and rehashing never call Hash again
+        value *key;
+        value *value;
+    };
+
+    /*
+     * Open addressing hash table used by the HashTable type
+     * - Entries are stored inline and in insertion order, iteration walks them directly
+     * - Slots are probed in groups of GroupWidth control bytes, each one holding 7 bits of the hash
+     * - Only entries with the same full hash are compared with Equals
+     * - Entries are never removed, so the table has no tombstones
+     */
+    class key_value_table {
+    public:
+        static constexpr size_t GroupWidth = 16;
+
+        key_value_table() = default;
+
+        /*
+         * Look for the entry of a key, matches(entryKey, &equals) compare the candidates with the same hash
+         * - Returns nullptr on success, result points to the entry or is nullptr when the key is not present
+         * - Returns the comparison error when fails
+         * - matches may run user code that changes this table, the probe starts again when it did
+         */
+        template<typename Matcher>
+        value *find(int64_t hash, Matcher &&matches, key_value **result) {
+            (*result) = nullptr;
+            if (this->entries.empty()) {
+                return nullptr;
+            }
+            size_t modificationsBefore = this->modifications;
+            uint64_t mixed = mix(hash);
+            int8_t tag = control_tag(mixed);
+            size_t groupMask = (this->control.size() / GroupWidth) - 1;
+            size_t group = (mixed >> 7) & groupMask;
+            for (size_t step = 1;; step++) {
+                const int8_t *controlGroup = &this->control[group * GroupWidth];
+                for (uint32_t candidates = match_group(controlGroup, tag); candidates != 0;
+                     candidates &= candidates - 1) {
+                    uint32_t entryIndex = this->slots[group * GroupWidth + std::countr_zero(candidates)];
+                    if (this->entries[entryIndex].hash != hash) {
+                        continue;
+                    }
+                    // Only indexes and copies are kept while matches runs, the table may be resized by it
+                    value *candidate = this->entries[entryIndex].key;
+                    bool equals = false;
+                    value *comparisonError = matches(candidate, &equals);
+                    if (comparisonError != nullptr) {
+                        return comparisonError;
+                    }
+                    if (this->modifications != modificationsBefore) {
+                        // Entries keep their index unless the table was cleared
+                        if (equals && entryIndex < this->entries.size() &&
+                            this->entries[entryIndex].key == candidate) {
+                            (*result) = &this->entries[entryIndex];
+                            return nullptr;
+                        }
+                        return this->find(hash, matches, result);
+                    }
+                    if (equals) {
+                        (*result) = &this->entries[entryIndex];
+                        return nullptr;
+                    }
+                }
+                if (match_group(controlGroup, Empty) != 0) {
+                    return nullptr;
+                }
+                group = (group + step) & groupMask;
+            }
+        }
+
+        /*
+         * Append a new entry, the caller should first check with find that the key is not present
+         */
+        key_value *insert(int64_t hash, value *key, value *v);
+
+        void reserve(size_t numberOfEntries);
+
+        void clear();
+
+        [[nodiscard]] size_t size() const {
+            return this->entries.size();
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->entries.empty();
+        }
+
+        [[nodiscard]] size_t memory_usage() const;
+
+        [[nodiscard]] std::vector<key_value>::const_iterator begin() const {
+            return this->entries.begin();
+        }
+
+        [[nodiscard]] std::vector<key_value>::const_iterator end() const {
+            return this->entries.end();
+        }
+
+        std::vector<key_value>::iterator begin() {
+            return this->entries.begin();
+        }
+
+        std::vector<key_value>::iterator end() {
+            return this->entries.end();
+        }
+
+    private:
+        static constexpr int8_t Empty = -128;
+
+        std::vector<key_value> entries;
+        std::vector<int8_t> control; // Empty or the 7 bit tag of the entry in the slot
+        std::vector<uint32_t> slots; // Entry index of each slot
+        size_t modifications = 0; // Changes of the buffers, lets find notice the ones made while comparing keys
+
+        // Spread user provided hashes over all the bits, integers hash to themselves
+        static uint64_t mix(int64_t hash) {
+            auto mixed = (uint64_t) hash;
+            mixed ^= mixed >> 33;
+            mixed *= 0xFF51AFD7ED558CCDull;
+            mixed ^= mixed >> 33;
+            return mixed;
+        }
+
+        static int8_t control_tag(uint64_t mixed) {
+            return (int8_t) (mixed >> 57);
+        }
+
+        // Bit mask of the control bytes of the group equal to tag
+        static uint32_t match_group(const int8_t *group, int8_t tag) {
+#ifdef PLASMA_KEY_VALUE_TABLE_SSE2
+            __m128i controlBytes = _mm_loadu_si128((const __m128i *) group);
+            return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(controlBytes, _mm_set1_epi8(tag)));
+#else
+            uint32_t result = 0;
+            for (size_t index = 0; index < GroupWidth; index++) {
+                if (group[index] == tag) {
+                    result |= 1u << index;
+                }
+            }
+            return result;
+#endif
+        }
+
+        void place(uint64_t mixed, uint32_t entryIndex);
+
+        void rehash(size_t capacity);
+    };
+}
+
+#endif //PLASMA_KEY_VALUE_TABLE_H
@@ -0,0 +1,47 @@
+#ifndef PLASMA_LINE_TABLE_H
+#define PLASMA_LINE_TABLE_H
+
+#include <cinttypes>
+#include <cstddef>
+#include <vector>
+
+namespace plasma::vm {
+    /*
+     * Source positions of the instructions of a code object
+     * - Only the instructions where the position changes get an entry, the ones after it share its position
+     * - An entry is three varints with the deltas to the previous entry: instruction index, line and column,
+     *   line and column deltas are zigzag encoded since they can go backwards
+     * - Lookups decode from the start, they are only needed by errors and the allocation sampler
+     */
+    class line_table {
+    public:
+        line_table() = default;
+
+        // Positions the instruction at index and the ones after it, index never goes backwards
+        void add(size_t index, size_t line, size_t column);
+
+        // Position of the instruction at index, false when no instruction up to it carried one
+        bool find(size_t index, size_t *line, size_t *column) const;
+
+        // Adds the entries of other as if its instructions started at offset
+        void append(const line_table &other, size_t offset);
+
+        // Entries of the instructions in [start, end), moved to start at index 0
+        [[nodiscard]] line_table slice(size_t start, size_t end) const;
+
+        [[nodiscard]] bool empty() const {
+            return this->entries.empty();
+        }
+
+    private:
+        std::vector<uint8_t> entries;
+        size_t lastIndex = 0;
+        size_t lastLine = 0;
+        size_t lastColumn = 0;
+
+        template<typename Visitor>
+        void decode(Visitor &&visit) const;
+    };
+}
+
+#endif //PLASMA_LINE_TABLE_H
@@ -0,0 +1,137 @@
+#ifndef PLASMA_SHARED_CONTENT_H
+#define PLASMA_SHARED_CONTENT_H
+
+#include <bit>
+#include <cinttypes>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace plasma::vm {
+    struct value;
+
+    // How the elements of a shared_content are stored, every kind but GenericContent is packed
+    enum content_kind : uint8_t {
+        GenericContent, // Pointers to values
+        IntegerContent, // The integers themselves
+        FloatContent, // The bits of the floats
+        BooleanContent, // 0 or 1
+    };
+
+    /*
+     * Elements of Arrays and Tuples
+     * - The elements live in a reference counted buffer, copies and slices are views over it
+     * - Writing through a view whose buffer is shared first copies the viewed range (copy-on-write)
+     * - Only the viewed range is marked by the garbage collector, the rest of the buffer is never read by this view
+     * - Numbers and booleans can be packed in 64 bit slots instead of values, only Arrays use packed content
+     */
+    class shared_content {
+    public:
+        shared_content() = default;
+
+        shared_content(const std::vector<value *> &elements);
+
+        shared_content(std::vector<value *> &&elements);
+
+        // Packed content, elements are already encoded for the kind
+        shared_content(content_kind kind, std::vector<int64_t> &&elements);
+
+        [[nodiscard]] content_kind kind() const {
+            return this->kind_;
+        }
+
+        [[nodiscard]] bool packed() const {
+            return this->kind_ != GenericContent;
+        }
+
+        // True when other views hold the same buffer
+        [[nodiscard]] bool shared() const {
+            return this->objects.use_count() > 1 || this->packedElements.use_count() > 1;
+        }
+
+        [[nodiscard]] size_t size() const {
+            return this->length;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return this->length == 0;
+        }
+
+        // Element access of generic content
+
+        [[nodiscard]] value *const *data() const {
+            if (this->objects == nullptr) {
+                return nullptr;
+            }
+            return this->objects->data() + this->offset;
+        }
+
+        [[nodiscard]] value *const *begin() const {
+            return this->data();
+        }
+
+        [[nodiscard]] value *const *end() const {
+            return this->data() + this->length;
+        }
+
+        value *operator[](size_t index) const {
+            return this->data()[index];
+        }
+
+        [[nodiscard]] std::span<value *const> span() const {
+            return {this->data(), this->length};
+        }
+
+        // Element access of packed content
+
+        [[nodiscard]] const int64_t *packed_data() const {
+            if (this->packedElements == nullptr) {
+                return nullptr;
+            }
+            return this->packedElements->data() + this->offset;
+        }
+
+        [[nodiscard]] int64_t integer(size_t index) const {
+            return this->packed_data()[index];
+        }
+
+        [[nodiscard]] double floating(size_t index) const {
+            return std::bit_cast<double>(this->packed_data()[index]);
+        }
+
+        [[nodiscard]] bool boolean(size_t index) const {
+            return this->packed_data()[index] != 0;
+        }
+
+        static int64_t pack_float(double floating) {
+            return std::bit_cast<int64_t>(floating);
+        }
+
+        // Elements between start and start + count, sharing the buffer
+        [[nodiscard]] shared_content slice(size_t start, size_t count) const;
+
+        // Elements in the opposite order, in a new buffer
+        [[nodiscard]] shared_content reversed() const;
+
+        // Replace an element, the viewed range is copied first when other views share the buffer
+        void set(size_t index, value *element);
+
+        void set_packed(size_t index, int64_t element);
+
+        // Heap memory owned by this content, shared buffers count for each of their owners
+        [[nodiscard]] size_t memory_usage() const;
+
+        // Heap memory of the buffers split between the contents sharing them, summed over all of them it is counted once
+        [[nodiscard]] size_t shared_memory_usage() const;
+
+    private:
+        content_kind kind_ = GenericContent;
+        std::shared_ptr<std::vector<value *>> objects;
+        std::shared_ptr<std::vector<int64_t>> packedElements;
+        size_t offset = 0;
+        size_t length = 0;
+    };
+}
+
+#endif //PLASMA_SHARED_CONTENT_H
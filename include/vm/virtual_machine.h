@@ -13,9 +13,16 @@
 #include <stack>
 #include <iostream>
 #include <deque>
+#include <span>
+#include <exception>
 
 #include "plasma_error.h"
 #include "memory.h"
+#include "key_value_table.h"
+#include "line_table.h"
+#include "immutable_string.h"
+#include "immutable_bytes.h"
+#include "shared_content.h"
 
 using defer = std::shared_ptr<void>;
 
@@ -27,6 +34,31 @@ namespace plasma::vm {
         Break,
         Continue,
         Redo,
+        Failure,
+    };
+
+    // Frame kinds
+    enum {
+        ExecutionFrame,
+        FunctionFrame,
+        ConditionFrame,
+        OneLinerFrame,
+        ModuleFrame,
+        ForLoopFrame,
+        WhileLoopFrame,
+        UntilLoopFrame,
+        DoWhileLoopFrame,
+        TryFrame,
+    };
+
+    // Frame phases
+    enum {
+        BodyPhase,
+        ConditionPhase,
+        ExceptTargetsPhase,
+        ExceptBodyPhase,
+        ElsePhase,
+        FinallyPhase,
     };
 
     // OP Codes
@@ -109,14 +141,66 @@ namespace plasma::vm {
     typedef std::function<struct value *(struct context *, value *)> constructor_callback;
     // typedef struct value *(*constructor_callback)(context *c, struct value *);
 
+    /*
+     * Arguments of a call in call order, a view over storage owned by the caller (never the value stack itself)
+     */
+    typedef std::span<struct value *const> arguments_span;
+
     /*
      * - Returns the result when success
      * - Returns an error object when fails
      */
-    typedef std::function<struct value *(struct value *, const std::vector<struct value *> &,
-                                         bool *)> function_callback;
-    // typedef struct value *(*function_callback)(struct value *self, std::vector<struct value *> arguments,
-    //                                            bool *success);
+    typedef std::function<struct value *(struct value *, arguments_span, bool *)> function_callback;
+    // typedef struct value *(*function_callback)(struct value *self, arguments_span arguments, bool *success);
+
+    /*
+     * Built-in method without captured state, the same function is shared by every object of a type
+     * - Returns the result when success
+     * - Returns an error object when fails
+     */
+    typedef struct value *(*native_function)(struct context *c, struct virtual_machine *vm, struct value *self,
+                                             arguments_span arguments, bool *success);
+
+    struct native_method {
+        size_t numberOfArguments;
+        native_function function;
+    };
+
+    // Methods of a built-in type by symbol, built once and shared by all its objects
+    typedef std::unordered_map<std::string, native_method> native_registry;
+
+    native_registry inherit_methods(const native_registry &base, const native_registry &methods);
+
+    const native_registry &object_methods();
+
+    const native_registry &type_methods();
+
+    const native_registry &callable_methods();
+
+    const native_registry &integer_methods();
+
+    const native_registry &float_methods();
+
+    const native_registry &bool_methods();
+
+    const native_registry &none_methods();
+
+    const native_registry &string_methods();
+
+    const native_registry &bytes_methods();
+
+    const native_registry &array_methods();
+
+    const native_registry &tuple_methods();
+
+    const native_registry &hash_table_methods();
+
+    const native_registry &iterator_methods();
+
+    const native_registry &runtime_error_methods();
+
+    // Type, message and line:column of an error object, the text shown for errors nobody caught
+    std::string error_report(const struct value *error);
 
     // Types
     const char TypeName[] = "Type";
@@ -218,6 +302,18 @@ namespace plasma::vm {
     const char SetFloat[] = "SetFloat";
     const char SetContent[] = "SetContent";
     const char SetKeyValues[] = "SetKeyValues";
+    // Array bulk operations
+    const char Sum[] = "Sum";
+    const char Min[] = "Min";
+    const char Max[] = "Max";
+    const char Dot[] = "Dot";
+    const char AddEach[] = "AddEach";
+    const char SubEach[] = "SubEach";
+    const char MulEach[] = "MulEach";
+    const char Fill[] = "Fill";
+    const char EqualsMask[] = "EqualsMask";
+    const char LessThanMask[] = "LessThanMask";
+    const char GreaterThanMask[] = "GreaterThanMask";
     // Built-In errors names
     const char RuntimeError[] = "RuntimeError";
     const char InvalidTypeError[] = "InvalidTypeError";
@@ -232,6 +328,9 @@ namespace plasma::vm {
     const char FloatParsingError[] = "FloatParsingError";
     const char BuiltInSymbolProtectionError[] = "BuiltInSymbolProtectionError";
     const char ObjectNotCallableError[] = "ObjectNotCallableError";
+    const char MemoryError[] = "MemoryError";
+    const char RecursionError[] = "RecursionError";
+    const char ValueError[] = "ValueError";
     // Type identifier
     enum {
         Array,
@@ -269,35 +368,52 @@ namespace plasma::vm {
     struct instruction {
         uint8_t op_code;
         std::any value;
-        size_t line;
+    };
+
+    /*
+     * Instructions of a code object, their source positions live apart in a line table
+     */
+    struct instruction_list : std::vector<instruction> {
+        line_table lines;
+
+        // The next instruction pushed and the ones after it come from line and column
+        void set_position(size_t line, size_t column);
+
+        // Concatenates the instructions of other with their positions
+        void append(const instruction_list &other);
+
+        void append(instruction_list &&other);
+
+        // Instructions in [start, end) with their positions
+        [[nodiscard]] instruction_list slice(size_t start, size_t end) const;
     };
 
     struct except_block {
         std::string captureName;
-        std::vector<instruction> targets;
-        std::vector<instruction> body;
+        instruction_list targets;
+        instruction_list body;
     };
 
     struct try_information {
-        std::vector<instruction> body;
+        instruction_list body;
         std::vector<except_block> exceptBlocks;
-        std::vector<instruction> elseBody;
-        std::vector<instruction> finally;
+        instruction_list elseBody;
+        instruction_list finally;
     };
 
     struct loop_information {
-        std::vector<instruction> body;
-        std::vector<instruction> condition;
+        instruction_list body;
+        instruction_list condition;
         std::vector<std::string> receivers;
     };
 
     struct condition_information {
-        std::vector<instruction> body;
-        std::vector<instruction> elseBody;
+        instruction_list body;
+        instruction_list elseBody;
     };
 
     struct bytecode {
-        std::vector<instruction> instructions;
+        instruction_list instructions;
         size_t index = 0;
 
         size_t length() const;
@@ -308,7 +424,7 @@ namespace plasma::vm {
 
         instruction next();
 
-        std::vector<instruction> nextN(size_t n);
+        instruction_list nextN(size_t n);
 
         void jump(size_t offset);
 
@@ -337,27 +453,25 @@ namespace plasma::vm {
         ~symbol_table();
     };
 
-    struct key_value {
-        value *key;
-        value *value;
-    };
-
     struct callable {
         bool isBuiltIn; // When is built-in the callback should be executed, if not, the code will be pushed to be executed
         size_t numberOfArguments;
-        std::vector<instruction> code;
+        instruction_list code;
         function_callback callback;
+        native_function native = nullptr; // Preferred over callback when set
     };
 
     callable new_builtin_callable(size_t number_of_arguments, function_callback callback);
 
-    callable new_plasma_callable(size_t number_of_arguments, std::vector<instruction> code);
+    callable new_native_callable(size_t number_of_arguments, native_function function);
+
+    callable new_plasma_callable(size_t number_of_arguments, instruction_list code);
 
 
     struct constructor {
         bool isBuiltIn;
         constructor_callback callback;
-        std::vector<instruction> code;
+        instruction_list code;
 
         /*
          * Construct the object approaching it's initializer
@@ -367,7 +481,7 @@ namespace plasma::vm {
         value *construct(context *c, virtual_machine *vm, value *self) const;
     };
 
-    constructor new_plasma_constructor(const std::vector<instruction> &code);
+    constructor new_plasma_constructor(const instruction_list &code);
 
     struct value {
         // Garbage collector
@@ -391,19 +505,23 @@ namespace plasma::vm {
         std::string typeName;
         value *type;
         std::vector<value *> subTypes;
-        int64_t hash = 0; // Used by strings, integers and floats to cache the hash
+        int64_t hash = 0; // Used by objects to cache the hash, strings and bytes cache it in their content
         // Values
-        std::string string;
-        std::vector<uint8_t> bytes;
-        std::vector<value *> content;
-        std::unordered_map<int64_t, std::vector<key_value>> keyValues;
+        immutable_string string;
+        immutable_bytes bytes;
+        shared_content content;
+        key_value_table keyValues;
         bool boolean = false;
         double floating = 0;
         int64_t integer = 0;
         size_t iterIndex = 0;
+        // Position of the instruction that made a runtime error, -1 when it is unknown
+        int errorLine = -1;
+        int errorColumn = -1;
         // Symbols
         symbol_table *symbols;
         std::unordered_map<std::string, on_demand_loader> onDemandSymbols;
+        const native_registry *nativeMethods = nullptr; // Built-in methods, materialized on first access
 
         //
         void set_on_demand_symbol(const std::string &symbol, const on_demand_loader &loader);
@@ -432,22 +550,137 @@ namespace plasma::vm {
     };
 
 
+    struct heap_statistics {
+        // Garbage collector
+        uint64_t collections = 0;
+        uint64_t symbolTableCollections = 0;
+        uint64_t lastMarkNanoseconds = 0;
+        uint64_t lastSweepNanoseconds = 0;
+        uint64_t totalMarkNanoseconds = 0;
+        uint64_t totalSweepNanoseconds = 0;
+        uint64_t collectedValues = 0;
+        uint64_t collectedSymbolTables = 0;
+        // Allocations
+        uint64_t allocatedValues = 0;
+        uint64_t allocatedSymbolTables = 0;
+        // Allocation-site sampler, records the source line of every N allocation (0 disables it)
+        uint64_t samplingInterval = 0;
+        std::unordered_map<size_t, uint64_t> allocationSites;
+    };
+
+    /*
+     * Memory knobs of a context, sizes are measured in bytes of heap slots (values and symbol tables)
+     * - maximumHeapSize also counts the buffers of the strings, bytes, arrays, tuples and hashes of the values
+     */
+    struct heap_configuration {
+        size_t initialPageLength = 1; // Slots of the first page of each heap
+        double growthFactor = 2; // A new page is the biggest page multiplied by this factor
+        size_t collectionThreshold = 0; // Bytes allocated since the last collection that force a new one (0 disables it)
+        // Once reached the allocation raises a MemoryError (0 means unlimited), the MemoryError is built in the
+        // reserve past this size (context::memory_reserve_size). When the reserve is full too the script stops with a
+        // MemoryError no except catches
+        size_t maximumHeapSize = 0;
+        size_t nurserySize = 0; // Minimum number of fresh slots added every time a heap grows
+    };
+
+    // Maximum number of plasma function frames alive at the same time
+    const size_t DefaultRecursionLimit = 10000;
+    // Maximum number of nested interpreter loops, each one consumes native stack
+    const size_t DefaultNativeRecursionLimit = 200;
+
+    /*
+     * Activation record of the interpreter, blocks (function bodies, loops, conditions, try blocks and modules)
+     * are pushed here instead of being executed by a recursive call to execute
+     */
+    struct frame {
+        uint8_t kind = ExecutionFrame;
+        uint8_t phase = BodyPhase;
+        bool nativeEntry = false; // Leaving this frame returns the control to the C++ caller
+        bool ownsSymbolTable = false;
+        const instruction_list *code = nullptr;
+        size_t index = 0;
+        size_t end = 0;
+        // Function frames
+        value *function = nullptr;
+        value *constructed = nullptr; // Returned instead of the result when the call constructed an object
+        // Module frames
+        value *module = nullptr;
+        const class_information *moduleInformation = nullptr;
+        // Loop frames
+        const loop_information *loopInformation = nullptr;
+        value *source = nullptr;
+        value *hasNext = nullptr;
+        value *next = nullptr;
+        value *nextValue = nullptr;
+        // Try frames
+        const try_information *tryInformation = nullptr;
+        size_t exceptIndex = 0;
+        value *error = nullptr;
+        uint8_t pendingState = NoState; // State waiting for the finally block to finish
+        value *pendingObject = nullptr;
+
+        [[nodiscard]] bool has_next() const;
+
+        const instruction &fetch();
+
+        instruction_list nextN(size_t n);
+
+        void start(uint8_t newPhase, const instruction_list *newCode);
+    };
+
+    // Thrown by the allocators once the heap reserve is spent, the interpreter loop turns it into the fatal MemoryError
+    struct memory_reserve_exhausted : std::exception {
+        [[nodiscard]] const char *what() const noexcept override {
+            return "memory reserve exhausted";
+        }
+    };
+
     struct context {
-        uint8_t lastState = NoState;
         std::deque<value *> objectsInUse;
         value *lastObject = nullptr;
 
         memory::memory<symbol_table> symbol_table_heap;
         memory::memory<value> value_heap;
+        heap_configuration configuration;
+        heap_statistics statistics;
+        size_t bytesSinceCollection = 0;
+        bool memoryExhausted = false; // Set when an allocation went over maximumHeapSize
+        // Buffers of the live values as of the last collection plus the ones made since then
+        size_t payloadBytes = 0;
+        size_t payloadBytesSinceCollection = 0;
+        bool overMemoryLimit = false; // The heap went past maximumHeapSize and its MemoryError was raised
+        // Set once the reserve is spent, from then on every allocation throws memory_reserve_exhausted and the
+        // scripts run by this context fail with fatalMemoryError
+        bool memoryFatal = false;
+        value *fatalMemoryError = nullptr; // Built by initialize_context when there is a maximumHeapSize
 
         std::vector<value *> value_stack;
         std::vector<symbol_table *> symbol_table_stack;
+        std::deque<frame> frames;
+        size_t callDepth = 0;
+        size_t nativeDepth = 0;
+        size_t recursionLimit = DefaultRecursionLimit;
+        size_t nativeRecursionLimit = DefaultNativeRecursionLimit;
         symbol_table *master = nullptr;
 
         explicit context(size_t initialPageLength);
 
+        explicit context(const heap_configuration &heapConfiguration);
+
         ~context();
 
+        // Bytes of the heap slots and of the buffers of the values
+        size_t heap_size() const;
+
+        // Bytes the heap may use past maximumHeapSize, the heap never goes further
+        size_t memory_reserve_size() const;
+
+        // Count the buffers of a new value, the limit is checked by the next allocation
+        void charge_payload(size_t bytes);
+
+        // Source position of the instruction being executed, false when no instruction up to it carried one
+        bool source_position(size_t *line, size_t *column) const;
+
         value *allocate_value();
 
         symbol_table *allocate_symbol_table(symbol_table *parentSymbolTable);
@@ -468,11 +701,26 @@ namespace plasma::vm {
 
         symbol_table *peek_symbol_table();
 
+        void push_frame(const frame &f);
+
+        frame &peek_frame();
+
+        void pop_frame();
+
         void protect_value(value *v);
 
         void restore_protected_state(size_t state);
 
         size_t protected_values_state() const;
+
+        // Heap introspection
+
+        void set_allocation_sampling(uint64_t interval);
+
+        /*
+         * Dump live objects by type, heap pages, GC cycles and allocation sites as a JSON document
+         */
+        std::string heap_statistics_json();
     };
 
     struct virtual_machine {
@@ -509,23 +757,41 @@ namespace plasma::vm {
          * - Returns the result on success
          * - Returns an error object when fails
          */
-        struct value *call_function(context *c, struct value *function,
-                                    const std::vector<struct value *> &arguments, bool *success);
+        struct value *call_function(context *c, struct value *function, arguments_span arguments, bool *success);
+
+        /*
+         * Resolve the function executed when calling the object (Initialize for types, Call for objects)
+         * and check the number of arguments, constructedObject is set when a type was called
+         * - Returns the function on success
+         * - Returns an error object when fails
+         */
+        struct value *resolve_callable(context *c, struct value *function, size_t numberOfArguments,
+                                       struct value **constructedObject, bool *success);
+
+        struct value *call_builtin(context *c, struct value *callFunction, struct value *constructedObject,
+                                   arguments_span arguments, bool *success);
+
+        /*
+         * Push the frame of a plasma function, its arguments are expected on the value stack with the first on top
+         * - Returns nullptr on success
+         * - Returns an error object when fails
+         */
+        struct value *enter_function(context *c, struct value *callFunction, struct value *constructedObject);
 
         // Object Creators
         struct value *new_object(context *c, bool isBuiltIn, const std::string &typeName, value *type);
 
         struct value *new_hash_table(context *c, bool isBuiltIn);
 
-        struct value *new_array(context *c, bool isBuiltIn, const std::vector<struct value *> &content);
+        struct value *new_array(context *c, bool isBuiltIn, shared_content content);
 
         struct value *new_function(context *c, bool isBuiltIn, value *self, const struct callable &callable_);
 
-        struct value *new_bytes(context *c, bool isBuiltIn, const std::vector<uint8_t> &bytes);
+        struct value *new_bytes(context *c, bool isBuiltIn, immutable_bytes bytes);
 
         struct value *new_iterator(context *c, bool isBuiltIn);
 
-        struct value *new_tuple(context *c, bool isBuiltIn, const std::vector<struct value *> &content);
+        struct value *new_tuple(context *c, bool isBuiltIn, shared_content content);
 
         struct value *new_none(context *c, bool isBuiltIn);
 
@@ -542,7 +808,7 @@ namespace plasma::vm {
 
         value *new_integer(context *c, bool isBuiltIn, int64_t value_);
 
-        value *new_string(context *c, bool isBuiltIn, const std::string &value_);
+        value *new_string(context *c, bool isBuiltIn, immutable_string value_);
 
         // Error Creators
         value *NewFloatParsingError(context *c);
@@ -576,6 +842,12 @@ namespace plasma::vm {
 
         struct value *new_object_not_callable_error(context *c, struct value *objectType);
 
+        value *new_memory_error(context *c);
+
+        value *new_recursion_error(context *c, size_t limit);
+
+        value *new_value_error(context *c, const std::string &message);
+
         // Basic object caching
         struct value *get_none(context *c);
 
@@ -612,6 +884,12 @@ namespace plasma::vm {
 
         constructor_callback object_not_callable_error_initialize(bool isBuiltIn);
 
+        constructor_callback memory_error_initialize(bool isBuiltIn);
+
+        constructor_callback recursion_error_initialize(bool isBuiltIn);
+
+        constructor_callback value_error_initialize(bool isBuiltIn);
+
 
         constructor_callback callable_initialize(bool isBuiltIn);
 
@@ -654,6 +932,22 @@ namespace plasma::vm {
 
         value *execute(context *c, bytecode *bc, bool *success);
 
+        /*
+         * Interpreter loop, runs the frame stack until the native entry frame on its top is left
+         * - When the heap reserve is spent every frame up to the native entry is left without running except,
+         *   else or finally blocks and the result is the fatal MemoryError of the context
+         */
+        value *run(context *c, bool *success);
+
+        value *interpret(context *c, bool *success);
+
+        /*
+         * Propagate a block state through the frame stack until a frame handles it,
+         * NoState means that the top frame ran out of instructions
+         * - Returns true when a native entry frame was left, result and success then hold its outcome
+         */
+        bool unwind(context *c, uint8_t state, value *object, value **result, bool *success);
+
         // Tools
         //// Content (Arrays and Tuples) related
 
@@ -669,9 +963,18 @@ namespace plasma::vm {
 
         value *content_contains(context *c, value *container, value *object, bool *result);
 
+        // The copies stay protected, callers restore the protected state once the new container holds them
         value *
-        content_repeat(context *c, const std::vector<struct value *> &content, size_t times,
-                       std::vector<struct value *> *result);
+        content_repeat(context *c, const shared_content &content, size_t times, shared_content *result);
+
+        // Element at index, packed elements are materialized as new values
+        value *content_element(context *c, const shared_content &content, size_t index);
+
+        // Generic copy of packed content, the new values stay protected like in content_repeat
+        shared_content materialize_content(context *c, const shared_content &content);
+
+        // Packed copy of new generic content when all its elements are Integers, Floats or Bools
+        static shared_content pack_content(const shared_content &content);
 
         //// Bytes
 
@@ -705,6 +1008,13 @@ namespace plasma::vm {
 
         //// HashTable
 
+        /*
+         * Find the entry of key in the hash table, hash receives the hash of the key
+         * - Returns nullptr on success, entry is nullptr when the key is not present
+         * - Returns an error object when the hash calculation or a comparison fails
+         */
+        value *hashtable_find(context *c, value *source, value *key, int64_t *hash, key_value **entry);
+
         value *hashtable_index(context *c, value *source, value *key, bool *success);
 
         value *hashtable_assign(context *c, value *source, value *key, value *object, bool *success);
@@ -723,11 +1033,19 @@ namespace plasma::vm {
 
         //// Hashing
 
+        /*
+         * Fold the hash of one more element into the hash of a composite key
+         * hash_array(values) is the same as starting from seed ^ values.size() and combining each value in order
+         */
+        int64_t hash_combine(int64_t state, int64_t element) const;
+
         int64_t hash_array(const std::vector<int64_t> &values);
 
-        int64_t hash_string(const std::string &string);
+        int64_t hash_string(std::string_view string);
+
+        int64_t hash_bytes(std::span<const uint8_t> bytes);
 
-        int64_t hash_bytes(const std::vector<uint8_t> &bytes);
+        int64_t hash_float(double floating);
 
         //// Any
         static size_t calculate_index(int64_t index, size_t length, bool *fail);
@@ -750,42 +1068,51 @@ namespace plasma::vm {
 
         value *new_hash_op(context *c, size_t numberOfElements);
 
-        value *new_string_op(context *c, const std::string &string);
+        value *new_string_op(context *c, const immutable_string &string);
 
-        value *new_bytes_op(context *c, const std::string &bytes);
+        value *new_bytes_op(context *c, const immutable_bytes &bytes);
 
         value *new_integer_op(context *c, int64_t integer);
 
         value *new_float_op(context *c, double floating);
 
-        value *new_function_op(context *c, bytecode *bc, const function_information &functionInformation);
+        value *new_function_op(context *c, frame *f, const function_information &functionInformation);
 
-        value *new_module_op(context *c, bytecode *bc, const class_information &moduleInformation);
+        value *new_module_op(context *c, frame *f, const class_information &moduleInformation);
 
-        value *new_class_op(context *c, bytecode *bc, const class_information &classInformation);
+        value *new_class_op(context *c, frame *f, const class_information &classInformation);
 
-        value *new_class_function_op(context *c, bytecode *bc, const function_information &functionInformation);
+        value *new_class_function_op(context *c, frame *f, const function_information &functionInformation);
 
-        value *new_lambda_function_op(context *c, bytecode *bc,
+        value *new_lambda_function_op(context *c, frame *f,
                                       const function_information &functionInformation);
 
-        value *new_generator_op(context *c, bytecode *bc,
+        value *new_generator_op(context *c, frame *f,
                                 const generator_information &generatorInformation);
 
         //// Loop setup and operation
 
-        value *for_loop_op(context *c, loop_information loopInformation);
+        value *for_loop_op(context *c, const loop_information &loopInformation);
 
-        value *while_loop_op(context *c, loop_information loopInformation);
+        value *while_loop_op(context *c, const loop_information &loopInformation);
 
-        value *do_while_loop_op(context *c, loop_information loopInformation);
+        value *do_while_loop_op(context *c, const loop_information &loopInformation);
 
-        value *until_loop_op(context *c, loop_information loopInformation);
+        value *until_loop_op(context *c, const loop_information &loopInformation);
+
+        /*
+         * Request the next element of the loop source and schedule the body, finished is set when it is exhausted
+         */
+        value *for_loop_step(context *c, frame *loopFrame, bool *finished);
+
+        value *for_loop_receive(context *c, frame *loopFrame);
 
 
         //// Try blocks
         value *execute_try_block(context *c, const try_information &tryBlockInformation);
 
+        value *try_match_except(context *c, frame *tryFrame, value *targets, bool *matched);
+
         value *raise_op(context *c);
 
         //// Conditions (if, unless and switch)
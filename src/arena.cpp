@@ -0,0 +1,65 @@
+#include <cstdint>
+#include <cstdlib>
+
+#include "compiler/arena.h"
+
+plasma::ast::arena::~arena() {
+    this->release();
+}
+
+void plasma::ast::arena::release() {
+    while (this->last != nullptr) {
+        block *previous = this->last->previous;
+        std::free(this->last);
+        this->last = previous;
+    }
+    this->position = nullptr;
+    this->end = nullptr;
+    this->nextBlockSize = FirstBlockSize;
+    this->reserved = 0;
+}
+
+void plasma::ast::arena::reset() {
+    block *newest = this->last;
+    if (newest == nullptr) {
+        return;
+    }
+    size_t nextBlockSize = this->nextBlockSize;
+    this->last = newest->previous;
+    this->release();
+    newest->previous = nullptr;
+    this->last = newest;
+    this->position = (std::byte *) (newest + 1);
+    this->end = (std::byte *) newest + newest->size;
+    this->nextBlockSize = nextBlockSize;
+    this->reserved = newest->size;
+}
+
+void *plasma::ast::arena::do_allocate(size_t bytes, size_t alignment) {
+    auto address = (uintptr_t) this->position;
+    uintptr_t aligned = (address + alignment - 1) & ~(uintptr_t) (alignment - 1);
+    if (this->position == nullptr || aligned + bytes > (uintptr_t) this->end) {
+        // Requests bigger than the next block get a block of their own
+        size_t size = sizeof(block) + alignment + bytes;
+        if (size < this->nextBlockSize) {
+            size = this->nextBlockSize;
+            if (this->nextBlockSize < MaxBlockSize) {
+                this->nextBlockSize *= 2;
+            }
+        }
+        auto newBlock = (block *) std::malloc(size);
+        if (newBlock == nullptr) {
+            throw std::bad_alloc();
+        }
+        newBlock->previous = this->last;
+        newBlock->size = size;
+        this->last = newBlock;
+        this->reserved += size;
+        this->position = (std::byte *) (newBlock + 1);
+        this->end = (std::byte *) newBlock + size;
+        address = (uintptr_t) this->position;
+        aligned = (address + alignment - 1) & ~(uintptr_t) (alignment - 1);
+    }
+    this->position = (std::byte *) (aligned + bytes);
+    return (void *) aligned;
+}
@@ -1,469 +1,1105 @@
 #include <algorithm>
+#include <bit>
+#include <cmath>
+
 #include "vm/virtual_machine.h"
+#include "tools.h"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define PLASMA_ARRAY_X86
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::array_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-
-        object->set_on_demand_symbol(
-                Add,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Array) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    right->get_type(c, this),
-                                                    std::vector<std::string>{ArrayName}
-                                            );
-                                        }
-                                        std::vector<value *> result;
-                                        result.reserve(self->content.size() + right->content.size());
-                                        result.insert(result.end(), self->content.begin(), self->content.end());
-                                        result.insert(result.end(), right->content.begin(), right->content.end());
-
-                                        (*success) = true;
-                                        return this->new_array(c, false, result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightAdd,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Array) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    left->get_type(c, this),
-                                                    std::vector<std::string>{ArrayName}
-                                            );
-                                        }
-                                        std::vector<value *> result;
-                                        result.reserve(left->content.size() + self->content.size());
-                                        result.insert(result.end(), left->content.begin(), left->content.end());
-                                        result.insert(result.end(), self->content.begin(), self->content.end());
-
-                                        (*success) = true;
-                                        return this->new_array(c, false, result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Mul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Integer) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    right->get_type(c, this),
-                                                    std::vector<std::string>{IntegerName}
-                                            );
-                                        }
-                                        std::vector<value *> repeatedContent;
-                                        value *multiplicationError = this->content_repeat(c, self->content,
-                                                                                          std::abs(right->integer),
-                                                                                          &repeatedContent);
-                                        if (multiplicationError != nullptr) {
-                                            (*success) = false;
-                                            return multiplicationError;
-                                        }
-                                        if (right->integer < 0) {
-                                            std::reverse(repeatedContent.begin(), repeatedContent.end());
-                                        }
-                                        (*success) = true;
-                                        return this->new_array(c, false, repeatedContent);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightMul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Integer) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    left->get_type(c, this),
-                                                    std::vector<std::string>{IntegerName}
-                                            );
-                                        }
-                                        std::vector<value *> repeatedContent;
-                                        value *multiplicationError = this->content_repeat(c, self->content,
-                                                                                          std::abs(left->integer),
-                                                                                          &repeatedContent);
-                                        if (multiplicationError != nullptr) {
-                                            (*success) = false;
-                                            return multiplicationError;
-                                        }
-                                        if (left->integer < 0) {
-                                            std::reverse(repeatedContent.begin(), repeatedContent.end());
-                                        }
-                                        (*success) = true;
-                                        return this->new_array(c, false, repeatedContent);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Array) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = this->content_equals(c, self, right, &comparison);
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Array) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = this->content_equals(c, left, self, &comparison);
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Array) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = this->content_equals(c, self, right, &comparison);
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Array) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = this->content_equals(c, left, self, &comparison);
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Contains,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        bool contains = false;
-                                        value *containsError = this->content_contains(c, self, right, &contains);
-                                        if (containsError != nullptr) {
-                                            (*success) = false;
-                                            return containsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, contains);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = false;
-                                        return this->new_unhashable_type_error(c, self->get_type(c, this));
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Copy,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        std::vector<value *> copy;
-                                        value *copyError = this->content_repeat(c, self->content, 1, &copy);
-                                        if (copyError != nullptr) {
-                                            (*success) = false;
-                                            return copyError;
-                                        }
-                                        (*success) = true;
-                                        return this->new_array(c, false, copy);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Index,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->content_index(c, arguments[0], self, success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Assign,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    2,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->content_assign(c, self, arguments[0], arguments[1], success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Iter,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->content_iterator(c, self);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-
-                                        return this->content_to_string(c, self, success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_boolean(c, !self->content.empty());
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToArray,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        std::vector<value *> copy;
-                                        value *copyError = this->content_repeat(c, self->content, 1, &copy);
-                                        if (copyError != nullptr) {
-                                            (*success) = false;
-                                            return copyError;
-                                        }
-                                        (*success) = true;
-                                        return this->new_array(c, false, copy);
-                                    }
-                            )
-                    );
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#define PLASMA_TARGET_AVX2
+#else
+#define PLASMA_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+/*
+ * Kernels of the bulk methods over packed Integer and Float content
+ * - Every kernel has a portable version that also handles the tails of the vector ones
+ * - x86-64 always has the SSE2 versions, the AVX2 ones are picked at runtime
+ * - Integers wrap around like the Integer operators, floats are summed in lanes so the rounding can differ
+ *   from adding them one by one
+ */
+
+enum element_operation : uint8_t {
+    AddElements,
+    SubElements,
+    MulElements,
+};
+
+enum element_comparison : uint8_t {
+    EqualsElements,
+    LessThanElements,
+    GreaterThanElements,
+};
+
+static double as_float(int64_t element) {
+    return std::bit_cast<double>(element);
+}
+
+static int64_t sum_integers_scalar(const int64_t *elements, size_t length) {
+    uint64_t result = 0;
+    for (size_t index = 0; index < length; index++) {
+        result += (uint64_t) elements[index];
+    }
+    return (int64_t) result;
+}
+
+static double sum_floats_scalar(const int64_t *elements, size_t length) {
+    double result = 0;
+    for (size_t index = 0; index < length; index++) {
+        result += as_float(elements[index]);
+    }
+    return result;
+}
+
+// Maximum when max is set, minimum otherwise, length is never zero
+static int64_t extreme_integer_scalar(const int64_t *elements, size_t length, bool max) {
+    int64_t result = elements[0];
+    for (size_t index = 1; index < length; index++) {
+        result = max ? std::max(result, elements[index]) : std::min(result, elements[index]);
+    }
+    return result;
+}
+
+// The first NaN wins, so every kernel returns the same value whatever the order they compare the elements
+static double extreme_pair(double left, double right, bool max) {
+    if (std::isnan(left) || std::isnan(right)) {
+        return std::isnan(left) ? left : right;
+    }
+    return max ? std::max(left, right) : std::min(left, right);
+}
+
+static double extreme_float_scalar(const int64_t *elements, size_t length, bool max) {
+    double result = as_float(elements[0]);
+    for (size_t index = 1; index < length; index++) {
+        result = extreme_pair(result, as_float(elements[index]), max);
+    }
+    return result;
+}
+
+static double dot_floats_scalar(const int64_t *left, const int64_t *right, size_t length) {
+    double result = 0;
+    for (size_t index = 0; index < length; index++) {
+        result += as_float(left[index]) * as_float(right[index]);
+    }
+    return result;
+}
+
+// A scalar right operand is a single element used for every position
+static void combine_integers_scalar(uint8_t operation, const int64_t *left, const int64_t *right, bool rightIsScalar,
+                                    int64_t *result, size_t length) {
+    for (size_t index = 0; index < length; index++) {
+        auto leftElement = (uint64_t) left[index];
+        auto rightElement = (uint64_t) right[rightIsScalar ? 0 : index];
+        switch (operation) {
+            case AddElements:
+                result[index] = (int64_t) (leftElement + rightElement);
+                break;
+            case SubElements:
+                result[index] = (int64_t) (leftElement - rightElement);
+                break;
+            default:
+                result[index] = (int64_t) (leftElement * rightElement);
+                break;
+        }
+    }
+}
+
+static void combine_floats_scalar(uint8_t operation, const int64_t *left, const int64_t *right, bool rightIsScalar,
+                                  int64_t *result, size_t length) {
+    for (size_t index = 0; index < length; index++) {
+        double leftElement = as_float(left[index]);
+        double rightElement = as_float(right[rightIsScalar ? 0 : index]);
+        switch (operation) {
+            case AddElements:
+                result[index] = std::bit_cast<int64_t>(leftElement + rightElement);
+                break;
+            case SubElements:
+                result[index] = std::bit_cast<int64_t>(leftElement - rightElement);
+                break;
+            default:
+                result[index] = std::bit_cast<int64_t>(leftElement * rightElement);
+                break;
+        }
+    }
+}
+
+// Results are packed Bools, 1 where the comparison holds and 0 elsewhere
+static void compare_integers_scalar(uint8_t comparison, const int64_t *elements, int64_t operand,
+                                    int64_t *result, size_t length) {
+    for (size_t index = 0; index < length; index++) {
+        switch (comparison) {
+            case EqualsElements:
+                result[index] = elements[index] == operand;
+                break;
+            case LessThanElements:
+                result[index] = elements[index] < operand;
+                break;
+            default:
+                result[index] = elements[index] > operand;
+                break;
+        }
+    }
+}
+
+static void compare_floats_scalar(uint8_t comparison, const int64_t *elements, double operand,
+                                  int64_t *result, size_t length) {
+    for (size_t index = 0; index < length; index++) {
+        switch (comparison) {
+            case EqualsElements:
+                result[index] = as_float(elements[index]) == operand;
+                break;
+            case LessThanElements:
+                result[index] = as_float(elements[index]) < operand;
+                break;
+            default:
+                result[index] = as_float(elements[index]) > operand;
+                break;
+        }
+    }
+}
+
+#ifdef PLASMA_ARRAY_X86
+
+// SSE2 has no 64 bit integer comparisons, those kernels stay scalar
+
+static int64_t sum_integers_sse2(const int64_t *elements, size_t length) {
+    __m128i total = _mm_setzero_si128();
+    size_t index = 0;
+    for (; index + 2 <= length; index += 2) {
+        total = _mm_add_epi64(total, _mm_loadu_si128((const __m128i *) (elements + index)));
+    }
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i *) lanes, total);
+    return (int64_t) ((uint64_t) lanes[0] + (uint64_t) lanes[1] +
+                      (uint64_t) sum_integers_scalar(elements + index, length - index));
+}
+
+static double sum_floats_sse2(const int64_t *elements, size_t length) {
+    __m128d total = _mm_setzero_pd();
+    size_t index = 0;
+    for (; index + 2 <= length; index += 2) {
+        total = _mm_add_pd(total, _mm_loadu_pd((const double *) (elements + index)));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, total);
+    return lanes[0] + lanes[1] + sum_floats_scalar(elements + index, length - index);
+}
+
+static double extreme_float_sse2(const int64_t *elements, size_t length, bool max) {
+    if (length < 2) {
+        return extreme_float_scalar(elements, length, max);
+    }
+    __m128d best = _mm_loadu_pd((const double *) elements);
+    // maxpd and minpd drop NaNs depending on the operand order, the scalar kernel picks the first one instead
+    __m128d unordered = _mm_cmpunord_pd(best, best);
+    size_t index = 2;
+    for (; index + 2 <= length; index += 2) {
+        __m128d block = _mm_loadu_pd((const double *) (elements + index));
+        unordered = _mm_or_pd(unordered, _mm_cmpunord_pd(block, block));
+        best = max ? _mm_max_pd(best, block) : _mm_min_pd(best, block);
+    }
+    if (_mm_movemask_pd(unordered) != 0) {
+        return extreme_float_scalar(elements, length, max);
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, best);
+    double result = extreme_pair(lanes[0], lanes[1], max);
+    if (index < length) {
+        result = extreme_pair(result, extreme_float_scalar(elements + index, length - index, max), max);
+    }
+    return result;
+}
+
+static double dot_floats_sse2(const int64_t *left, const int64_t *right, size_t length) {
+    __m128d total = _mm_setzero_pd();
+    size_t index = 0;
+    for (; index + 2 <= length; index += 2) {
+        total = _mm_add_pd(total, _mm_mul_pd(_mm_loadu_pd((const double *) (left + index)),
+                                             _mm_loadu_pd((const double *) (right + index))));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, total);
+    return lanes[0] + lanes[1] + dot_floats_scalar(left + index, right + index, length - index);
+}
+
+static void combine_integers_sse2(uint8_t operation, const int64_t *left, const int64_t *right, bool rightIsScalar,
+                                  int64_t *result, size_t length) {
+    size_t index = 0;
+    // SSE2 only multiplies 32 bit lanes
+    if (operation != MulElements) {
+        const __m128i scalar = _mm_set1_epi64x(right[0]);
+        for (; index + 2 <= length; index += 2) {
+            __m128i leftBlock = _mm_loadu_si128((const __m128i *) (left + index));
+            __m128i rightBlock = rightIsScalar ? scalar : _mm_loadu_si128((const __m128i *) (right + index));
+            _mm_storeu_si128((__m128i *) (result + index), operation == AddElements ?
+                                                            _mm_add_epi64(leftBlock, rightBlock) :
+                                                            _mm_sub_epi64(leftBlock, rightBlock));
+        }
+    }
+    combine_integers_scalar(operation, left + index, rightIsScalar ? right : right + index, rightIsScalar,
+                            result + index, length - index);
+}
+
+static void combine_floats_sse2(uint8_t operation, const int64_t *left, const int64_t *right, bool rightIsScalar,
+                                int64_t *result, size_t length) {
+    const __m128d scalar = _mm_set1_pd(as_float(right[0]));
+    size_t index = 0;
+    for (; index + 2 <= length; index += 2) {
+        __m128d leftBlock = _mm_loadu_pd((const double *) (left + index));
+        __m128d rightBlock = rightIsScalar ? scalar : _mm_loadu_pd((const double *) (right + index));
+        __m128d block;
+        switch (operation) {
+            case AddElements:
+                block = _mm_add_pd(leftBlock, rightBlock);
+                break;
+            case SubElements:
+                block = _mm_sub_pd(leftBlock, rightBlock);
+                break;
+            default:
+                block = _mm_mul_pd(leftBlock, rightBlock);
+                break;
+        }
+        _mm_storeu_pd((double *) (result + index), block);
+    }
+    combine_floats_scalar(operation, left + index, rightIsScalar ? right : right + index, rightIsScalar,
+                          result + index, length - index);
+}
+
+static void compare_floats_sse2(uint8_t comparison, const int64_t *elements, double operand,
+                                int64_t *result, size_t length) {
+    const __m128d scalar = _mm_set1_pd(operand);
+    const __m128i one = _mm_set1_epi64x(1);
+    size_t index = 0;
+    for (; index + 2 <= length; index += 2) {
+        __m128d block = _mm_loadu_pd((const double *) (elements + index));
+        __m128d mask;
+        switch (comparison) {
+            case EqualsElements:
+                mask = _mm_cmpeq_pd(block, scalar);
+                break;
+            case LessThanElements:
+                mask = _mm_cmplt_pd(block, scalar);
+                break;
+            default:
+                mask = _mm_cmpgt_pd(block, scalar);
+                break;
+        }
+        _mm_storeu_si128((__m128i *) (result + index), _mm_and_si128(_mm_castpd_si128(mask), one));
+    }
+    compare_floats_scalar(comparison, elements + index, operand, result + index, length - index);
+}
+
+PLASMA_TARGET_AVX2
+static int64_t sum_integers_avx2(const int64_t *elements, size_t length) {
+    __m256i total = _mm256_setzero_si256();
+    size_t index = 0;
+    for (; index + 4 <= length; index += 4) {
+        total = _mm256_add_epi64(total, _mm256_loadu_si256((const __m256i *) (elements + index)));
+    }
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *) lanes, total);
+    return (int64_t) ((uint64_t) lanes[0] + (uint64_t) lanes[1] + (uint64_t) lanes[2] + (uint64_t) lanes[3] +
+                      (uint64_t) sum_integers_scalar(elements + index, length - index));
+}
+
+PLASMA_TARGET_AVX2
+static double sum_floats_avx2(const int64_t *elements, size_t length) {
+    __m256d total = _mm256_setzero_pd();
+    size_t index = 0;
+    for (; index + 4 <= length; index += 4) {
+        total = _mm256_add_pd(total, _mm256_loadu_pd((const double *) (elements + index)));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, total);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) + sum_floats_scalar(elements + index, length - index);
+}
+
+PLASMA_TARGET_AVX2
+static int64_t extreme_integer_avx2(const int64_t *elements, size_t length, bool max) {
+    if (length < 4) {
+        return extreme_integer_scalar(elements, length, max);
+    }
+    __m256i best = _mm256_loadu_si256((const __m256i *) elements);
+    size_t index = 4;
+    for (; index + 4 <= length; index += 4) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) (elements + index));
+        __m256i better = max ? _mm256_cmpgt_epi64(block, best) : _mm256_cmpgt_epi64(best, block);
+        best = _mm256_blendv_epi8(best, block, better);
+    }
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *) lanes, best);
+    int64_t result = extreme_integer_scalar(lanes, 4, max);
+    if (index < length) {
+        int64_t rest = extreme_integer_scalar(elements + index, length - index, max);
+        result = max ? std::max(result, rest) : std::min(result, rest);
+    }
+    return result;
+}
+
+PLASMA_TARGET_AVX2
+static double extreme_float_avx2(const int64_t *elements, size_t length, bool max) {
+    if (length < 4) {
+        return extreme_float_scalar(elements, length, max);
+    }
+    __m256d best = _mm256_loadu_pd((const double *) elements);
+    __m256d unordered = _mm256_cmp_pd(best, best, _CMP_UNORD_Q);
+    size_t index = 4;
+    for (; index + 4 <= length; index += 4) {
+        __m256d block = _mm256_loadu_pd((const double *) (elements + index));
+        unordered = _mm256_or_pd(unordered, _mm256_cmp_pd(block, block, _CMP_UNORD_Q));
+        best = max ? _mm256_max_pd(best, block) : _mm256_min_pd(best, block);
+    }
+    if (_mm256_movemask_pd(unordered) != 0) {
+        return extreme_float_scalar(elements, length, max);
+    }
+    int64_t lanes[4];
+    _mm256_storeu_pd((double *) lanes, best);
+    double result = extreme_float_scalar(lanes, 4, max);
+    if (index < length) {
+        result = extreme_pair(result, extreme_float_scalar(elements + index, length - index, max), max);
+    }
+    return result;
+}
+
+PLASMA_TARGET_AVX2
+static double dot_floats_avx2(const int64_t *left, const int64_t *right, size_t length) {
+    __m256d total = _mm256_setzero_pd();
+    size_t index = 0;
+    for (; index + 4 <= length; index += 4) {
+        total = _mm256_add_pd(total, _mm256_mul_pd(_mm256_loadu_pd((const double *) (left + index)),
+                                                   _mm256_loadu_pd((const double *) (right + index))));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, total);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) +
+           dot_floats_scalar(left + index, right + index, length - index);
+}
+
+PLASMA_TARGET_AVX2
+static void combine_integers_avx2(uint8_t operation, const int64_t *left, const int64_t *right, bool rightIsScalar,
+                                  int64_t *result, size_t length) {
+    size_t index = 0;
+    // AVX2 only multiplies 32 bit lanes
+    if (operation != MulElements) {
+        const __m256i scalar = _mm256_set1_epi64x(right[0]);
+        for (; index + 4 <= length; index += 4) {
+            __m256i leftBlock = _mm256_loadu_si256((const __m256i *) (left + index));
+            __m256i rightBlock = rightIsScalar ? scalar : _mm256_loadu_si256((const __m256i *) (right + index));
+            _mm256_storeu_si256((__m256i *) (result + index), operation == AddElements ?
+                                                               _mm256_add_epi64(leftBlock, rightBlock) :
+                                                               _mm256_sub_epi64(leftBlock, rightBlock));
+        }
+    }
+    combine_integers_scalar(operation, left + index, rightIsScalar ? right : right + index, rightIsScalar,
+                            result + index, length - index);
+}
+
+PLASMA_TARGET_AVX2
+static void combine_floats_avx2(uint8_t operation, const int64_t *left, const int64_t *right, bool rightIsScalar,
+                                int64_t *result, size_t length) {
+    const __m256d scalar = _mm256_set1_pd(as_float(right[0]));
+    size_t index = 0;
+    for (; index + 4 <= length; index += 4) {
+        __m256d leftBlock = _mm256_loadu_pd((const double *) (left + index));
+        __m256d rightBlock = rightIsScalar ? scalar : _mm256_loadu_pd((const double *) (right + index));
+        __m256d block;
+        switch (operation) {
+            case AddElements:
+                block = _mm256_add_pd(leftBlock, rightBlock);
+                break;
+            case SubElements:
+                block = _mm256_sub_pd(leftBlock, rightBlock);
+                break;
+            default:
+                block = _mm256_mul_pd(leftBlock, rightBlock);
+                break;
+        }
+        _mm256_storeu_pd((double *) (result + index), block);
+    }
+    combine_floats_scalar(operation, left + index, rightIsScalar ? right : right + index, rightIsScalar,
+                          result + index, length - index);
+}
+
+PLASMA_TARGET_AVX2
+static void compare_integers_avx2(uint8_t comparison, const int64_t *elements, int64_t operand,
+                                  int64_t *result, size_t length) {
+    const __m256i scalar = _mm256_set1_epi64x(operand);
+    const __m256i one = _mm256_set1_epi64x(1);
+    size_t index = 0;
+    for (; index + 4 <= length; index += 4) {
+        __m256i block = _mm256_loadu_si256((const __m256i *) (elements + index));
+        __m256i mask;
+        switch (comparison) {
+            case EqualsElements:
+                mask = _mm256_cmpeq_epi64(block, scalar);
+                break;
+            case LessThanElements:
+                mask = _mm256_cmpgt_epi64(scalar, block);
+                break;
+            default:
+                mask = _mm256_cmpgt_epi64(block, scalar);
+                break;
+        }
+        _mm256_storeu_si256((__m256i *) (result + index), _mm256_and_si256(mask, one));
+    }
+    compare_integers_scalar(comparison, elements + index, operand, result + index, length - index);
+}
+
+PLASMA_TARGET_AVX2
+static void compare_floats_avx2(uint8_t comparison, const int64_t *elements, double operand,
+                                int64_t *result, size_t length) {
+    const __m256d scalar = _mm256_set1_pd(operand);
+    const __m256i one = _mm256_set1_epi64x(1);
+    size_t index = 0;
+    for (; index + 4 <= length; index += 4) {
+        __m256d block = _mm256_loadu_pd((const double *) (elements + index));
+        __m256d mask;
+        switch (comparison) {
+            case EqualsElements:
+                mask = _mm256_cmp_pd(block, scalar, _CMP_EQ_OQ);
+                break;
+            case LessThanElements:
+                mask = _mm256_cmp_pd(block, scalar, _CMP_LT_OQ);
+                break;
+            default:
+                mask = _mm256_cmp_pd(block, scalar, _CMP_GT_OQ);
+                break;
+        }
+        _mm256_storeu_si256((__m256i *) (result + index), _mm256_and_si256(_mm256_castpd_si256(mask), one));
+    }
+    compare_floats_scalar(comparison, elements + index, operand, result + index, length - index);
+}
+
+#endif
+
+struct array_kernels {
+    int64_t (*sum_integers)(const int64_t *, size_t);
+
+    double (*sum_floats)(const int64_t *, size_t);
+
+    int64_t (*extreme_integer)(const int64_t *, size_t, bool);
+
+    double (*extreme_float)(const int64_t *, size_t, bool);
+
+    double (*dot_floats)(const int64_t *, const int64_t *, size_t);
+
+    void (*combine_integers)(uint8_t, const int64_t *, const int64_t *, bool, int64_t *, size_t);
+
+    void (*combine_floats)(uint8_t, const int64_t *, const int64_t *, bool, int64_t *, size_t);
+
+    void (*compare_integers)(uint8_t, const int64_t *, int64_t, int64_t *, size_t);
+
+    void (*compare_floats)(uint8_t, const int64_t *, double, int64_t *, size_t);
+};
+
+static array_kernels select_kernels() {
+#ifdef PLASMA_ARRAY_X86
+    if (plasma::general_tooling::supports_avx2()) {
+        return array_kernels{
+                sum_integers_avx2,
+                sum_floats_avx2,
+                extreme_integer_avx2,
+                extreme_float_avx2,
+                dot_floats_avx2,
+                combine_integers_avx2,
+                combine_floats_avx2,
+                compare_integers_avx2,
+                compare_floats_avx2,
+        };
+    }
+    return array_kernels{
+            sum_integers_sse2,
+            sum_floats_sse2,
+            extreme_integer_scalar,
+            extreme_float_sse2,
+            dot_floats_sse2,
+            combine_integers_sse2,
+            combine_floats_sse2,
+            compare_integers_scalar,
+            compare_floats_sse2,
+    };
+#else
+    return array_kernels{
+            sum_integers_scalar,
+            sum_floats_scalar,
+            extreme_integer_scalar,
+            extreme_float_scalar,
+            dot_floats_scalar,
+            combine_integers_scalar,
+            combine_floats_scalar,
+            compare_integers_scalar,
+            compare_floats_scalar,
+    };
+#endif
+}
+
+static const array_kernels &kernels() {
+    static const array_kernels selected = select_kernels();
+    return selected;
+}
+
+namespace plasma::vm {
+    // Elements of left followed by the ones of right, packed when both have the same packed kind
+    static value *
+    concatenate(context *c, virtual_machine *vm, const shared_content &left, const shared_content &right) {
+        if (right.empty()) {
+            return vm->new_array(c, false, left);
+        }
+        if (left.empty()) {
+            return vm->new_array(c, false, right);
+        }
+        if (left.packed() && left.kind() == right.kind()) {
+            std::vector<int64_t> result;
+            result.reserve(left.size() + right.size());
+            result.insert(result.end(), left.packed_data(), left.packed_data() + left.size());
+            result.insert(result.end(), right.packed_data(), right.packed_data() + right.size());
+            return vm->new_array(c, false, shared_content(left.kind(), std::move(result)));
+        }
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content leftElements = vm->materialize_content(c, left);
+        shared_content rightElements = vm->materialize_content(c, right);
+        std::vector<value *> result;
+        result.reserve(left.size() + right.size());
+        result.insert(result.end(), leftElements.begin(), leftElements.end());
+        result.insert(result.end(), rightElements.begin(), rightElements.end());
+        return vm->new_array(c, false, std::move(result));
+    }
+
+    static value *array_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Array) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    right->get_type(c, vm),
+                    std::vector<std::string>{ArrayName}
+            );
+        }
+        (*success) = true;
+        return concatenate(c, vm, self->content, right->content);
+    }
+
+    static value *
+    array_right_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Array) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    left->get_type(c, vm),
+                    std::vector<std::string>{ArrayName}
+            );
+        }
+        (*success) = true;
+        return concatenate(c, vm, left->content, self->content);
+    }
+
+    static value *array_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Integer) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    right->get_type(c, vm),
+                    std::vector<std::string>{IntegerName}
+            );
+        }
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content repeatedContent;
+        value *multiplicationError = vm->content_repeat(c, self->content,
+                                                        std::abs(right->integer),
+                                                        &repeatedContent);
+        if (multiplicationError != nullptr) {
+            (*success) = false;
+            return multiplicationError;
+        }
+        if (right->integer < 0) {
+            repeatedContent = repeatedContent.reversed();
+        }
+        (*success) = true;
+        return vm->new_array(c, false, std::move(repeatedContent));
+    }
+
+    static value *
+    array_right_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Integer) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    left->get_type(c, vm),
+                    std::vector<std::string>{IntegerName}
+            );
+        }
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content repeatedContent;
+        value *multiplicationError = vm->content_repeat(c, self->content,
+                                                        std::abs(left->integer),
+                                                        &repeatedContent);
+        if (multiplicationError != nullptr) {
+            (*success) = false;
+            return multiplicationError;
+        }
+        if (left->integer < 0) {
+            repeatedContent = repeatedContent.reversed();
+        }
+        (*success) = true;
+        return vm->new_array(c, false, std::move(repeatedContent));
+    }
+
+    static value *array_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Array) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = vm->content_equals(c, self, right, &comparison);
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, comparison);
+    }
+
+    static value *
+    array_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Array) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = vm->content_equals(c, left, self, &comparison);
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, comparison);
+    }
+
+    static value *
+    array_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Array) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = vm->content_equals(c, self, right, &comparison);
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !comparison);
+    }
+
+    static value *
+    array_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Array) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = vm->content_equals(c, left, self, &comparison);
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !comparison);
+    }
+
+    static value *
+    array_contains(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        bool contains = false;
+        value *containsError = vm->content_contains(c, self, right, &contains);
+        if (containsError != nullptr) {
+            (*success) = false;
+            return containsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, contains);
+    }
+
+    static value *array_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = false;
+        return vm->new_unhashable_type_error(c, self->get_type(c, vm));
+    }
+
+    static value *array_copy(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content copy;
+        value *copyError = vm->content_repeat(c, self->content, 1, &copy);
+        if (copyError != nullptr) {
+            (*success) = false;
+            return copyError;
+        }
+        (*success) = true;
+        return vm->new_array(c, false, std::move(copy));
+    }
+
+    static value *array_index(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->content_index(c, arguments[0], self, success);
+    }
+
+    static value *array_assign(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->content_assign(c, self, arguments[0], arguments[1], success);
+    }
+
+    static value *array_iter(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->content_iterator(c, self);
+    }
+
+    static value *
+    array_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->content_to_string(c, self, success);
+    }
+
+    static value *array_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_boolean(c, !self->content.empty());
+    }
+
+    static value *
+    array_to_array(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content copy;
+        value *copyError = vm->content_repeat(c, self->content, 1, &copy);
+        if (copyError != nullptr) {
+            (*success) = false;
+            return copyError;
+        }
+        (*success) = true;
+        return vm->new_array(c, false, std::move(copy));
+    }
+
+    static value *
+    array_to_tuple(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content copy;
+        value *copyError = vm->content_repeat(c, self->content, 1, &copy);
+        if (copyError != nullptr) {
+            (*success) = false;
+            return copyError;
+        }
+        (*success) = true;
+        return vm->new_tuple(c, false, std::move(copy));
+    }
+
+    // Integers or Floats of an Array, Arrays mixing both are read as Floats
+    static value *numeric_content(context *c, virtual_machine *vm, value *array, shared_content *result) {
+        const shared_content &content = array->content;
+        if (content.kind() == IntegerContent || content.kind() == FloatContent) {
+            (*result) = content;
+            return nullptr;
+        }
+        if (content.kind() == BooleanContent) {
+            return vm->new_invalid_type_error(c, vm->get_boolean(c, true)->get_type(c, vm),
+                                              std::vector<std::string>{IntegerName, FloatName});
+        }
+        bool floats = false;
+        for (value *element : content) {
+            if (element->typeId == Float) {
+                floats = true;
+            } else if (element->typeId != Integer) {
+                return vm->new_invalid_type_error(c, element->get_type(c, vm),
+                                                  std::vector<std::string>{IntegerName, FloatName});
+            }
+        }
+        std::vector<int64_t> elements;
+        elements.reserve(content.size());
+        for (value *element : content) {
+            if (!floats) {
+                elements.push_back(element->integer);
+            } else if (element->typeId == Float) {
+                elements.push_back(shared_content::pack_float(element->floating));
+            } else {
+                elements.push_back(shared_content::pack_float((double) element->integer));
+            }
+        }
+        (*result) = shared_content(floats ? FloatContent : IntegerContent, std::move(elements));
+        return nullptr;
+    }
+
+    static shared_content float_content(const shared_content &numbers) {
+        if (numbers.kind() == FloatContent) {
+            return numbers;
+        }
+        std::vector<int64_t> elements(numbers.size());
+        for (size_t index = 0; index < numbers.size(); index++) {
+            elements[index] = shared_content::pack_float((double) numbers.integer(index));
+        }
+        return shared_content(FloatContent, std::move(elements));
+    }
+
+    // Integer and Float operands are used for every element, Arrays need the same length as self
+    static value *numeric_operand(context *c, virtual_machine *vm, value *operand, size_t length,
+                                  shared_content *result, bool *isScalar) {
+        (*isScalar) = true;
+        switch (operand->typeId) {
+            case Integer:
+                (*result) = shared_content(IntegerContent, std::vector<int64_t>{operand->integer});
+                return nullptr;
+            case Float:
+                (*result) = shared_content(FloatContent,
+                                           std::vector<int64_t>{shared_content::pack_float(operand->floating)});
+                return nullptr;
+            case Array: {
+                (*isScalar) = false;
+                value *conversionError = numeric_content(c, vm, operand, result);
+                if (conversionError != nullptr) {
+                    return conversionError;
                 }
-        );
-        object->set_on_demand_symbol(
-                ToTuple,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        std::vector<value *> copy;
-                                        value *copyError = this->content_repeat(c, self->content, 1, &copy);
-                                        if (copyError != nullptr) {
-                                            (*success) = false;
-                                            return copyError;
-                                        }
-                                        (*success) = true;
-                                        return this->new_tuple(c, false, copy);
-                                    }
-                            )
-                    );
+                if (result->size() != length) {
+                    return vm->new_value_error(c, "arrays of lengths " + std::to_string(length) + " and " +
+                                                  std::to_string(result->size()) + " do not match");
                 }
-        );
+                return nullptr;
+            }
+            default:
+                return vm->new_invalid_type_error(c, operand->get_type(c, vm),
+                                                  std::vector<std::string>{IntegerName, FloatName, ArrayName});
+        }
+    }
+
+    static value *combine_elements(context *c, virtual_machine *vm, value *self, value *operand, uint8_t operation,
+                                   bool *success) {
+        shared_content left;
+        shared_content right;
+        bool rightIsScalar;
+        value *operandError = numeric_content(c, vm, self, &left);
+        if (operandError == nullptr) {
+            operandError = numeric_operand(c, vm, operand, left.size(), &right, &rightIsScalar);
+        }
+        if (operandError != nullptr) {
+            (*success) = false;
+            return operandError;
+        }
+        (*success) = true;
+        if (left.empty()) {
+            return vm->new_array(c, false, std::vector<value *>());
+        }
+        std::vector<int64_t> result(left.size());
+        if (left.kind() == IntegerContent && right.kind() == IntegerContent) {
+            kernels().combine_integers(operation, left.packed_data(), right.packed_data(), rightIsScalar,
+                                       result.data(), result.size());
+            return vm->new_array(c, false, shared_content(IntegerContent, std::move(result)));
+        }
+        left = float_content(left);
+        right = float_content(right);
+        kernels().combine_floats(operation, left.packed_data(), right.packed_data(), rightIsScalar,
+                                 result.data(), result.size());
+        return vm->new_array(c, false, shared_content(FloatContent, std::move(result)));
+    }
+
+    static value *compare_elements(context *c, virtual_machine *vm, value *self, value *operand, uint8_t comparison,
+                                   bool *success) {
+        shared_content numbers;
+        value *conversionError = numeric_content(c, vm, self, &numbers);
+        if (conversionError != nullptr) {
+            (*success) = false;
+            return conversionError;
+        }
+        if (operand->typeId != Integer && operand->typeId != Float) {
+            (*success) = false;
+            return vm->new_invalid_type_error(c, operand->get_type(c, vm),
+                                              std::vector<std::string>{IntegerName, FloatName});
+        }
+        std::vector<int64_t> mask(numbers.size());
+        if (numbers.kind() == IntegerContent && operand->typeId == Integer) {
+            kernels().compare_integers(comparison, numbers.packed_data(), operand->integer, mask.data(), mask.size());
+        } else {
+            numbers = float_content(numbers);
+            double floatOperand = operand->typeId == Float ? operand->floating : (double) operand->integer;
+            kernels().compare_floats(comparison, numbers.packed_data(), floatOperand, mask.data(), mask.size());
+        }
+        (*success) = true;
+        return vm->new_array(c, false, shared_content(BooleanContent, std::move(mask)));
+    }
+
+    static value *array_sum(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        shared_content numbers;
+        value *conversionError = numeric_content(c, vm, self, &numbers);
+        if (conversionError != nullptr) {
+            (*success) = false;
+            return conversionError;
+        }
+        (*success) = true;
+        if (numbers.kind() == IntegerContent) {
+            return vm->new_integer(c, false, kernels().sum_integers(numbers.packed_data(), numbers.size()));
+        }
+        return vm->new_float(c, false, kernels().sum_floats(numbers.packed_data(), numbers.size()));
+    }
+
+    static value *array_extreme(context *c, virtual_machine *vm, value *self, bool max, bool *success) {
+        shared_content numbers;
+        value *conversionError = numeric_content(c, vm, self, &numbers);
+        if (conversionError != nullptr) {
+            (*success) = false;
+            return conversionError;
+        }
+        if (numbers.empty()) {
+            (*success) = false;
+            return vm->new_value_error(c, std::string(max ? Max : Min) + " of an empty array");
+        }
+        (*success) = true;
+        if (numbers.kind() == IntegerContent) {
+            return vm->new_integer(c, false, kernels().extreme_integer(numbers.packed_data(), numbers.size(), max));
+        }
+        return vm->new_float(c, false, kernels().extreme_float(numbers.packed_data(), numbers.size(), max));
+    }
+
+    static value *array_min(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return array_extreme(c, vm, self, false, success);
+    }
+
+    static value *array_max(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return array_extreme(c, vm, self, true, success);
+    }
+
+    static value *array_dot(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *other = arguments[0];
+        if (other->typeId != Array) {
+            (*success) = false;
+            return vm->new_invalid_type_error(c, other->get_type(c, vm), std::vector<std::string>{ArrayName});
+        }
+        shared_content left;
+        shared_content right;
+        bool rightIsScalar;
+        value *operandError = numeric_content(c, vm, self, &left);
+        if (operandError == nullptr) {
+            operandError = numeric_operand(c, vm, other, left.size(), &right, &rightIsScalar);
+        }
+        if (operandError != nullptr) {
+            (*success) = false;
+            return operandError;
+        }
+        (*success) = true;
+        if (left.kind() == IntegerContent && right.kind() == IntegerContent) {
+            // No 64 bit multiplication in SSE2 or AVX2
+            uint64_t result = 0;
+            for (size_t index = 0; index < left.size(); index++) {
+                result += (uint64_t) left.integer(index) * (uint64_t) right.integer(index);
+            }
+            return vm->new_integer(c, false, (int64_t) result);
+        }
+        left = float_content(left);
+        right = float_content(right);
+        return vm->new_float(c, false, kernels().dot_floats(left.packed_data(), right.packed_data(), left.size()));
+    }
+
+    static value *
+    array_add_each(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return combine_elements(c, vm, self, arguments[0], AddElements, success);
+    }
+
+    static value *
+    array_sub_each(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return combine_elements(c, vm, self, arguments[0], SubElements, success);
+    }
+
+    static value *
+    array_mul_each(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return combine_elements(c, vm, self, arguments[0], MulElements, success);
+    }
+
+    static value *array_fill(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *element = arguments[0];
+        size_t length = self->content.size();
+        switch (element->typeId) {
+            case Integer:
+                self->content = shared_content(IntegerContent, std::vector<int64_t>(length, element->integer));
+                break;
+            case Float:
+                self->content = shared_content(FloatContent, std::vector<int64_t>(
+                        length, shared_content::pack_float(element->floating)
+                ));
+                break;
+            case Boolean:
+                self->content = shared_content(BooleanContent, std::vector<int64_t>(length, element->boolean));
+                break;
+            default:
+                self->content = std::vector<value *>(length, element);
+                break;
+        }
+        (*success) = true;
+        return vm->get_none(c);
+    }
+
+    static value *
+    array_equals_mask(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return compare_elements(c, vm, self, arguments[0], EqualsElements, success);
+    }
+
+    static value *
+    array_less_than_mask(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return compare_elements(c, vm, self, arguments[0], LessThanElements, success);
+    }
+
+    static value *
+    array_greater_than_mask(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return compare_elements(c, vm, self, arguments[0], GreaterThanElements, success);
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::array_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Add, {1, array_add}},
+            {RightAdd, {1, array_right_add}},
+            {Mul, {1, array_mul}},
+            {RightMul, {1, array_right_mul}},
+            {Equals, {1, array_equals}},
+            {RightEquals, {1, array_right_equals}},
+            {NotEquals, {1, array_not_equals}},
+            {RightNotEquals, {1, array_right_not_equals}},
+            {Contains, {1, array_contains}},
+            {Hash, {0, array_hash}},
+            {Copy, {0, array_copy}},
+            {Index, {1, array_index}},
+            {Assign, {2, array_assign}},
+            {Iter, {0, array_iter}},
+            {ToString, {0, array_to_string}},
+            {ToBool, {0, array_to_bool}},
+            {ToArray, {0, array_to_array}},
+            {ToTuple, {0, array_to_tuple}},
+            {Sum, {0, array_sum}},
+            {Min, {0, array_min}},
+            {Max, {0, array_max}},
+            {Dot, {1, array_dot}},
+            {AddEach, {1, array_add_each}},
+            {SubEach, {1, array_sub_each}},
+            {MulEach, {1, array_mul_each}},
+            {Fill, {1, array_fill}},
+            {EqualsMask, {1, array_equals_mask}},
+            {LessThanMask, {1, array_less_than_mask}},
+            {GreaterThanMask, {1, array_greater_than_mask}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::array_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &array_methods();
+
         return nullptr;
     };
 }
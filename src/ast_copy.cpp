@@ -1,372 +1,427 @@
 #include "compiler/ast.h"
 
-plasma::ast::Node *plasma::ast::ArrayExpression::copy() {
-    std::vector<Expression *> newContent;
+plasma::ast::Node *plasma::ast::ArrayExpression::copy(arena *destination) {
+    node_list<Expression *> newContent(destination);
     newContent.reserve(this->Values.size());
     for (Expression *expression : this->Values) {
-        newContent.push_back(dynamic_cast<Expression *>(expression->copy()));
+        newContent.push_back(dynamic_cast<Expression *>(expression->copy(destination)));
     }
-    return new ArrayExpression(newContent);
+    return destination->make<ArrayExpression>(std::move(newContent));
 }
 
-plasma::ast::Node *plasma::ast::TupleExpression::copy() {
-    std::vector<Expression *> newContent;
+plasma::ast::Node *plasma::ast::TupleExpression::copy(arena *destination) {
+    node_list<Expression *> newContent(destination);
     newContent.reserve(this->Values.size());
     for (Expression *expression : this->Values) {
-        newContent.push_back(dynamic_cast<Expression *>(expression->copy()));
+        newContent.push_back(dynamic_cast<Expression *>(expression->copy(destination)));
     }
-    return new TupleExpression(newContent);
+    return destination->make<TupleExpression>(std::move(newContent));
 }
 
-plasma::ast::Node *plasma::ast::HashExpression::copy() {
-    std::vector<KeyValue *> newContent;
+plasma::ast::Node *plasma::ast::HashExpression::copy(arena *destination) {
+    node_list<KeyValue *> newContent(destination);
     newContent.reserve(this->KeyValues.size());
     for (KeyValue *keyValue : this->KeyValues) {
         newContent.push_back(
-                new KeyValue(
-                        dynamic_cast<Expression *>(keyValue->Key->copy()),
-                        dynamic_cast<Expression *>(keyValue->Value->copy())
+                destination->make<KeyValue>(
+                        dynamic_cast<Expression *>(keyValue->Key->copy(destination)),
+                        dynamic_cast<Expression *>(keyValue->Value->copy(destination))
                 )
         );
     }
-    return new HashExpression(newContent);
+    return destination->make<HashExpression>(std::move(newContent));
 }
 
-plasma::ast::Node *plasma::ast::Identifier::copy() {
-    return new Identifier(this->Token);
+plasma::ast::Node *plasma::ast::Identifier::copy(arena *destination) {
+    return destination->make<Identifier>(this->Token);
 }
 
-plasma::ast::Node *plasma::ast::BasicLiteralExpression::copy() {
-    return new BasicLiteralExpression(this->Token);
+plasma::ast::Node *plasma::ast::BasicLiteralExpression::copy(arena *destination) {
+    return destination->make<BasicLiteralExpression>(this->Token);
 }
 
-plasma::ast::Node *plasma::ast::BinaryExpression::copy() {
-    return new BinaryExpression(
-            dynamic_cast<Expression *>(this->LeftHandSide->copy()),
+plasma::ast::Node *plasma::ast::BinaryExpression::copy(arena *destination) {
+    return destination->make<BinaryExpression>(
+            dynamic_cast<Expression *>(this->LeftHandSide->copy(destination)),
             this->Operator,
-            dynamic_cast<Expression *>(this->RightHandSide->copy())
+            dynamic_cast<Expression *>(this->RightHandSide->copy(destination))
     );
 }
 
-plasma::ast::Node *plasma::ast::UnaryExpression::copy() {
-    return new UnaryExpression(
+plasma::ast::Node *plasma::ast::UnaryExpression::copy(arena *destination) {
+    return destination->make<UnaryExpression>(
             this->Operator,
-            dynamic_cast<Expression *>(this->X->copy())
+            dynamic_cast<Expression *>(this->X->copy(destination))
     );
 }
 
-plasma::ast::Node *plasma::ast::ReturnStatement::copy() {
-    std::vector<Expression *> newResults;
+plasma::ast::Node *plasma::ast::ReturnStatement::copy(arena *destination) {
+    node_list<Expression *> newResults(destination);
     newResults.reserve(this->Results.size());
     for (Expression *result: this->Results) {
-        newResults.push_back(dynamic_cast<Expression *>(result->copy()));
+        newResults.push_back(dynamic_cast<Expression *>(result->copy(destination)));
     }
-    return new ReturnStatement(newResults);
+    return destination->make<ReturnStatement>(std::move(newResults));
 }
 
-plasma::ast::Node *plasma::ast::LambdaExpression::copy() {
-    std::vector<Identifier *> newArguments;
+plasma::ast::Node *plasma::ast::LambdaExpression::copy(arena *destination) {
+    node_list<Identifier *> newArguments(destination);
     newArguments.reserve(this->Arguments.size());
     for (Identifier *argument: this->Arguments) {
-        newArguments.push_back(dynamic_cast<Identifier *>(argument->copy()));
+        newArguments.push_back(dynamic_cast<Identifier *>(argument->copy(destination)));
     }
-    return new LambdaExpression(newArguments, dynamic_cast<ReturnStatement *>(this->Output->copy()));
+    return destination->make<LambdaExpression>(
+            std::move(newArguments),
+            dynamic_cast<ReturnStatement *>(this->Output->copy(destination))
+    );
 }
 
-plasma::ast::Node *plasma::ast::GeneratorExpression::copy() {
-    std::vector<Identifier *> newReceivers;
+plasma::ast::Node *plasma::ast::GeneratorExpression::copy(arena *destination) {
+    node_list<Identifier *> newReceivers(destination);
     newReceivers.reserve(this->Receivers.size());
     for (Identifier *argument: this->Receivers) {
-        newReceivers.push_back(dynamic_cast<Identifier *>(argument->copy()));
+        newReceivers.push_back(dynamic_cast<Identifier *>(argument->copy(destination)));
     }
-    return new GeneratorExpression(
-            dynamic_cast<Expression *>(this->Operation->copy()),
-            newReceivers,
-            dynamic_cast<Expression *>(this->Source->copy())
+    return destination->make<GeneratorExpression>(
+            dynamic_cast<Expression *>(this->Operation->copy(destination)),
+            std::move(newReceivers),
+            dynamic_cast<Expression *>(this->Source->copy(destination))
     );
 }
 
-plasma::ast::Node *plasma::ast::SelectorExpression::copy() {
-    return new SelectorExpression(dynamic_cast<Expression *>(this->X->copy()),
-                                  dynamic_cast<ast::Identifier *>(this->Identifier->copy()));
+plasma::ast::Node *plasma::ast::SelectorExpression::copy(arena *destination) {
+    return destination->make<SelectorExpression>(dynamic_cast<Expression *>(this->X->copy(destination)),
+                                                 dynamic_cast<ast::Identifier *>(this->Identifier->copy(destination)));
 }
 
-plasma::ast::Node *plasma::ast::MethodInvocationExpression::copy() {
-    std::vector<Expression *> newArguments;
+plasma::ast::Node *plasma::ast::MethodInvocationExpression::copy(arena *destination) {
+    node_list<Expression *> newArguments(destination);
     newArguments.reserve(this->Arguments.size());
     for (Expression *argument: this->Arguments) {
-        newArguments.push_back(dynamic_cast<Expression *>(argument->copy()));
+        newArguments.push_back(dynamic_cast<Expression *>(argument->copy(destination)));
     }
-    return new MethodInvocationExpression(dynamic_cast<Expression *>(this->Function->copy()), newArguments);
+    return destination->make<MethodInvocationExpression>(
+            dynamic_cast<Expression *>(this->Function->copy(destination)),
+            std::move(newArguments)
+    );
 }
 
-plasma::ast::Node *plasma::ast::IndexExpression::copy() {
-    return new IndexExpression(dynamic_cast<Expression *>(this->Source->copy()),
-                               dynamic_cast<Expression *>(this->Index->copy()));
+plasma::ast::Node *plasma::ast::IndexExpression::copy(arena *destination) {
+    return destination->make<IndexExpression>(dynamic_cast<Expression *>(this->Source->copy(destination)),
+                                              dynamic_cast<Expression *>(this->Index->copy(destination)));
 }
 
-plasma::ast::Node *plasma::ast::IfOneLinerExpression::copy() {
-    return new IfOneLinerExpression(dynamic_cast<Expression *>(this->Result->copy()),
-                                    dynamic_cast<Expression *>(this->Condition->copy()),
-                                    dynamic_cast<Expression *>(this->ElseResult->copy()));
+plasma::ast::Node *plasma::ast::IfOneLinerExpression::copy(arena *destination) {
+    return destination->make<IfOneLinerExpression>(dynamic_cast<Expression *>(this->Result->copy(destination)),
+                                                   dynamic_cast<Expression *>(this->Condition->copy(destination)),
+                                                   dynamic_cast<Expression *>(this->ElseResult->copy(destination)));
 }
 
-plasma::ast::Node *plasma::ast::UnlessOneLinerExpression::copy() {
-    return new UnlessOneLinerExpression(dynamic_cast<Expression *>(this->Result->copy()),
-                                        dynamic_cast<Expression *>(this->Condition->copy()),
-                                        dynamic_cast<Expression *>(this->ElseResult->copy()));
+plasma::ast::Node *plasma::ast::UnlessOneLinerExpression::copy(arena *destination) {
+    return destination->make<UnlessOneLinerExpression>(dynamic_cast<Expression *>(this->Result->copy(destination)),
+                                                       dynamic_cast<Expression *>(this->Condition->copy(destination)),
+                                                       dynamic_cast<Expression *>(this->ElseResult->copy(destination)));
 }
 
-plasma::ast::Node *plasma::ast::ParenthesesExpression::copy() {
-    return new ParenthesesExpression(dynamic_cast<Expression *>(this->X->copy()));
+plasma::ast::Node *plasma::ast::ParenthesesExpression::copy(arena *destination) {
+    return destination->make<ParenthesesExpression>(dynamic_cast<Expression *>(this->X->copy(destination)));
 }
 
-plasma::ast::Node *plasma::ast::AssignStatement::copy() {
-    return new AssignStatement(
-            dynamic_cast<Expression *>(this->LeftHandSide->copy()),
+plasma::ast::Node *plasma::ast::AssignStatement::copy(arena *destination) {
+    return destination->make<AssignStatement>(
+            dynamic_cast<Expression *>(this->LeftHandSide->copy(destination)),
             this->AssignOperator,
-            dynamic_cast<Expression *>(this->RightHandSide->copy())
+            dynamic_cast<Expression *>(this->RightHandSide->copy(destination))
     );
 }
 
-plasma::ast::Node *plasma::ast::DoWhileStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::DoWhileStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    return new DoWhileStatement(dynamic_cast<Expression *>(this->Condition->copy()), newBody);
+    return destination->make<DoWhileStatement>(
+            dynamic_cast<Expression *>(this->Condition->copy(destination)),
+            std::move(newBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::WhileStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::WhileStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    return new WhileStatement(dynamic_cast<Expression *>(this->Condition->copy()), newBody);
+    return destination->make<WhileStatement>(
+            dynamic_cast<Expression *>(this->Condition->copy(destination)),
+            std::move(newBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::UntilStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::UntilStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    return new UntilStatement(dynamic_cast<Expression *>(this->Condition->copy()), newBody);
+    return destination->make<UntilStatement>(
+            dynamic_cast<Expression *>(this->Condition->copy(destination)),
+            std::move(newBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::ForStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::ForStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    std::vector<Identifier *> newReceivers;
+    node_list<Identifier *> newReceivers(destination);
     newReceivers.reserve(this->Receivers.size());
     for (Identifier *receiver : this->Receivers) {
-        newReceivers.push_back(dynamic_cast<Identifier *>(receiver->copy()));
+        newReceivers.push_back(dynamic_cast<Identifier *>(receiver->copy(destination)));
     }
-    return new ForStatement(newReceivers, dynamic_cast<Expression *>(this->Source->copy()), newBody);
+    return destination->make<ForStatement>(
+            std::move(newReceivers),
+            dynamic_cast<Expression *>(this->Source->copy(destination)),
+            std::move(newBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::IfStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::IfStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    std::vector<Node *> newElseBody;
+    node_list<Node *> newElseBody(destination);
     newElseBody.reserve(this->Else.size());
     for (Node *receiver : this->Else) {
-        newElseBody.push_back(receiver->copy());
+        newElseBody.push_back(receiver->copy(destination));
     }
-    return new IfStatement(dynamic_cast<Expression *>(this->Condition->copy()), newBody, newElseBody);
+    return destination->make<IfStatement>(
+            dynamic_cast<Expression *>(this->Condition->copy(destination)),
+            std::move(newBody),
+            std::move(newElseBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::UnlessStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::UnlessStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    std::vector<Node *> newElseBody;
+    node_list<Node *> newElseBody(destination);
     newElseBody.reserve(this->Else.size());
     for (Node *receiver : this->Else) {
-        newElseBody.push_back(receiver->copy());
+        newElseBody.push_back(receiver->copy(destination));
     }
-    return new UnlessStatement(dynamic_cast<Expression *>(this->Condition->copy()), newBody, newElseBody);
+    return destination->make<UnlessStatement>(
+            dynamic_cast<Expression *>(this->Condition->copy(destination)),
+            std::move(newBody),
+            std::move(newElseBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::SwitchStatement::copy() {
-    std::vector<CaseBlock *> newCaseBlocks;
+plasma::ast::Node *plasma::ast::SwitchStatement::copy(arena *destination) {
+    node_list<CaseBlock *> newCaseBlocks(destination);
     newCaseBlocks.reserve(this->CaseBlocks.size());
     for (CaseBlock *caseBlock : this->CaseBlocks) {
-        std::vector<Expression *> newCases;
+        node_list<Expression *> newCases(destination);
         newCases.reserve(caseBlock->Cases.size());
         for (Expression *node : caseBlock->Cases) {
-            newCases.push_back(dynamic_cast<Expression *>(node->copy()));
+            newCases.push_back(dynamic_cast<Expression *>(node->copy(destination)));
         }
-        std::vector<Node *> newCaseBody;
+        node_list<Node *> newCaseBody(destination);
         newCaseBody.reserve(caseBlock->Body.size());
         for (Node *node : caseBlock->Body) {
-            newCaseBody.push_back(node->copy());
+            newCaseBody.push_back(node->copy(destination));
         }
-        newCaseBlocks.push_back(new CaseBlock(newCases, newCaseBody));
+        newCaseBlocks.push_back(destination->make<CaseBlock>(std::move(newCases), std::move(newCaseBody)));
     }
-    std::vector<Node *> newDefault;
+    node_list<Node *> newDefault(destination);
     newDefault.reserve(this->Default.size());
     for (Node *node : this->Default) {
-        newDefault.push_back(node->copy());
+        newDefault.push_back(node->copy(destination));
     }
-    return new SwitchStatement(dynamic_cast<Expression *>(this->Target->copy()), newCaseBlocks, newDefault);
+    return destination->make<SwitchStatement>(
+            dynamic_cast<Expression *>(this->Target->copy(destination)),
+            std::move(newCaseBlocks),
+            std::move(newDefault)
+    );
 }
 
-plasma::ast::Node *plasma::ast::ModuleStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::ModuleStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    return new ModuleStatement(dynamic_cast<Identifier *>(this->Name->copy()), newBody);
+    return destination->make<ModuleStatement>(
+            dynamic_cast<Identifier *>(this->Name->copy(destination)),
+            std::move(newBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::FunctionDefinitionStatement::copy() {
-    std::vector<Identifier *> newArguments;
+plasma::ast::Node *plasma::ast::FunctionDefinitionStatement::copy(arena *destination) {
+    node_list<Identifier *> newArguments(destination);
     newArguments.reserve(this->Arguments.size());
     for (Identifier *argument : this->Arguments) {
-        newArguments.push_back(dynamic_cast<Identifier *>(argument->copy()));
+        newArguments.push_back(dynamic_cast<Identifier *>(argument->copy(destination)));
     }
-    std::vector<Node *> newBody;
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    return new FunctionDefinitionStatement(dynamic_cast<Identifier *>(this->Name->copy()), newArguments, newBody);
+    return destination->make<FunctionDefinitionStatement>(
+            dynamic_cast<Identifier *>(this->Name->copy(destination)),
+            std::move(newArguments),
+            std::move(newBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::InterfaceStatement::copy() {
-    std::vector<Expression *> newBases;
+plasma::ast::Node *plasma::ast::InterfaceStatement::copy(arena *destination) {
+    node_list<Expression *> newBases(destination);
     newBases.reserve(this->Bases.size());
     for (Expression *base : this->Bases) {
-        newBases.push_back(dynamic_cast<Expression *>(base->copy()));
+        newBases.push_back(dynamic_cast<Expression *>(base->copy(destination)));
     }
-    std::vector<FunctionDefinitionStatement *> newBody;
+    node_list<FunctionDefinitionStatement *> newBody(destination);
     newBody.reserve(this->MethodDefinitions.size());
     for (FunctionDefinitionStatement *node : this->MethodDefinitions) {
-        newBody.push_back(dynamic_cast<FunctionDefinitionStatement *>(node->copy()));
+        newBody.push_back(dynamic_cast<FunctionDefinitionStatement *>(node->copy(destination)));
     }
-    return new InterfaceStatement(dynamic_cast<Identifier *>(this->Name->copy()), newBases, newBody);
+    return destination->make<InterfaceStatement>(
+            dynamic_cast<Identifier *>(this->Name->copy(destination)),
+            std::move(newBases),
+            std::move(newBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::ClassStatement::copy() {
-    std::vector<Expression *> newBases;
+plasma::ast::Node *plasma::ast::ClassStatement::copy(arena *destination) {
+    node_list<Expression *> newBases(destination);
     newBases.reserve(this->Bases.size());
     for (Expression *base : this->Bases) {
-        newBases.push_back(dynamic_cast<Expression *>(base->copy()));
+        newBases.push_back(dynamic_cast<Expression *>(base->copy(destination)));
     }
-    std::vector<Node *> newBody;
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    return new ClassStatement(dynamic_cast<Identifier *>(this->Name->copy()), newBases, newBody);
+    return destination->make<ClassStatement>(
+            dynamic_cast<Identifier *>(this->Name->copy(destination)),
+            std::move(newBases),
+            std::move(newBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::TryStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::TryStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
 
-    std::vector<ExceptBlock *> newExceptBlocks;
+    node_list<ExceptBlock *> newExceptBlocks(destination);
     newExceptBlocks.reserve(this->ExceptBlocks.size());
     for (ExceptBlock *exceptBlock : this->ExceptBlocks) {
 
-        std::vector<Node *> newExceptBody;
+        node_list<Node *> newExceptBody(destination);
         newExceptBody.reserve(exceptBlock->Body.size());
         for (Node *node : exceptBlock->Body) {
-            newExceptBody.push_back(node->copy());
+            newExceptBody.push_back(node->copy(destination));
         }
 
         Identifier *newCaptureName = nullptr;
         if (exceptBlock->CaptureName != nullptr) {
-            newCaptureName = dynamic_cast<Identifier *>(exceptBlock->CaptureName->copy());
+            newCaptureName = dynamic_cast<Identifier *>(exceptBlock->CaptureName->copy(destination));
         }
         newExceptBlocks.push_back(
-                new ExceptBlock(dynamic_cast<TupleExpression *>(exceptBlock->Targets->copy()), newCaptureName,
-                                newExceptBody));
+                destination->make<ExceptBlock>(
+                        dynamic_cast<TupleExpression *>(exceptBlock->Targets->copy(destination)),
+                        newCaptureName,
+                        std::move(newExceptBody)
+                )
+        );
     }
 
-    std::vector<Node *> newElseBody;
+    node_list<Node *> newElseBody(destination);
     newElseBody.reserve(this->Else.size());
     for (Node *node : this->Else) {
-        newElseBody.push_back(node->copy());
+        newElseBody.push_back(node->copy(destination));
     }
-    std::vector<Node *> newFinallyBody;
+    node_list<Node *> newFinallyBody(destination);
     newFinallyBody.reserve(this->Finally.size());
     for (Node *node : this->Finally) {
-        newFinallyBody.push_back(node->copy());
+        newFinallyBody.push_back(node->copy(destination));
     }
-    return new TryStatement(newBody, newExceptBlocks, newElseBody, newFinallyBody);
+    return destination->make<TryStatement>(
+            std::move(newBody),
+            std::move(newExceptBlocks),
+            std::move(newElseBody),
+            std::move(newFinallyBody)
+    );
 }
 
-plasma::ast::Node *plasma::ast::RaiseStatement::copy() {
-    return new RaiseStatement(dynamic_cast<Expression *>(this->X->copy()));
+plasma::ast::Node *plasma::ast::RaiseStatement::copy(arena *destination) {
+    return destination->make<RaiseStatement>(dynamic_cast<Expression *>(this->X->copy(destination)));
 }
 
-plasma::ast::Node *plasma::ast::PassStatement::copy() {
-    return new PassStatement();
+plasma::ast::Node *plasma::ast::PassStatement::copy(arena *destination) {
+    return destination->make<PassStatement>();
 }
 
-plasma::ast::Node *plasma::ast::BreakStatement::copy() {
-    return new BreakStatement();
+plasma::ast::Node *plasma::ast::BreakStatement::copy(arena *destination) {
+    return destination->make<BreakStatement>();
 }
 
-plasma::ast::Node *plasma::ast::ContinueStatement::copy() {
-    return new ContinueStatement();
+plasma::ast::Node *plasma::ast::ContinueStatement::copy(arena *destination) {
+    return destination->make<ContinueStatement>();
 }
 
-plasma::ast::Node *plasma::ast::RedoStatement::copy() {
-    return new RedoStatement();
+plasma::ast::Node *plasma::ast::RedoStatement::copy(arena *destination) {
+    return destination->make<RedoStatement>();
 }
 
-plasma::ast::Node *plasma::ast::BeginStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::BeginStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    return new BeginStatement(newBody);
+    return destination->make<BeginStatement>(std::move(newBody));
 }
 
-plasma::ast::Node *plasma::ast::EndStatement::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::EndStatement::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
-    return new EndStatement(newBody);
+    return destination->make<EndStatement>(std::move(newBody));
 }
 
-plasma::ast::Node *plasma::ast::Program::copy() {
-    std::vector<Node *> newBody;
+plasma::ast::Node *plasma::ast::Program::copy(arena *destination) {
+    node_list<Node *> newBody(destination);
     newBody.reserve(this->Body.size());
     for (Node *node : this->Body) {
-        newBody.push_back(node->copy());
+        newBody.push_back(node->copy(destination));
     }
     BeginStatement *begin = nullptr;
     if (this->Begin != nullptr) {
-        begin = dynamic_cast<BeginStatement *>(this->Begin->copy());
+        begin = dynamic_cast<BeginStatement *>(this->Begin->copy(destination));
     }
     EndStatement *end = nullptr;
     if (this->End != nullptr) {
-        end = dynamic_cast<EndStatement *>(this->End->copy());
+        end = dynamic_cast<EndStatement *>(this->End->copy(destination));
     }
-    auto result = new Program();
+    auto result = destination->make<Program>(destination);
     result->Begin = begin;
-    result->Body = newBody;
+    result->Body = std::move(newBody);
     result->End = end;
     return result;
 }
\ No newline at end of file
@@ -1,218 +1,110 @@
 #include "vm/virtual_machine.h"
 
+namespace plasma::vm {
+    static value *bool_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        (*success) = true;
+        if (right->typeId != Boolean) {
+            return vm->get_false(c);
+        }
+        return vm->get_boolean(c, self->boolean == right->boolean);
+    }
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::bool_initialize(bool isBuiltIn) {
+    static value *
+    bool_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        (*success) = true;
+        if (left->typeId != Boolean) {
+            return vm->get_false(c);
+        }
+        return vm->get_boolean(c, left->boolean == self->boolean);
+    }
+
+    static value *
+    bool_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        (*success) = true;
+        if (right->typeId != Boolean) {
+            return vm->get_true(c);
+        }
+        return vm->get_boolean(c, self->boolean != right->boolean);
+    }
+
+    static value *
+    bool_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        (*success) = true;
+        if (left->typeId != Boolean) {
+            return vm->get_true(c);
+        }
+        return vm->get_boolean(c, left->boolean != self->boolean);
+    }
+
+    static value *bool_copy(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_boolean(c, self->boolean);
+    }
+
+    static value *bool_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        if (self->boolean) {
+            return vm->new_integer(c, false, 1);
+        }
+        return vm->new_integer(c, false, 0);
+    }
+
+    static value *
+    bool_to_integer(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        if (self->boolean) {
+            return vm->new_integer(c, false, 1);
+        }
+        return vm->new_integer(c, false, 0);
+    }
+
+    static value *bool_to_float(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        if (self->boolean) {
+            return vm->new_float(c, false, 1);
+        }
+        return vm->new_float(c, false, 0);
+    }
 
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        (*success) = true;
-                                        if (right->typeId != Boolean) {
-                                            return this->get_false(c);
-                                        }
-                                        return this->get_boolean(c, self->boolean == right->boolean);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        (*success) = true;
-                                        if (left->typeId != Boolean) {
-                                            return this->get_false(c);
-                                        }
-                                        return this->get_boolean(c, left->boolean == self->boolean);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        (*success) = true;
-                                        if (right->typeId != Boolean) {
-                                            return this->get_true(c);
-                                        }
-                                        return this->get_boolean(c, self->boolean != right->boolean);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        (*success) = true;
-                                        if (left->typeId != Boolean) {
-                                            return this->get_true(c);
-                                        }
-                                        return this->get_boolean(c, left->boolean != self->boolean);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Copy,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_boolean(c, self->boolean);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        if (self->boolean) {
-                                            return this->new_integer(c, false, 1);
-                                        }
-                                        return this->new_integer(c, false, 0);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToInteger,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        if (self->boolean) {
-                                            return this->new_integer(c, false, 1);
-                                        }
-                                        return this->new_integer(c, false, 0);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToFloat,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        if (self->boolean) {
-                                            return this->new_float(c, false, 1);
-                                        }
-                                        return this->new_float(c, false, 0);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+    static value *
+    bool_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        if (self->boolean) {
+            return vm->new_string(c, false, True);
+        }
+        return vm->new_string(c, false, False);
+    }
+
+    static value *bool_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_boolean(c, self->boolean);
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::bool_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Equals, {1, bool_equals}},
+            {RightEquals, {1, bool_right_equals}},
+            {NotEquals, {1, bool_not_equals}},
+            {RightNotEquals, {1, bool_right_not_equals}},
+            {Copy, {0, bool_copy}},
+            {Hash, {0, bool_hash}},
+            {ToInteger, {0, bool_to_integer}},
+            {ToFloat, {0, bool_to_float}},
+            {ToString, {0, bool_to_string}},
+            {ToBool, {0, bool_to_bool}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::bool_initialize(bool isBuiltIn) {
 
-                                        (*success) = true;
-                                        if (self->boolean) {
-                                            return this->new_string(c, false, True);
-                                        }
-                                        return this->new_string(c, false, False);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_boolean(c, self->boolean);
-                                    }
-                            )
-                    );
-                }
-        );
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &bool_methods();
         return nullptr;
     };
 }
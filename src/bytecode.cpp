@@ -1,7 +1,29 @@
+#include <iterator>
 #include <utility>
 
 #include "vm/virtual_machine.h"
 
+void plasma::vm::instruction_list::set_position(size_t line, size_t column) {
+    this->lines.add(this->size(), line, column);
+}
+
+void plasma::vm::instruction_list::append(const instruction_list &other) {
+    this->lines.append(other.lines, this->size());
+    this->insert(this->end(), other.begin(), other.end());
+}
+
+void plasma::vm::instruction_list::append(instruction_list &&other) {
+    this->lines.append(other.lines, this->size());
+    this->insert(this->end(), std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+}
+
+plasma::vm::instruction_list plasma::vm::instruction_list::slice(size_t start, size_t end) const {
+    instruction_list result;
+    result.assign(this->begin() + (std::ptrdiff_t) start, this->begin() + (std::ptrdiff_t) end);
+    result.lines = this->lines.slice(start, end);
+    return result;
+}
+
 size_t plasma::vm::bytecode::length() const {
     return this->instructions.size();
 }
@@ -20,11 +42,8 @@ plasma::vm::instruction plasma::vm::bytecode::next() {
     return result;
 }
 
-std::vector<plasma::vm::instruction> plasma::vm::bytecode::nextN(size_t n) {
-    std::vector<instruction> result(
-            this->instructions.cbegin() + this->index,
-            this->instructions.cbegin() + this->index + n
-    );
+plasma::vm::instruction_list plasma::vm::bytecode::nextN(size_t n) {
+    instruction_list result = this->instructions.slice(this->index, this->index + n);
     this->index += n;
     return result;
 }
@@ -35,4 +54,26 @@ void plasma::vm::bytecode::jump(size_t offset) {
 
 void plasma::vm::bytecode::rjump(size_t offset) {
     this->index -= offset;
-}
\ No newline at end of file
+}
+bool plasma::vm::frame::has_next() const {
+    return this->index < this->end;
+}
+
+const plasma::vm::instruction &plasma::vm::frame::fetch() {
+    const instruction &result = (*this->code)[this->index];
+    this->index++;
+    return result;
+}
+
+plasma::vm::instruction_list plasma::vm::frame::nextN(size_t n) {
+    instruction_list result = this->code->slice(this->index, this->index + n);
+    this->index += n;
+    return result;
+}
+
+void plasma::vm::frame::start(uint8_t newPhase, const instruction_list *newCode) {
+    this->phase = newPhase;
+    this->code = newCode;
+    this->index = 0;
+    this->end = newCode->size();
+}
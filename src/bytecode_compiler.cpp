@@ -1,17 +1,29 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #include "compiler/bytecode_compiler.h"
+#include "compiler/thread_pool.h"
 #include "tools.h"
 
 plasma::bytecode_compiler::compiler::compiler(plasma::parser::parser *p) {
     this->parser = p;
+    this->workers = std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+// Tokens made by the parser or the compiler have no place in the source
+static void set_position(plasma::vm::instruction_list *result, const plasma::lexer::token &token) {
+    if (token.column >= 0) {
+        result->set_position(token.line, token.column);
+    }
 }
 
 static bool
 compile_class_function_definition(plasma::ast::FunctionDefinitionStatement *functionDefinitionStatement,
-                                  std::vector<plasma::vm::instruction> *result,
+                                  plasma::vm::instruction_list *result,
                                   plasma::error::error *compilationError);
 
-static bool compile_class_body(const std::vector<plasma::ast::Node *> &body,
-                               std::vector<plasma::vm::instruction> *result,
+static bool compile_class_body(const plasma::ast::node_list<plasma::ast::Node *> &body,
+                               plasma::vm::instruction_list *result,
                                plasma::error::error *compilationError) {
     for (plasma::ast::Node *node : body) {
         if (node->TypeID == plasma::ast::FunctionDefinitionID) {
@@ -27,8 +39,8 @@ static bool compile_class_body(const std::vector<plasma::ast::Node *> &body,
     return true;
 }
 
-static bool compile_body(std::vector<plasma::ast::Node *> body,
-                         std::vector<plasma::vm::instruction> *result,
+static bool compile_body(const plasma::ast::node_list<plasma::ast::Node *> &body,
+                         plasma::vm::instruction_list *result,
                          plasma::error::error *compilationError) {
     for (plasma::ast::Node *node : body) {
         if (!node->compile(result, compilationError)) {
@@ -38,7 +50,7 @@ static bool compile_body(std::vector<plasma::ast::Node *> body,
     return true;
 }
 
-static bool compile_to_array(const plasma::ast::Program &parsedProgram, std::vector<plasma::vm::instruction> *result,
+static bool compile_to_array(const plasma::ast::Program &parsedProgram, plasma::vm::instruction_list *result,
                              plasma::error::error *compilationError) {
     if (!parsedProgram.Begin->Body.empty()) {
         if (!compile_body(parsedProgram.Begin->Body, result, compilationError)) {
@@ -56,32 +68,167 @@ static bool compile_to_array(const plasma::ast::Program &parsedProgram, std::vec
     return true;
 }
 
+namespace plasma::bytecode_compiler {
+    /*
+     * Top level nodes compiled together, the bytecode of each node only depends on the node itself
+     */
+    struct compilation_unit {
+        std::vector<ast::Node *> nodes;
+        vm::instruction_list instructions;
+        error::error compilationError;
+        bool success = false;
+    };
+}
+
+static bool is_definition(const plasma::ast::Node *node) {
+    switch (node->TypeID) {
+        case plasma::ast::FunctionDefinitionID:
+        case plasma::ast::ClassID:
+        case plasma::ast::InterfaceID:
+        case plasma::ast::ModuleID:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Definitions get a unit of their own, the statements between them are grouped to keep the units coarse
+static std::vector<plasma::bytecode_compiler::compilation_unit> split_program(const plasma::ast::Program &program) {
+    std::vector<plasma::bytecode_compiler::compilation_unit> units;
+    if (program.Begin != nullptr) {
+        units.emplace_back().nodes.assign(program.Begin->Body.begin(), program.Begin->Body.end());
+    }
+    bool lastIsDefinition = true;
+    for (plasma::ast::Node *node : program.Body) {
+        bool definition = is_definition(node);
+        if (definition || lastIsDefinition) {
+            units.emplace_back();
+        }
+        units.back().nodes.push_back(node);
+        lastIsDefinition = definition;
+    }
+    if (program.End != nullptr) {
+        units.emplace_back().nodes.assign(program.End->Body.begin(), program.End->Body.end());
+    }
+    return units;
+}
+
+static void compile_units(std::vector<plasma::bytecode_compiler::compilation_unit> *units, unsigned int workers) {
+    std::atomic<size_t> nextUnit = 0;
+    auto work = [units, &nextUnit]() {
+        for (size_t index = nextUnit++; index < units->size(); index = nextUnit++) {
+            plasma::bytecode_compiler::compilation_unit &unit = (*units)[index];
+            unit.success = true;
+            for (plasma::ast::Node *node : unit.nodes) {
+                if (!node->compile(&unit.instructions, &unit.compilationError)) {
+                    unit.success = false;
+                    break;
+                }
+            }
+        }
+    };
+    // Programs with fewer units than workers are not worth waking up the pool
+    if (workers <= 1 || units->size() < workers) {
+        work();
+        return;
+    }
+    plasma::bytecode_compiler::thread_pool::shared().run(workers - 1, work);
+}
+
 bool plasma::bytecode_compiler::compiler::compile(vm::bytecode *result, error::error *compilationError) const {
     plasma::ast::Program *parsedProgram = this->parser->parse();
-    std::vector<plasma::vm::instruction> arrayResult;
-    if (!parsedProgram->compile(&arrayResult, compilationError)) {
+    if (!this->parser->Errors.empty()) {
+        this->parser->Arena.release();
+        (*compilationError) = this->parser->Errors.front();
         return false;
     }
+    std::vector<compilation_unit> units = split_program(*parsedProgram);
+    compile_units(&units, this->workers);
+    // The instructions keep no reference to the nodes, drop the whole tree at once
+    this->parser->Arena.release();
+    size_t length = 0;
+    for (compilation_unit &unit : units) {
+        // Report the first error of the script, not the first one found by the workers
+        if (!unit.success) {
+            (*compilationError) = unit.compilationError;
+            return false;
+        }
+        length += unit.instructions.size();
+    }
+    plasma::vm::instruction_list instructions;
+    instructions.reserve(length);
+    for (compilation_unit &unit : units) {
+        instructions.append(std::move(unit.instructions));
+    }
     (*result) = vm::bytecode{
-            .instructions = arrayResult,
+            .instructions = std::move(instructions),
             .index = 0
     };
     return true;
 }
 
-bool plasma::ast::BasicLiteralExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::bytecode_compiler::compiler::compile_streaming(vm::bytecode *result,
+                                                           error::error *compilationError) const {
+    // Only the last BEGIN and END blocks of the script are kept, like in parse
+    plasma::vm::instruction_list begin;
+    plasma::vm::instruction_list body;
+    plasma::vm::instruction_list end;
+    for (plasma::ast::Node *node = this->parser->parseTopLevelStatement();
+         node != nullptr;
+         node = this->parser->parseTopLevelStatement()) {
+        // After a syntax error the script is only parsed to find the rest of them
+        if (!this->parser->Errors.empty()) {
+            this->parser->Arena.reset();
+            continue;
+        }
+        bool success;
+        if (node->TypeID == plasma::ast::BeginID) {
+            begin = plasma::vm::instruction_list{};
+            success = node->compile(&begin, compilationError);
+        } else if (node->TypeID == plasma::ast::EndID) {
+            end = plasma::vm::instruction_list{};
+            success = node->compile(&end, compilationError);
+        } else {
+            success = node->compile(&body, compilationError);
+        }
+        // The statement is already bytecode, its nodes can be overwritten by the next one
+        this->parser->Arena.reset();
+        if (!success) {
+            this->parser->Arena.release();
+            return false;
+        }
+    }
+    this->parser->Arena.release();
+    if (!this->parser->Errors.empty()) {
+        (*compilationError) = this->parser->Errors.front();
+        return false;
+    }
+    // The body is the bulk of the bytecode, avoid moving it when there is no BEGIN block
+    if (!begin.empty()) {
+        begin.reserve(begin.size() + body.size() + end.size());
+        begin.append(std::move(body));
+        body = std::move(begin);
+    }
+    body.append(std::move(end));
+    (*result) = vm::bytecode{
+            .instructions = std::move(body),
+            .index = 0
+    };
+    return true;
+}
+
+bool plasma::ast::BasicLiteralExpression::compile(vm::instruction_list *result,
                                                   plasma::error::error *compilationError) {
-    int64_t integerValue;
-    double floatValue;
-    bool parsingSuccess;
+    set_position(result, this->Token);
     switch (this->Token.directValue) {
         case plasma::lexer::SingleQuoteString:
         case plasma::lexer::DoubleQuoteString:
             result->push_back(
                     plasma::vm::instruction{
                             .op_code = plasma::vm::NewStringOP,
-                            .value = plasma::general_tooling::replace_escaped(this->Token.string),
-                            .line = static_cast<size_t>(this->Token.line),
+                            .value = plasma::vm::immutable_string(
+                                    plasma::general_tooling::replace_escaped(this->Token.string)
+                            )
                     }
             );
             break;
@@ -89,8 +236,9 @@ bool plasma::ast::BasicLiteralExpression::compile(std::vector<vm::instruction> *
             result->push_back(
                     plasma::vm::instruction{
                             .op_code = plasma::vm::NewBytesOP,
-                            .value = plasma::general_tooling::replace_escaped(this->Token.string),
-                            .line = static_cast<size_t>(this->Token.line),
+                            .value = plasma::vm::immutable_bytes(
+                                    plasma::general_tooling::replace_escaped(this->Token.string)
+                            )
                     }
             );
             break;
@@ -98,56 +246,40 @@ bool plasma::ast::BasicLiteralExpression::compile(std::vector<vm::instruction> *
         case plasma::lexer::HexadecimalInteger:
         case plasma::lexer::BinaryInteger:
         case plasma::lexer::OctalInteger:
-            integerValue = plasma::general_tooling::parse_integer(this->Token.string,
-                                                                  &parsingSuccess);
-            if (!parsingSuccess) {
-                plasma::error::new_unknown_vm_operation_error(compilationError, this->Token.directValue);
-                return false;
-            }
             result->push_back(
                     plasma::vm::instruction{
                             .op_code = plasma::vm::NewIntegerOP,
-                            .value = integerValue,
-                            .line = static_cast<size_t>(this->Token.line),
+                            .value = this->Token.number.integer
                     }
             );
             break;
         case plasma::lexer::Float:
         case plasma::lexer::ScientificFloat:
-            floatValue = plasma::general_tooling::parse_float(this->Token.string, &parsingSuccess);
-            if (!parsingSuccess) {
-                plasma::error::new_unknown_vm_operation_error(compilationError, this->Token.directValue);
-                return false;
-            }
             result->push_back(
                     plasma::vm::instruction{
                             .op_code = plasma::vm::NewFloatOP,
-                            .value = floatValue,
-                            .line = static_cast<size_t>(this->Token.line),
+                            .value = this->Token.number.floating
                     }
             );
             break;
         case plasma::lexer::True:
             result->push_back(
                     plasma::vm::instruction{
-                            .op_code = plasma::vm::GetTrueOP,
-                            .line = static_cast<size_t>(this->Token.line),
+                            .op_code = plasma::vm::GetTrueOP
                     }
             );
             break;
         case plasma::lexer::False:
             result->push_back(
                     plasma::vm::instruction{
-                            .op_code = plasma::vm::GetFalseOP,
-                            .line = static_cast<size_t>(this->Token.line),
+                            .op_code = plasma::vm::GetFalseOP
                     }
             );
             break;
         case plasma::lexer::None:
             result->push_back(
                     plasma::vm::instruction{
-                            .op_code = plasma::vm::GetNoneOP,
-                            .line = static_cast<size_t>(this->Token.line),
+                            .op_code = plasma::vm::GetNoneOP
                     }
             );
             break;
@@ -158,7 +290,7 @@ bool plasma::ast::BasicLiteralExpression::compile(std::vector<vm::instruction> *
     return true;
 }
 
-bool plasma::ast::TupleExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::TupleExpression::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
     for (auto tupleValue = this->Values.rbegin();
          tupleValue != this->Values.rend();
@@ -176,7 +308,7 @@ bool plasma::ast::TupleExpression::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::ArrayExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::ArrayExpression::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
     for (auto argument = this->Values.rbegin();
          argument != this->Values.rend();
@@ -194,7 +326,7 @@ bool plasma::ast::ArrayExpression::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::HashExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::HashExpression::compile(vm::instruction_list *result,
                                           plasma::error::error *compilationError) {
     for (KeyValue *keyValue : this->KeyValues) {
         if (!keyValue->Value->compile_and_push(true, result, compilationError)) {
@@ -213,7 +345,7 @@ bool plasma::ast::HashExpression::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::UnaryExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::UnaryExpression::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
     if (!this->X->compile_and_push(true, result, compilationError)) {
         return false;
@@ -246,7 +378,7 @@ bool plasma::ast::UnaryExpression::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::BinaryExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::BinaryExpression::compile(vm::instruction_list *result,
                                             plasma::error::error *compilationError) {
     auto rightHandSide = this->RightHandSide;
     if (!rightHandSide->compile_and_push(true, result, compilationError)) {
@@ -328,6 +460,7 @@ bool plasma::ast::BinaryExpression::compile(std::vector<vm::instruction> *result
             plasma::error::new_unknown_vm_operation_error(compilationError, this->Operator.directValue);
             return false;
     }
+    set_position(result, this->Operator);
     result->push_back(
             plasma::vm::instruction{
                     .op_code = plasma::vm::BinaryOP,
@@ -337,18 +470,18 @@ bool plasma::ast::BinaryExpression::compile(std::vector<vm::instruction> *result
     return true;
 }
 
-bool plasma::ast::Identifier::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+bool plasma::ast::Identifier::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
+    set_position(result, this->Token);
     result->push_back(
             plasma::vm::instruction{
                     .op_code  = plasma::vm::GetIdentifierOP,
-                    .value = this->Token.string,
-                    .line = static_cast<size_t>(this->Token.line)
+                    .value = std::string(this->Token.string),
             }
     );
     return true;
 }
 
-bool plasma::ast::SelectorExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::SelectorExpression::compile(vm::instruction_list *result,
                                               plasma::error::error *compilationError) {
     ;
     if (!this->X->compile_and_push(true, result, compilationError)) {
@@ -357,13 +490,13 @@ bool plasma::ast::SelectorExpression::compile(std::vector<vm::instruction> *resu
     result->push_back(
             plasma::vm::instruction{
                     .op_code = plasma::vm::SelectNameFromObjectOP,
-                    .value = this->Identifier->Token.string
+                    .value = std::string(this->Identifier->Token.string)
             }
     );
     return true;
 }
 
-bool plasma::ast::IndexExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::IndexExpression::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
     if (!this->Source->compile_and_push(true, result, compilationError)) {
         return false;
@@ -379,7 +512,7 @@ bool plasma::ast::IndexExpression::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::MethodInvocationExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::MethodInvocationExpression::compile(vm::instruction_list *result,
                                                       plasma::error::error *compilationError) {
     for (auto argument = this->Arguments.rbegin();
          argument != this->Arguments.rend();
@@ -401,17 +534,17 @@ bool plasma::ast::MethodInvocationExpression::compile(std::vector<vm::instructio
     return true;
 }
 
-bool plasma::ast::ParenthesesExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::ParenthesesExpression::compile(vm::instruction_list *result,
                                                  plasma::error::error *compilationError) {
     return this->X->compile(result, compilationError);
 }
 
-bool plasma::ast::IfOneLinerExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::IfOneLinerExpression::compile(vm::instruction_list *result,
                                                 plasma::error::error *compilationError) {
     if (!this->Condition->compile_and_push(true, result, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> ifResult;
+    plasma::vm::instruction_list ifResult;
     if (!this->Result->compile_and_push(true, &ifResult, compilationError)) {
         return false;
     }
@@ -421,7 +554,7 @@ bool plasma::ast::IfOneLinerExpression::compile(std::vector<vm::instruction> *re
                     .value = static_cast<size_t>(1),
             }
     );
-    std::vector<plasma::vm::instruction> elseResult;
+    plasma::vm::instruction_list elseResult;
     if (!this->ElseResult->compile_and_push(true, &elseResult, compilationError)) {
         return false;
     }
@@ -443,12 +576,12 @@ bool plasma::ast::IfOneLinerExpression::compile(std::vector<vm::instruction> *re
     return true;
 }
 
-bool plasma::ast::UnlessOneLinerExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::UnlessOneLinerExpression::compile(vm::instruction_list *result,
                                                     plasma::error::error *compilationError) {
     if (!this->Condition->compile_and_push(true, result, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> unlessResult;
+    plasma::vm::instruction_list unlessResult;
     if (!this->Result->compile_and_push(true, &unlessResult, compilationError)) {
         return false;
     }
@@ -458,7 +591,7 @@ bool plasma::ast::UnlessOneLinerExpression::compile(std::vector<vm::instruction>
                     .value = static_cast<size_t>(1),
             }
     );
-    std::vector<plasma::vm::instruction> elseResult;
+    plasma::vm::instruction_list elseResult;
     if (!this->ElseResult->compile_and_push(true, &elseResult, compilationError)) {
         return false;
     }
@@ -480,13 +613,13 @@ bool plasma::ast::UnlessOneLinerExpression::compile(std::vector<vm::instruction>
     return true;
 }
 
-bool plasma::ast::LambdaExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::LambdaExpression::compile(vm::instruction_list *result,
                                             plasma::error::error *compilationError) {
     std::vector<std::string> arguments;
     for (Identifier *argument : this->Arguments) {
-        arguments.push_back(argument->Token.string);
+        arguments.emplace_back(argument->Token.string);
     }
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
     body.push_back(
             plasma::vm::instruction{
                     .op_code = plasma::vm::LoadFunctionArgumentsOP,
@@ -505,20 +638,20 @@ bool plasma::ast::LambdaExpression::compile(std::vector<vm::instruction> *result
                     }
             }
     );
-    result->insert(result->end(), body.begin(), body.end());
+    result->append(std::move(body));
     return true;
 }
 
-bool plasma::ast::GeneratorExpression::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::GeneratorExpression::compile(vm::instruction_list *result,
                                                plasma::error::error *compilationError) {
     if (!this->Source->compile_and_push(true, result, compilationError)) {
         return false;
     }
 
-    std::vector<plasma::vm::instruction> operation;
+    plasma::vm::instruction_list operation;
     std::vector<std::string> receivers;
     for (Identifier *receiver : this->Receivers) {
-        receivers.push_back(receiver->Token.string);
+        receivers.emplace_back(receiver->Token.string);
     }
     operation.push_back(
             plasma::vm::instruction{
@@ -527,9 +660,8 @@ bool plasma::ast::GeneratorExpression::compile(std::vector<vm::instruction> *res
             }
     );
 
-    std::vector<plasma::ast::Expression *> generatorOperation;
-    generatorOperation.push_back(this->Operation);
-    if (!(new ReturnStatement(generatorOperation))->compile(&operation, compilationError)) {
+    ReturnStatement generatorOperation(node_list<Expression *>{this->Operation});
+    if (!generatorOperation.compile(&operation, compilationError)) {
         return false;
     }
     result->push_back(
@@ -541,13 +673,13 @@ bool plasma::ast::GeneratorExpression::compile(std::vector<vm::instruction> *res
                     }
             }
     );
-    result->insert(result->end(), operation.begin(), operation.end());
+    result->append(std::move(operation));
     return true;
 }
 
 // Statements
 
-bool plasma::ast::AssignStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::AssignStatement::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
     // Pre-assignment
     if (this->AssignOperator.directValue == plasma::lexer::Assign) { // Basic Assign
@@ -594,11 +726,13 @@ bool plasma::ast::AssignStatement::compile(std::vector<vm::instruction> *result,
                 // Fixme
                 break;
         }
-        if (!(new plasma::ast::BinaryExpression(this->LeftHandSide, plasma::lexer::token{
+        plasma::ast::BinaryExpression operation(this->LeftHandSide, plasma::lexer::token{
                 .directValue = preOperation,
                 .kind = plasma::lexer::Operator,
-                .line = this->AssignOperator.line
-        }, this->RightHandSide))->compile_and_push(true, result, compilationError)) {
+                .line = this->AssignOperator.line,
+                .column = this->AssignOperator.column
+        }, this->RightHandSide);
+        if (!operation.compile_and_push(true, result, compilationError)) {
             return false;
         }
     }
@@ -609,7 +743,9 @@ bool plasma::ast::AssignStatement::compile(std::vector<vm::instruction> *result,
             result->push_back(
                     plasma::vm::instruction{
                             .op_code = plasma::vm::AssignIdentifierOP,
-                            .value = dynamic_cast<plasma::ast::Identifier *>(this->LeftHandSide)->Token.string
+                            .value = std::string(
+                                    dynamic_cast<plasma::ast::Identifier *>(this->LeftHandSide)->Token.string
+                            )
                     }
             );
             break;
@@ -624,8 +760,8 @@ bool plasma::ast::AssignStatement::compile(std::vector<vm::instruction> *result,
             result->push_back(
                     plasma::vm::instruction{
                             .op_code = plasma::vm::AssignSelectorOP,
-                            .value = dynamic_cast<plasma::ast::SelectorExpression *>(
-                                    this->LeftHandSide)->Identifier->Token.string
+                            .value = std::string(dynamic_cast<plasma::ast::SelectorExpression *>(
+                                    this->LeftHandSide)->Identifier->Token.string)
                     }
             );
             break;
@@ -656,15 +792,15 @@ bool plasma::ast::AssignStatement::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::FunctionDefinitionStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::FunctionDefinitionStatement::compile(vm::instruction_list *result,
                                                        plasma::error::error *compilationError) {
     // ImplementMe:
     std::vector<std::string> arguments;
     for (Identifier *argument : this->Arguments) {
-        arguments.push_back(argument->Token.string);
+        arguments.emplace_back(argument->Token.string);
     }
 
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
 
     body.push_back(
             plasma::vm::instruction{
@@ -681,29 +817,29 @@ bool plasma::ast::FunctionDefinitionStatement::compile(std::vector<vm::instructi
             plasma::vm::instruction{
                     .op_code = plasma::vm::NewFunctionOP,
                     .value = plasma::vm::function_information{
-                            .name = this->Name->Token.string,
+                            .name = std::string(this->Name->Token.string),
                             .bodyLength = body.size(),
                             .numberOfArguments = arguments.size()
                     }
             }
     );
 
-    result->insert(result->end(), body.begin(), body.end());
+    result->append(std::move(body));
 
     return true;
 }
 
 static bool
 compile_class_function_definition(plasma::ast::FunctionDefinitionStatement *functionDefinitionStatement,
-                                  std::vector<plasma::vm::instruction> *result,
+                                  plasma::vm::instruction_list *result,
                                   plasma::error::error *compilationError) {
     // ImplementMe:
     std::vector<std::string> arguments;
     for (plasma::ast::Identifier *argument : functionDefinitionStatement->Arguments) {
-        arguments.push_back(argument->Token.string);
+        arguments.emplace_back(argument->Token.string);
     }
 
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
 
     body.push_back(
             plasma::vm::instruction{
@@ -720,26 +856,26 @@ compile_class_function_definition(plasma::ast::FunctionDefinitionStatement *func
             plasma::vm::instruction{
                     .op_code = plasma::vm::NewClassFunctionOP,
                     .value = plasma::vm::function_information{
-                            .name = functionDefinitionStatement->Name->Token.string,
+                            .name = std::string(functionDefinitionStatement->Name->Token.string),
                             .bodyLength = body.size(),
                             .numberOfArguments = arguments.size()
                     }
             }
     );
 
-    result->insert(result->end(), body.begin(), body.end());
+    result->append(std::move(body));
 
     return true;
 }
 
-bool plasma::ast::ClassStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::ClassStatement::compile(vm::instruction_list *result,
                                           plasma::error::error *compilationError) {
     for (Expression *base : this->Bases) {
         if (!base->compile_and_push(true, result, compilationError)) {
             return false;
         }
     }
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
     if (!compile_class_body(this->Body, &body, compilationError)) {
         return false;
     }
@@ -748,19 +884,19 @@ bool plasma::ast::ClassStatement::compile(std::vector<vm::instruction> *result,
             plasma::vm::instruction{
                     .op_code = plasma::vm::NewClassOP,
                     .value = plasma::vm::class_information{
-                            .name = this->Name->Token.string,
+                            .name = std::string(this->Name->Token.string),
                             .bodyLength = body.size(),
                             .numberOfBases = this->Bases.size()
                     }
             }
     );
 
-    result->insert(result->end(), body.begin(), body.end());
+    result->append(std::move(body));
 
     return true;
 }
 
-bool plasma::ast::ReturnStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::ReturnStatement::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
     for (auto returnValue = this->Results.rbegin();
          returnValue != this->Results.rend();
@@ -778,15 +914,15 @@ bool plasma::ast::ReturnStatement::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::IfStatement::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+bool plasma::ast::IfStatement::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
     if (!this->Condition->compile_and_push(true, result, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> ifBody;
+    plasma::vm::instruction_list ifBody;
     if (!compile_body(this->Body, &ifBody, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> elseBody;
+    plasma::vm::instruction_list elseBody;
     if (!compile_body(this->Else, &elseBody, compilationError)) {
         return false;
     }
@@ -802,16 +938,16 @@ bool plasma::ast::IfStatement::compile(std::vector<vm::instruction> *result, pla
     return true;
 }
 
-bool plasma::ast::UnlessStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::UnlessStatement::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
     if (!this->Condition->compile_and_push(true, result, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> unlessBody;
+    plasma::vm::instruction_list unlessBody;
     if (!compile_body(this->Body, &unlessBody, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> elseBody;
+    plasma::vm::instruction_list elseBody;
     if (!compile_body(this->Else, &elseBody, compilationError)) {
         return false;
     }
@@ -827,65 +963,44 @@ bool plasma::ast::UnlessStatement::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::SwitchStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::SwitchStatement::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
+    // The lowered if chain only lives while it is compiled
+    arena scratch;
     IfStatement *root = nullptr;
     IfStatement *lastIfStatement;
     for (CaseBlock *caseBlock : this->CaseBlocks) {
-        std::vector<Expression *> copiedCases;
-        copiedCases.reserve(caseBlock->Cases.size());
-        for (Expression *caseTarget : caseBlock->Cases) {
-            copiedCases.push_back(caseTarget);
-        }
-        std::vector<Node *> copiedBody;
-        copiedBody.reserve(caseBlock->Body.size());
-        for (Node *node : caseBlock->Body) {
-            copiedBody.push_back(node);
-        }
+        node_list<Expression *> copiedCases(caseBlock->Cases.begin(), caseBlock->Cases.end(), &scratch);
+        node_list<Node *> copiedBody(caseBlock->Body.begin(), caseBlock->Body.end(), &scratch);
+        auto newLastIfStatement = scratch.make<IfStatement>(
+                scratch.make<BinaryExpression>(
+                        dynamic_cast<Expression *>(this->Target->copy(&scratch)),
+                        lexer::token{
+                                .string = "in",
+                                .directValue = lexer::In,
+                                .kind = lexer::Operator
+                        },
+                        scratch.make<TupleExpression>(std::move(copiedCases))
+                ),
+                std::move(copiedBody),
+                node_list<Node *>(&scratch)
+        );
         if (root == nullptr) {
-            root = new IfStatement(
-                    new BinaryExpression(
-                            dynamic_cast<Expression *>(this->Target->copy()),
-                            lexer::token{
-                                    .string = "in",
-                                    .directValue = lexer::In,
-                                    .kind = lexer::Operator
-                            },
-                            new TupleExpression(copiedCases)
-                    ),
-                    copiedBody,
-                    std::vector<Node *>()
-            );
-            lastIfStatement = root;
+            root = newLastIfStatement;
         } else {
-            auto newLastIfStatement = new IfStatement(
-                    new BinaryExpression(
-                            dynamic_cast<Expression *>(this->Target->copy()),
-                            lexer::token{
-                                    .string = "in",
-                                    .directValue = lexer::In,
-                                    .kind = lexer::Operator
-                            },
-                            new TupleExpression(copiedCases)
-                    ),
-                    copiedBody,
-                    std::vector<Node *>()
-            );
             lastIfStatement->Else.push_back(newLastIfStatement);
-            lastIfStatement = newLastIfStatement;
         }
+        lastIfStatement = newLastIfStatement;
     }
     if (root == nullptr) {
         return false;
     }
-    bool success = root->compile(result, compilationError);
-    delete root;
-    return success;
+    return root->compile(result, compilationError);
 }
 
-bool plasma::ast::WhileStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::WhileStatement::compile(vm::instruction_list *result,
                                           plasma::error::error *compilationError) {
-    std::vector<plasma::vm::instruction> condition;
+    plasma::vm::instruction_list condition;
     if (!this->Condition->compile_and_push(true, &condition, compilationError)) {
         return false;
     }
@@ -895,7 +1010,7 @@ bool plasma::ast::WhileStatement::compile(std::vector<vm::instruction> *result,
                     .value = static_cast<size_t>(1)
             }
     );
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
     if (!compile_body(this->Body, &body, compilationError)) {
         return false;
     }
@@ -911,9 +1026,9 @@ bool plasma::ast::WhileStatement::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::UntilStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::UntilStatement::compile(vm::instruction_list *result,
                                           plasma::error::error *compilationError) {
-    std::vector<plasma::vm::instruction> condition;
+    plasma::vm::instruction_list condition;
     if (!this->Condition->compile_and_push(true, &condition, compilationError)) {
         return false;
     }
@@ -923,7 +1038,7 @@ bool plasma::ast::UntilStatement::compile(std::vector<vm::instruction> *result,
                     .value = static_cast<size_t>(1)
             }
     );
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
     if (!compile_body(this->Body, &body, compilationError)) {
         return false;
     }
@@ -940,9 +1055,9 @@ bool plasma::ast::UntilStatement::compile(std::vector<vm::instruction> *result,
 
 }
 
-bool plasma::ast::DoWhileStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::DoWhileStatement::compile(vm::instruction_list *result,
                                             plasma::error::error *compilationError) {
-    std::vector<plasma::vm::instruction> condition;
+    plasma::vm::instruction_list condition;
     if (!this->Condition->compile_and_push(true, &condition, compilationError)) {
         return false;
     }
@@ -952,7 +1067,7 @@ bool plasma::ast::DoWhileStatement::compile(std::vector<vm::instruction> *result
                     .value = static_cast<size_t>(1)
             }
     );
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
     if (!compile_body(this->Body, &body, compilationError)) {
         return false;
     }
@@ -968,7 +1083,7 @@ bool plasma::ast::DoWhileStatement::compile(std::vector<vm::instruction> *result
     return true;
 }
 
-bool plasma::ast::RedoStatement::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+bool plasma::ast::RedoStatement::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
     result->push_back(
             plasma::vm::instruction{
                     .op_code = plasma::vm::RedoOP,
@@ -977,7 +1092,7 @@ bool plasma::ast::RedoStatement::compile(std::vector<vm::instruction> *result, p
     return true;
 }
 
-bool plasma::ast::ContinueStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::ContinueStatement::compile(vm::instruction_list *result,
                                              plasma::error::error *compilationError) {
     result->push_back(
             plasma::vm::instruction{
@@ -987,7 +1102,7 @@ bool plasma::ast::ContinueStatement::compile(std::vector<vm::instruction> *resul
     return true;
 }
 
-bool plasma::ast::BreakStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::BreakStatement::compile(vm::instruction_list *result,
                                           plasma::error::error *compilationError) {
     result->push_back(
             plasma::vm::instruction{
@@ -997,7 +1112,7 @@ bool plasma::ast::BreakStatement::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::PassStatement::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+bool plasma::ast::PassStatement::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
     result->push_back(
             plasma::vm::instruction{
                     .op_code = plasma::vm::NOP,
@@ -1006,7 +1121,7 @@ bool plasma::ast::PassStatement::compile(std::vector<vm::instruction> *result, p
     return true;
 }
 
-bool plasma::ast::RaiseStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::RaiseStatement::compile(vm::instruction_list *result,
                                           plasma::error::error *compilationError) {
     if (!this->X->compile_and_push(true, result, compilationError)) {
         return false;
@@ -1019,9 +1134,9 @@ bool plasma::ast::RaiseStatement::compile(std::vector<vm::instruction> *result,
     return true;
 }
 
-bool plasma::ast::ModuleStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::ModuleStatement::compile(vm::instruction_list *result,
                                            plasma::error::error *compilationError) {
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
     if (!compile_body(this->Body, &body, compilationError)) {
         return false;
     }
@@ -1029,23 +1144,23 @@ bool plasma::ast::ModuleStatement::compile(std::vector<vm::instruction> *result,
             plasma::vm::instruction{
                     .op_code = plasma::vm::NewModuleOP,
                     .value = plasma::vm::class_information{
-                            .name = this->Name->Token.string,
+                            .name = std::string(this->Name->Token.string),
                             .bodyLength = body.size()
                     }
             }
     );
-    result->insert(result->end(), body.begin(), body.end());
+    result->append(std::move(body));
     return true;
 }
 
-bool plasma::ast::InterfaceStatement::compile(std::vector<vm::instruction> *result,
+bool plasma::ast::InterfaceStatement::compile(vm::instruction_list *result,
                                               plasma::error::error *compilationError) {
     for (Expression *base : this->Bases) {
         if (!base->compile_and_push(true, result, compilationError)) {
             return false;
         }
     }
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
     for (FunctionDefinitionStatement *function : this->MethodDefinitions) {
         if (!compile_class_function_definition(function, &body, compilationError)) {
             return false;
@@ -1056,28 +1171,28 @@ bool plasma::ast::InterfaceStatement::compile(std::vector<vm::instruction> *resu
             plasma::vm::instruction{
                     .op_code = plasma::vm::NewInterfaceOP,
                     .value = plasma::vm::class_information{
-                            .name = this->Name->Token.string,
+                            .name = std::string(this->Name->Token.string),
                             .bodyLength = body.size(),
                             .numberOfBases = this->Bases.size()
                     }
             }
     );
-    result->insert(result->end(), body.begin(), body.end());
+    result->append(std::move(body));
     return true;
 }
 
-bool plasma::ast::ForStatement::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+bool plasma::ast::ForStatement::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
     if (!this->Source->compile_and_push(true, result, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> body;
+    plasma::vm::instruction_list body;
     if (!compile_body(this->Body, &body, compilationError)) {
         return false;
     }
     std::vector<std::string> receivers;
     receivers.reserve(this->Receivers.size());
     for (Identifier *receiver : this->Receivers) {
-        receivers.push_back(receiver->Token.string);
+        receivers.emplace_back(receiver->Token.string);
     }
     result->push_back(
             plasma::vm::instruction{
@@ -1091,22 +1206,22 @@ bool plasma::ast::ForStatement::compile(std::vector<vm::instruction> *result, pl
     return true;
 }
 
-bool plasma::ast::TryStatement::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
-    std::vector<plasma::vm::instruction> body;
+bool plasma::ast::TryStatement::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
+    plasma::vm::instruction_list body;
     if (!compile_body(this->Body, &body, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> elseBody;
+    plasma::vm::instruction_list elseBody;
     if (!compile_body(this->Else, &elseBody, compilationError)) {
         return false;
     }
-    std::vector<plasma::vm::instruction> finally;
+    plasma::vm::instruction_list finally;
     if (!compile_body(this->Finally, &finally, compilationError)) {
         return false;
     }
     std::vector<plasma::vm::except_block> exceptBlocks;
     for (ExceptBlock *exceptBlock : this->ExceptBlocks) {
-        std::vector<plasma::vm::instruction> exceptTargets;
+        plasma::vm::instruction_list exceptTargets;
         if (!exceptBlock->Targets->compile_and_push(true, &exceptTargets, compilationError)) {
             return false;
         }
@@ -1116,7 +1231,7 @@ bool plasma::ast::TryStatement::compile(std::vector<vm::instruction> *result, pl
                         .value = static_cast<size_t>(1)
                 }
         );
-        std::vector<plasma::vm::instruction> exceptBody;
+        plasma::vm::instruction_list exceptBody;
         if (!compile_body(exceptBlock->Body, &exceptBody, compilationError)) {
             return false;
         }
@@ -1150,17 +1265,17 @@ bool plasma::ast::TryStatement::compile(std::vector<vm::instruction> *result, pl
 }
 
 bool
-plasma::ast::BeginStatement::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+plasma::ast::BeginStatement::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
     return compile_body(this->Body, result, compilationError);
 }
 
 bool
-plasma::ast::EndStatement::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+plasma::ast::EndStatement::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
     return compile_body(this->Body, result, compilationError);
 }
 
 bool
-plasma::ast::Program::compile(std::vector<vm::instruction> *result, plasma::error::error *compilationError) {
+plasma::ast::Program::compile(vm::instruction_list *result, plasma::error::error *compilationError) {
     if (this->Begin != nullptr) {
         if (!this->Begin->compile(result, compilationError)) {
             return false;
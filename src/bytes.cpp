@@ -1,459 +1,273 @@
 #include "vm/virtual_machine.h"
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::bytes_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                Add,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Bytes) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    right->get_type(c, this),
-                                                    std::vector<std::string>{BytesName}
-                                            );
-                                        }
-                                        std::vector<uint8_t> result;
-                                        result.reserve(self->bytes.size() + right->bytes.size());
-                                        result.insert(result.end(), self->bytes.begin(), self->bytes.end());
-                                        result.insert(result.end(), right->bytes.begin(), right->bytes.end());
+namespace plasma::vm {
+    static value *bytes_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Bytes) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    right->get_type(c, vm),
+                    std::vector<std::string>{BytesName}
+            );
+        }
+        std::vector<uint8_t> result;
+        result.reserve(self->bytes.size() + right->bytes.size());
+        result.insert(result.end(), self->bytes.begin(), self->bytes.end());
+        result.insert(result.end(), right->bytes.begin(), right->bytes.end());
 
-                                        (*success) = true;
-                                        return this->new_bytes(c, false, result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightAdd,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Bytes) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    left->get_type(c, this),
-                                                    std::vector<std::string>{BytesName}
-                                            );
-                                        }
-                                        std::vector<uint8_t> result;
-                                        result.reserve(left->bytes.size() + self->bytes.size());
-                                        result.insert(result.end(), left->bytes.begin(), left->bytes.end());
-                                        result.insert(result.end(), self->bytes.begin(), self->bytes.end());
+        (*success) = true;
+        return vm->new_bytes(c, false, std::move(result));
+    }
 
-                                        (*success) = true;
-                                        return this->new_bytes(c, false, result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Mul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Integer) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    right->get_type(c, this),
-                                                    std::vector<std::string>{IntegerName}
-                                            );
-                                        }
-                                        std::vector<uint8_t> repeatedContent;
-                                        value *multiplicationError = plasma::vm::virtual_machine::bytes_repeat(
-                                                self,
-                                                std::abs(right->integer),
-                                                &repeatedContent
-                                        );
-                                        if (multiplicationError != nullptr) {
-                                            (*success) = false;
-                                            return multiplicationError;
-                                        }
-                                        if (right->integer < 0) {
-                                            std::reverse(repeatedContent.begin(), repeatedContent.end());
-                                        }
-                                        (*success) = true;
-                                        return this->new_bytes(c, false, repeatedContent);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightMul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Integer) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    left->get_type(c, this),
-                                                    std::vector<std::string>{IntegerName}
-                                            );
-                                        }
-                                        std::vector<uint8_t> repeatedContent;
-                                        value *multiplicationError = plasma::vm::virtual_machine::bytes_repeat(
-                                                self,
-                                                std::abs(left->integer),
-                                                &repeatedContent
-                                        );
-                                        if (multiplicationError != nullptr) {
-                                            (*success) = false;
-                                            return multiplicationError;
-                                        }
-                                        if (left->integer < 0) {
-                                            std::reverse(repeatedContent.begin(), repeatedContent.end());
-                                        }
-                                        (*success) = true;
-                                        return this->new_bytes(c, false, repeatedContent);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Bytes) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = plasma::vm::virtual_machine::bytes_equals(
-                                                self,
-                                                right,
-                                                &comparison
-                                        );
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Bytes) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = plasma::vm::virtual_machine::bytes_equals(
-                                                left,
-                                                self,
-                                                &comparison
-                                        );
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Bytes) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = plasma::vm::virtual_machine::bytes_equals(
-                                                self,
-                                                right,
-                                                &comparison
-                                        );
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Bytes) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = plasma::vm::virtual_machine::bytes_equals(
-                                                left,
-                                                self,
-                                                &comparison
-                                        );
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Contains,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *element = arguments[0];
-                                        bool contains = false;
-                                        value *containsError = this->bytes_contains(
-                                                c,
-                                                self,
-                                                element,
-                                                &contains
-                                        );
-                                        if (containsError != nullptr) {
-                                            (*success) = false;
-                                            return containsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, contains);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        if (self->hash == 0) {
-                                            self->hash = this->hash_bytes(self->bytes);
-                                        }
-                                        (*success) = true;
-                                        return this->new_integer(c, false, self->hash);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Copy,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_bytes(c, false, self->bytes);
-                                    }
-                            )
-                    );
-                }
+    static value *
+    bytes_right_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Bytes) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    left->get_type(c, vm),
+                    std::vector<std::string>{BytesName}
+            );
+        }
+        std::vector<uint8_t> result;
+        result.reserve(left->bytes.size() + self->bytes.size());
+        result.insert(result.end(), left->bytes.begin(), left->bytes.end());
+        result.insert(result.end(), self->bytes.begin(), self->bytes.end());
+
+        (*success) = true;
+        return vm->new_bytes(c, false, std::move(result));
+    }
+
+    static value *bytes_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Integer) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    right->get_type(c, vm),
+                    std::vector<std::string>{IntegerName}
+            );
+        }
+        std::vector<uint8_t> repeatedContent;
+        value *multiplicationError = plasma::vm::virtual_machine::bytes_repeat(
+                self,
+                std::abs(right->integer),
+                &repeatedContent
         );
-        object->set_on_demand_symbol(
-                Index,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->bytes_index(c, self, arguments[0], success);
-                                    }
-                            )
-                    );
-                }
+        if (multiplicationError != nullptr) {
+            (*success) = false;
+            return multiplicationError;
+        }
+        if (right->integer < 0) {
+            std::reverse(repeatedContent.begin(), repeatedContent.end());
+        }
+        (*success) = true;
+        return vm->new_bytes(c, false, std::move(repeatedContent));
+    }
+
+    static value *
+    bytes_right_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Integer) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    left->get_type(c, vm),
+                    std::vector<std::string>{IntegerName}
+            );
+        }
+        std::vector<uint8_t> repeatedContent;
+        value *multiplicationError = plasma::vm::virtual_machine::bytes_repeat(
+                self,
+                std::abs(left->integer),
+                &repeatedContent
         );
-        object->set_on_demand_symbol(
-                Iter,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->bytes_iterator(c, self);
-                                    }
-                            )
-                    );
-                }
+        if (multiplicationError != nullptr) {
+            (*success) = false;
+            return multiplicationError;
+        }
+        if (left->integer < 0) {
+            std::reverse(repeatedContent.begin(), repeatedContent.end());
+        }
+        (*success) = true;
+        return vm->new_bytes(c, false, std::move(repeatedContent));
+    }
+
+    static value *bytes_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Bytes) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = plasma::vm::virtual_machine::bytes_equals(
+                self,
+                right,
+                &comparison
         );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, comparison);
+    }
 
-                                        (*success) = true;
-                                        return this->bytes_to_string(c, self);
-                                    }
-                            )
-                    );
-                }
+    static value *
+    bytes_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Bytes) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = plasma::vm::virtual_machine::bytes_equals(
+                left,
+                self,
+                &comparison
         );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->get_boolean(c, !self->bytes.empty());
-                                    }
-                            )
-                    );
-                }
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, comparison);
+    }
+
+    static value *
+    bytes_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Bytes) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = plasma::vm::virtual_machine::bytes_equals(
+                self,
+                right,
+                &comparison
         );
-        object->set_on_demand_symbol(
-                ToArray,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_array(c, false, this->bytes_to_integer_content(c, self));
-                                    }
-                            )
-                    );
-                }
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !comparison);
+    }
+
+    static value *
+    bytes_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Bytes) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = plasma::vm::virtual_machine::bytes_equals(
+                left,
+                self,
+                &comparison
         );
-        object->set_on_demand_symbol(
-                ToTuple,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_tuple(c, false, this->bytes_to_integer_content(c, self));
-                                    }
-                            )
-                    );
-                }
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !comparison);
+    }
+
+    static value *
+    bytes_contains(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *element = arguments[0];
+        bool contains = false;
+        value *containsError = vm->bytes_contains(
+                c,
+                self,
+                element,
+                &contains
         );
+        if (containsError != nullptr) {
+            (*success) = false;
+            return containsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, contains);
+    }
+
+    static value *bytes_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        if (self->bytes.cached_hash() == 0) {
+            self->bytes.cache_hash(vm->hash_bytes(self->bytes.span()));
+        }
+        (*success) = true;
+        return vm->new_integer(c, false, self->bytes.cached_hash());
+    }
+
+    static value *bytes_copy(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_bytes(c, false, self->bytes);
+    }
+
+    static value *bytes_index(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->bytes_index(c, self, arguments[0], success);
+    }
+
+    static value *bytes_iter(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->bytes_iterator(c, self);
+    }
+
+    static value *
+    bytes_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->bytes_to_string(c, self);
+    }
+
+    static value *bytes_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->get_boolean(c, !self->bytes.empty());
+    }
+
+    static value *
+    bytes_to_array(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_array(c, false, shared_content(IntegerContent,
+                                                      std::vector<int64_t>(self->bytes.begin(), self->bytes.end())));
+    }
+
+    static value *
+    bytes_to_tuple(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_tuple(c, false, vm->bytes_to_integer_content(c, self));
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::bytes_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Add, {1, bytes_add}},
+            {RightAdd, {1, bytes_right_add}},
+            {Mul, {1, bytes_mul}},
+            {RightMul, {1, bytes_right_mul}},
+            {Equals, {1, bytes_equals}},
+            {RightEquals, {1, bytes_right_equals}},
+            {NotEquals, {1, bytes_not_equals}},
+            {RightNotEquals, {1, bytes_right_not_equals}},
+            {Contains, {1, bytes_contains}},
+            {Hash, {0, bytes_hash}},
+            {Copy, {0, bytes_copy}},
+            {Index, {1, bytes_index}},
+            {Iter, {0, bytes_iter}},
+            {ToString, {0, bytes_to_string}},
+            {ToBool, {0, bytes_to_bool}},
+            {ToArray, {0, bytes_to_array}},
+            {ToTuple, {0, bytes_to_tuple}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::bytes_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &bytes_methods();
         return nullptr;
     };
 }
\ No newline at end of file
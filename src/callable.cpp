@@ -2,7 +2,7 @@
 
 #include "vm/virtual_machine.h"
 
-plasma::vm::callable plasma::vm::new_plasma_callable(size_t number_of_arguments, std::vector<instruction> code) {
+plasma::vm::callable plasma::vm::new_plasma_callable(size_t number_of_arguments, instruction_list code) {
     return callable{
             .isBuiltIn = false,
             .numberOfArguments = number_of_arguments,
@@ -18,27 +18,42 @@ plasma::vm::callable plasma::vm::new_builtin_callable(size_t number_of_arguments
     };
 }
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::callable_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                Call,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [=](value *self, const std::vector<value *> &arguments, bool *success) -> value * {
-                                        return this->new_not_implemented_callable_error(
-                                                c,
-                                                Call
-                                        );
-                                    }
-                            )
-                    );
-                }
+plasma::vm::callable plasma::vm::new_native_callable(size_t number_of_arguments, native_function function) {
+    return callable{
+            .isBuiltIn = true,
+            .numberOfArguments = number_of_arguments,
+            .native = function,
+    };
+}
+
+plasma::vm::native_registry
+plasma::vm::inherit_methods(const native_registry &base, const native_registry &methods) {
+    native_registry result = base;
+    for (const auto &method : methods) {
+        result[method.first] = method.second;
+    }
+    return result;
+}
+
+namespace plasma::vm {
+    static value *callable_call(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->new_not_implemented_callable_error(
+                c,
+                Call
         );
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::callable_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Call, {0, callable_call}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::callable_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &callable_methods();
         return nullptr;
     };
 }
\ No newline at end of file
@@ -1,31 +1,146 @@
+#include <algorithm>
+#include <chrono>
+
 #include "vm/virtual_machine.h"
 
-plasma::vm::context::context(size_t initialPageLength) {
-    if (initialPageLength == 0) {
+// Length of the page served once the maximum heap size is reached, enough to build the MemoryError
+const size_t MemoryReservePageLength = 32;
+
+plasma::vm::context::context(size_t initialPageLength) :
+        context(heap_configuration{.initialPageLength = initialPageLength}) {
+}
+
+plasma::vm::context::context(const heap_configuration &heapConfiguration) {
+    if (heapConfiguration.initialPageLength == 0) {
         throw std::out_of_range("initialPageLength can't be zero");
     }
-    this->symbol_table_heap = memory::memory<symbol_table>(initialPageLength);
-    this->value_heap = memory::memory<value>(initialPageLength);
+    if (heapConfiguration.growthFactor < 1) {
+        throw std::out_of_range("growthFactor can't be less than one");
+    }
+    this->configuration = heapConfiguration;
+    this->symbol_table_heap = memory::memory<symbol_table>(heapConfiguration.initialPageLength);
+    this->value_heap = memory::memory<value>(heapConfiguration.initialPageLength);
 }
 
 plasma::vm::context::~context() {
     this->objectsInUse.clear();
     this->symbol_table_stack.clear();
+    this->frames.clear();
     this->value_stack.clear();
     this->master->symbols.clear();
 }
 
+template<typename T>
+static size_t heap_slots_size(const memory::memory<T> &heap) {
+    size_t result = 0;
+    for (const auto &keyValue : heap.pages) {
+        result += keyValue.second->length;
+    }
+    return result * sizeof(T);
+}
+
+size_t plasma::vm::context::heap_size() const {
+    return heap_slots_size(this->value_heap) + heap_slots_size(this->symbol_table_heap) + this->payloadBytes;
+}
+
+size_t plasma::vm::context::memory_reserve_size() const {
+    // One reserve page of each kind, plus room for the buffers made by the instruction that crossed the limit
+    return MemoryReservePageLength * (sizeof(value) + sizeof(symbol_table)) +
+           this->configuration.maximumHeapSize / 8;
+}
+
+void plasma::vm::context::charge_payload(size_t bytes) {
+    this->payloadBytes += bytes;
+    this->payloadBytesSinceCollection += bytes;
+}
+
+// Buffers shared by several values are split between them, so the sum over the heap counts every buffer once
+static size_t payload_size(const plasma::vm::value *v) {
+    return v->string.shared_memory_usage() + v->bytes.shared_memory_usage() + v->content.shared_memory_usage() +
+           v->keyValues.memory_usage();
+}
+
+// Raise the MemoryError past maximumHeapSize and stop the script once the reserve past it is spent too
+static void check_heap_limit(plasma::vm::context *c) {
+    if (c->configuration.maximumHeapSize == 0) {
+        return;
+    }
+    size_t heapSize = c->heap_size();
+    if (heapSize > c->configuration.maximumHeapSize + c->memory_reserve_size()) {
+        c->memoryFatal = true;
+        throw plasma::vm::memory_reserve_exhausted();
+    }
+    // One MemoryError each time the heap goes past the limit, handling it may still use the reserve
+    if (heapSize <= c->configuration.maximumHeapSize) {
+        c->overMemoryLimit = false;
+    } else if (!c->overMemoryLimit) {
+        c->overMemoryLimit = true;
+        c->memoryExhausted = true;
+    }
+}
+
+bool plasma::vm::context::source_position(size_t *line, size_t *column) const {
+    // Frames that did not reach a positioned instruction yet were entered from the position of their caller
+    for (auto f = this->frames.rbegin(); f != this->frames.rend(); f++) {
+        if (f->code != nullptr && f->index > 0 && f->code->lines.find(f->index - 1, line, column)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T>
+static void grow_heap(plasma::vm::context *c, memory::memory<T> *heap) {
+    auto newPageLength = static_cast<size_t>(
+            static_cast<double>(heap->max_page_length()) * c->configuration.growthFactor
+    );
+    newPageLength = std::max(newPageLength, std::max(c->configuration.initialPageLength,
+                                                     c->configuration.nurserySize));
+    if (c->configuration.maximumHeapSize != 0) {
+        size_t heapSize = c->heap_size();
+        size_t available = 0;
+        if (heapSize < c->configuration.maximumHeapSize) {
+            available = (c->configuration.maximumHeapSize - heapSize) / sizeof(T);
+        }
+        if (available == 0) {
+            if (heapSize + MemoryReservePageLength * sizeof(T) > c->configuration.maximumHeapSize + c->memory_reserve_size()) {
+                // The reserve is spent too, scripts that keep catching the MemoryError can not grow the heap further
+                c->memoryFatal = true;
+                throw plasma::vm::memory_reserve_exhausted();
+            }
+            // Serve the allocation from a reserve page and let the interpreter raise the MemoryError
+            if (!c->overMemoryLimit) {
+                c->overMemoryLimit = true;
+                c->memoryExhausted = true;
+            }
+            newPageLength = MemoryReservePageLength;
+        } else {
+            newPageLength = std::min(newPageLength, available);
+        }
+    }
+    heap->new_page(newPageLength);
+}
+
 plasma::vm::value *plasma::vm::context::allocate_value() {
+    if (this->memoryFatal) {
+        throw memory_reserve_exhausted();
+    }
+    bool collectionRequested = this->configuration.collectionThreshold != 0 &&
+                               this->bytesSinceCollection >= this->configuration.collectionThreshold;
+    // Buffers made since the last collection took the heap past its limit, find out how much of it is still alive
+    bool overLimit = this->configuration.maximumHeapSize != 0 && this->payloadBytesSinceCollection != 0 &&
+                     this->heap_size() > this->configuration.maximumHeapSize;
     // Check if there is space to allocate the object
-    if (this->value_heap.empty()) {
+    if (collectionRequested || overLimit || this->value_heap.empty()) {
         // If no space if available, collect garbage
         this->collect_values();
+        check_heap_limit(this);
         // If there is still no space, allocate a new page
         if (this->value_heap.empty()) {
-            auto newPageLength = this->value_heap.max_page_length() * 2;
-            this->value_heap.new_page(newPageLength);
+            grow_heap(this, &this->value_heap);
         }
     }
+    this->bytesSinceCollection += sizeof(value);
     auto resultPage = this->value_heap.allocate();
     value *result = resultPage.object;
     // Reset the object
@@ -33,20 +148,32 @@ plasma::vm::value *plasma::vm::context::allocate_value() {
     //
     result->pageIndex = resultPage.page_index;
     result->isSet = true;
+    // Statistics
+    this->statistics.allocatedValues++;
+    if (this->statistics.samplingInterval != 0 &&
+        this->statistics.allocatedValues % this->statistics.samplingInterval == 0) {
+        size_t line = 0;
+        size_t column = 0;
+        this->source_position(&line, &column);
+        this->statistics.allocationSites[line]++;
+    }
     return result;
 }
 
 plasma::vm::symbol_table *plasma::vm::context::allocate_symbol_table(vm::symbol_table *parentSymbolTable) {
+    if (this->memoryFatal) {
+        throw memory_reserve_exhausted();
+    }
     // Check if there is space to allocate the object
     if (this->symbol_table_heap.empty()) {
         // If no space if available, collect garbage
         this->collect_symbol_tables();
         // If there is still no space, allocate a new page
         if (this->symbol_table_heap.empty()) {
-            auto newPageLength = this->symbol_table_heap.max_page_length() * 2;
-            this->symbol_table_heap.new_page(newPageLength);
+            grow_heap(this, &this->symbol_table_heap);
         }
     }
+    this->bytesSinceCollection += sizeof(symbol_table);
     auto resultPage = this->symbol_table_heap.allocate();
     symbol_table *result = resultPage.object;
     // Reset the object
@@ -70,6 +197,7 @@ plasma::vm::symbol_table *plasma::vm::context::allocate_symbol_table(vm::symbol_
     //
     result->pageIndex = resultPage.page_index;
     result->isSet = true;
+    this->statistics.allocatedSymbolTables++;
     return result;
 }
 
@@ -96,14 +224,15 @@ static void mark(plasma::vm::value *v) {
     for (const auto &sym : v->symbols->symbols) {
         mark(sym.second);
     }
-    for (auto arrayValue : v->content) {
-        mark(arrayValue);
+    // Packed content holds no values
+    if (!v->content.packed()) {
+        for (auto arrayValue : v->content) {
+            mark(arrayValue);
+        }
     }
     for (const auto &kValue : v->keyValues) {
-        for (auto kvEntry: kValue.second) {
-            mark(kvEntry.key);
-            mark(kvEntry.value);
-        }
+        mark(kValue.key);
+        mark(kValue.value);
     }
     mark(v->type);
     for (auto arrayValue : v->subTypes) {
@@ -120,8 +249,10 @@ void plasma::vm::context::collect_values() {
      * - Last Object
      * - Objects in the stack
      * - Objects in the symbol tables that are in the symbol table stack
+     * - Objects referenced by the frames
      * - ...?
      */
+    auto markStart = std::chrono::steady_clock::now();
     for (const auto &v : this->objectsInUse) {
         mark(v);
     }
@@ -129,6 +260,7 @@ void plasma::vm::context::collect_values() {
         mark(keyValue.second);
     }
     mark(this->lastObject);
+    mark(this->fatalMemoryError);
     for (auto v : this->value_stack) {
         mark(v);
     }
@@ -137,8 +269,18 @@ void plasma::vm::context::collect_values() {
             mark(sym.second);
         }
     }
-    std::vector<size_t> toRemove;
-    toRemove.reserve(this->value_heap.pages.size());
+    for (const auto &f : this->frames) {
+        mark(f.function);
+        mark(f.constructed);
+        mark(f.module);
+        mark(f.source);
+        mark(f.hasNext);
+        mark(f.next);
+        mark(f.nextValue);
+        mark(f.error);
+        mark(f.pendingObject);
+    }
+    auto sweepStart = std::chrono::steady_clock::now();
     // Collect all not marked values
     for (const auto &keyValue: this->value_heap.pages) {
         for (size_t index = 0; index < keyValue.second->length; index++) {
@@ -151,12 +293,40 @@ void plasma::vm::context::collect_values() {
                 continue;
             }
             v->isSet = false;
+            // Release the payloads now instead of when the slot is reused, so the buffers they share with live values
+            // stop being copied on write and dead values keep no memory outside the heap alive
+            v->string = immutable_string();
+            v->bytes = immutable_bytes();
+            v->content = shared_content();
+            v->keyValues.clear();
             // Object was destroyed, decrement count of its symbol table
             v->symbols->count--;
             this->value_heap.deallocate(v->pageIndex, v);
+            this->statistics.collectedValues++;
         }
     }
     this->value_heap.shrink();
+    // Count the buffers once the dead values released theirs, so the shares of the survivors are complete
+    this->payloadBytes = 0;
+    for (const auto &keyValue: this->value_heap.pages) {
+        for (size_t index = 0; index < keyValue.second->length; index++) {
+            value *v = keyValue.second->index(index);
+            if (v->isSet) {
+                this->payloadBytes += payload_size(v);
+            }
+        }
+    }
+    this->payloadBytesSinceCollection = 0;
+    this->bytesSinceCollection = 0;
+    auto sweepEnd = std::chrono::steady_clock::now();
+    // Statistics
+    this->statistics.collections++;
+    this->statistics.lastMarkNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            sweepStart - markStart).count();
+    this->statistics.lastSweepNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            sweepEnd - sweepStart).count();
+    this->statistics.totalMarkNanoseconds += this->statistics.lastMarkNanoseconds;
+    this->statistics.totalSweepNanoseconds += this->statistics.lastSweepNanoseconds;
 }
 
 void plasma::vm::context::collect_symbol_tables() {
@@ -169,12 +339,14 @@ void plasma::vm::context::collect_symbol_tables() {
                 if (symbolTable->count == 0 && symbolTable->isSet) {
                     symbolTable->isSet = false;
                     this->symbol_table_heap.deallocate(symbolTable->pageIndex, symbolTable);
+                    this->statistics.collectedSymbolTables++;
                     collected = true;
                 }
             }
         }
     } while (collected);
     this->symbol_table_heap.shrink();
+    this->statistics.symbolTableCollections++;
 }
 
 void plasma::vm::context::push_value(value *v) {
@@ -209,6 +381,28 @@ plasma::vm::symbol_table *plasma::vm::context::peek_symbol_table() {
     return this->symbol_table_stack.back();
 }
 
+void plasma::vm::context::push_frame(const frame &f) {
+    if (f.kind == FunctionFrame) {
+        this->callDepth++;
+    }
+    this->frames.push_back(f);
+}
+
+plasma::vm::frame &plasma::vm::context::peek_frame() {
+    return this->frames.back();
+}
+
+void plasma::vm::context::pop_frame() {
+    const frame &top = this->frames.back();
+    if (top.ownsSymbolTable) {
+        this->pop_symbol_table();
+    }
+    if (top.kind == FunctionFrame) {
+        this->callDepth--;
+    }
+    this->frames.pop_back();
+}
+
 void plasma::vm::context::protect_value(value *v) {
     this->objectsInUse.push_back(v);
 }
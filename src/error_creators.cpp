@@ -142,3 +142,47 @@ plasma::vm::virtual_machine::new_object_not_callable_error(plasma::vm::context *
     return result;
 }
 
+
+
+plasma::vm::value *plasma::vm::virtual_machine::new_memory_error(plasma::vm::context *c) {
+    auto state = c->protected_values_state();
+    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+
+    value *errorType = this->force_any_from_master(c, MemoryError);
+    value *result = this->force_construction(c, errorType);
+    c->protect_value(result);
+    this->force_initialization(c, result, std::vector<value *>{
+            this->new_string(c, false, "maximum heap size of " +
+                                       std::to_string(c->configuration.maximumHeapSize) + " bytes reached")
+    });
+    // The error was served from the reserve, from here on the script can handle it
+    c->memoryExhausted = false;
+    return result;
+}
+
+plasma::vm::value *plasma::vm::virtual_machine::new_recursion_error(plasma::vm::context *c, size_t limit) {
+    auto state = c->protected_values_state();
+    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+
+    value *errorType = this->force_any_from_master(c, RecursionError);
+    value *result = this->force_construction(c, errorType);
+    c->protect_value(result);
+    this->force_initialization(c, result, std::vector<value *>{
+            this->new_string(c, false, "maximum recursion depth of " + std::to_string(limit) + " exceeded")
+    });
+    return result;
+}
+
+plasma::vm::value *
+plasma::vm::virtual_machine::new_value_error(plasma::vm::context *c, const std::string &message) {
+    auto state = c->protected_values_state();
+    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+
+    value *errorType = this->force_any_from_master(c, ValueError);
+    value *result = this->force_construction(c, errorType);
+    c->protect_value(result);
+    this->force_initialization(c, result, std::vector<value *>{
+            this->new_string(c, false, message)
+    });
+    return result;
+}
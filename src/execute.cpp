@@ -15,7 +15,7 @@ plasma::vm::value *plasma::vm::virtual_machine::new_tuple_op(context *c, size_t
         elements.push_back(c->pop_value());
         c->protect_value(elements.back());
     }
-    c->lastObject = this->new_tuple(c, false, elements);
+    c->lastObject = this->new_tuple(c, false, std::move(elements));
     return nullptr;
 }
 
@@ -33,7 +33,7 @@ plasma::vm::value *plasma::vm::virtual_machine::new_array_op(context *c, size_t
         elements.push_back(c->pop_value());
         c->protect_value(elements.back());
     }
-    c->lastObject = this->new_array(c, false, elements);
+    c->lastObject = this->new_array(c, false, std::move(elements));
     return nullptr;
 }
 
@@ -41,20 +41,23 @@ plasma::vm::value *plasma::vm::virtual_machine::new_hash_op(context *c, size_t n
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
 
-    std::unordered_map<value *, value *> elements;
-    elements.reserve(numberOfElements);
-
-    for (size_t index = 0; index < numberOfElements; index++) {
+    // Pairs are popped in reverse order, the table keeps them in the order they were written
+    std::vector<key_value> elements(numberOfElements);
+    for (size_t index = numberOfElements; index > 0; index--) {
         value *key = c->pop_value();
         value *v = c->pop_value();
-        elements[key] = v;
+        elements[index - 1] = key_value{
+                .key = key,
+                .value = v,
+        };
         c->protect_value(key);
         c->protect_value(v);
     }
 
     c->lastObject = this->new_hash_table(c, false);
+    c->lastObject->keyValues.reserve(numberOfElements);
     for (const auto &kValue : elements) {
-        value *addError = c->lastObject->add_key_value(c, this, kValue.first, kValue.second);
+        value *addError = c->lastObject->add_key_value(c, this, kValue.key, kValue.value);
         if (addError != nullptr) {
             return addError;
         }
@@ -62,16 +65,13 @@ plasma::vm::value *plasma::vm::virtual_machine::new_hash_op(context *c, size_t n
     return nullptr;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::new_string_op(context *c, const std::string &string) {
+plasma::vm::value *plasma::vm::virtual_machine::new_string_op(context *c, const immutable_string &string) {
     c->lastObject = this->new_string(c, false, string);
     return nullptr;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::new_bytes_op(context *c, const std::string &bytes) {
-    std::vector<uint8_t> bytesVector;
-    bytesVector.reserve(bytes.size());
-    bytesVector.insert(bytesVector.end(), bytes.begin(), bytes.end());
-    c->lastObject = this->new_bytes(c, false, bytesVector);
+plasma::vm::value *plasma::vm::virtual_machine::new_bytes_op(context *c, const immutable_bytes &bytes) {
+    c->lastObject = this->new_bytes(c, false, bytes);
     return nullptr;
 }
 
@@ -116,7 +116,7 @@ plasma::vm::value *plasma::vm::virtual_machine::unary_op(context *c, uint8_t ins
     }
     c->protect_value(operation);
     bool success = false;
-    value *result = this->call_function(c, operation, std::vector<value *>(), &success);
+    value *result = this->call_function(c, operation, arguments_span(), &success);
     if (success) {
         c->lastObject = result;
         return nullptr;
@@ -233,7 +233,7 @@ plasma::vm::value *plasma::vm::virtual_machine::binary_op(context *c, uint8_t in
     value *operation = leftHandSide->get(c, this, leftHandSideFunction, &found);
     c->protect_value(operation);
     if (found) {
-        result = this->call_function(c, operation, std::vector<value *>{rightHandSide}, &success);
+        result = this->call_function(c, operation, arguments_span(&rightHandSide, 1), &success);
         if (success) {
             c->lastObject = result;
             return nullptr;
@@ -247,7 +247,7 @@ plasma::vm::value *plasma::vm::virtual_machine::binary_op(context *c, uint8_t in
     if (!found) {
         return this->new_object_with_name_not_found_error(c, rightHandSide, rightHandSideFunction);
     }
-    result = this->call_function(c, operation, std::vector<value *>{leftHandSide}, &success);
+    result = this->call_function(c, operation, arguments_span(&leftHandSide, 1), &success);
     if (success) {
         c->lastObject = result;
         return nullptr;
@@ -296,7 +296,7 @@ plasma::vm::value *plasma::vm::virtual_machine::index_op(context *c) {
     }
     c->protect_value(indexFunc);
     success = false;
-    value *result = this->call_function(c, indexFunc, std::vector<value *>{index}, &success);
+    value *result = this->call_function(c, indexFunc, arguments_span(&index, 1), &success);
     if (!success) {
         return result;
     }
@@ -341,7 +341,8 @@ plasma::vm::value *plasma::vm::virtual_machine::assign_index_op(context *c) {
         return assignFunc;
     }
     bool success = false;
-    auto result = this->call_function(c, assignFunc, std::vector<value *>{index, element}, &success);
+    value *assignArguments[] = {index, element};
+    auto result = this->call_function(c, assignFunc, assignArguments, &success);
     c->protect_value(result);
     if (!success) {
         return result;
@@ -350,23 +351,49 @@ plasma::vm::value *plasma::vm::virtual_machine::assign_index_op(context *c) {
 
 }
 
+// Builtin calls with up to this number of arguments don't allocate their argument buffer
+const size_t InlineArguments = 8;
+
 plasma::vm::value *plasma::vm::virtual_machine::method_invocation_op(context *c, size_t numberOfArguments) {
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
 
     value *function = c->pop_value();
     c->protect_value(function);
-    std::vector<value *> arguments;
-    arguments.reserve(numberOfArguments);
+    // The arguments stay on the value stack (the first one on top) until the call returns
+    size_t argumentsBase = c->value_stack.size() - numberOfArguments;
 
-    for (size_t argumentIndex = 0; argumentIndex < numberOfArguments; argumentIndex++) {
-        auto argument = c->pop_value();
-        arguments.push_back(argument);
-        c->protect_value(argument);
-    }
     bool success = false;
-
-    value *result = this->call_function(c, function, arguments, &success);
+    value *constructedObject = nullptr;
+    value *callFunction = this->resolve_callable(c, function, numberOfArguments, &constructedObject, &success);
+    if (!success) {
+        c->value_stack.resize(argumentsBase);
+        return callFunction;
+    }
+    c->protect_value(constructedObject);
+    c->protect_value(callFunction);
+    if (!callFunction->callable_.isBuiltIn) {
+        // Already in the order expected by load_function_arguments_op, the result is left in lastObject by its return
+        value *enterError = this->enter_function(c, callFunction, constructedObject);
+        if (enterError != nullptr) {
+            c->value_stack.resize(argumentsBase);
+        }
+        return enterError;
+    }
+    // Builtins receive them in call order
+    value *inlineArguments[InlineArguments];
+    std::vector<value *> spilledArguments;
+    value **arguments = inlineArguments;
+    if (numberOfArguments > InlineArguments) {
+        spilledArguments.resize(numberOfArguments);
+        arguments = spilledArguments.data();
+    }
+    for (size_t index = 0; index < numberOfArguments; index++) {
+        arguments[index] = c->value_stack[c->value_stack.size() - 1 - index];
+    }
+    value *result = this->call_builtin(c, callFunction, constructedObject,
+                                       arguments_span(arguments, numberOfArguments), &success);
+    c->value_stack.resize(argumentsBase);
     if (!success) {
         return result;
     }
@@ -375,7 +402,7 @@ plasma::vm::value *plasma::vm::virtual_machine::method_invocation_op(context *c,
 }
 
 plasma::vm::value *
-plasma::vm::virtual_machine::new_class_op(context *c, bytecode *bc, const class_information &classInformation) {
+plasma::vm::virtual_machine::new_class_op(context *c, frame *f, const class_information &classInformation) {
 
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
@@ -388,7 +415,7 @@ plasma::vm::virtual_machine::new_class_op(context *c, bytecode *bc, const class_
         bases.push_back(base);
         c->protect_value(base);
     }
-    auto classCode = bc->nextN(classInformation.bodyLength);
+    auto classCode = f->nextN(classInformation.bodyLength);
     c->peek_symbol_table()->set(classInformation.name,
                                 this->new_type(c, false, classInformation.name, bases,
                                                constructor{
@@ -401,13 +428,13 @@ plasma::vm::virtual_machine::new_class_op(context *c, bytecode *bc, const class_
 }
 
 plasma::vm::value *
-plasma::vm::virtual_machine::new_function_op(context *c, bytecode *bc,
+plasma::vm::virtual_machine::new_function_op(context *c, frame *f,
                                              const function_information &functionInformation) {
 
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
 
-    auto functionInstructions = bc->nextN(functionInformation.bodyLength);
+    auto functionInstructions = f->nextN(functionInformation.bodyLength);
     c->peek_symbol_table()->set(
             functionInformation.name,
             this->new_function(
@@ -424,7 +451,7 @@ plasma::vm::virtual_machine::new_function_op(context *c, bytecode *bc,
 }
 
 plasma::vm::value *
-plasma::vm::virtual_machine::new_class_function_op(context *c, bytecode *bc,
+plasma::vm::virtual_machine::new_class_function_op(context *c, frame *f,
                                                    const function_information &functionInformation) {
 
 
@@ -435,7 +462,7 @@ plasma::vm::virtual_machine::new_class_function_op(context *c, bytecode *bc,
 
     c->protect_value(self);
 
-    auto functionInstructions = bc->nextN(functionInformation.bodyLength);
+    auto functionInstructions = f->nextN(functionInformation.bodyLength);
     self->set(
             functionInformation.name,
             this->new_function(
@@ -465,7 +492,6 @@ plasma::vm::value *plasma::vm::virtual_machine::return_op(context *c, size_t num
 
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
-    c->lastState = Return;
     if (numberOfReturnValues == 0) {
         return this->get_none(c);
     } else if (numberOfReturnValues == 1) {
@@ -478,118 +504,66 @@ plasma::vm::value *plasma::vm::virtual_machine::return_op(context *c, size_t num
         content.push_back(returnValue);
         c->protect_value(returnValue);
     }
-    auto result = this->new_tuple(c, false, content);
+    auto result = this->new_tuple(c, false, std::move(content));
     return result;
 }
 
+static void
+push_condition_frame(plasma::vm::context *c, uint8_t kind, const plasma::vm::instruction_list *body) {
+    plasma::vm::frame conditionFrame{
+            .kind = kind
+    };
+    conditionFrame.start(plasma::vm::BodyPhase, body);
+    c->push_frame(conditionFrame);
+}
+
 plasma::vm::value *
 plasma::vm::virtual_machine::if_op(context *c, const condition_information &conditionInformation) {
-    auto state = c->protected_values_state();
-    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
-
     bool isTrue = false;
     auto interpretationError = this->interpret_as_boolean(c, c->pop_value(), &isTrue);
     if (interpretationError != nullptr) {
         return interpretationError;
     }
-    bool success = false;
-    value *result;
-    auto code = bytecode{
-            .index = 0
-    };
-    if (isTrue) {
-        code.instructions = conditionInformation.body;
-    } else {
-        code.instructions = conditionInformation.elseBody;
-    }
-    result = this->execute(c, &code, &success);
-    if (!success) {
-        return result;
-    }
-    c->lastObject = result;
+    push_condition_frame(c, ConditionFrame, isTrue ? &conditionInformation.body : &conditionInformation.elseBody);
     return nullptr;
 }
 
 plasma::vm::value *
 plasma::vm::virtual_machine::unless_op(context *c, const condition_information &conditionInformation) {
-    auto state = c->protected_values_state();
-    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
-
     bool isTrue = false;
     auto interpretationError = this->interpret_as_boolean(c, c->pop_value(), &isTrue);
     if (interpretationError != nullptr) {
         return interpretationError;
     }
-
-    bool success = false;
-    value *result;
-    auto code = bytecode{
-            .index = 0
-    };
-    if (!isTrue) {
-        code.instructions = conditionInformation.body;
-    } else {
-        code.instructions = conditionInformation.elseBody;
-    }
-    result = this->execute(c, &code, &success);
-    if (!success) {
-        return result;
-    }
-    c->lastObject = result;
+    push_condition_frame(c, ConditionFrame, !isTrue ? &conditionInformation.body : &conditionInformation.elseBody);
     return nullptr;
 }
 
 plasma::vm::value *
 plasma::vm::virtual_machine::if_one_liner_op(context *c, const condition_information &conditionInformation) {
-    bool asBool = false;
-    auto interpretationError = this->interpret_as_boolean(c, c->pop_value(), &asBool);
+    bool isTrue = false;
+    auto interpretationError = this->interpret_as_boolean(c, c->pop_value(), &isTrue);
     if (interpretationError != nullptr) {
         return interpretationError;
     }
-    bytecode toExecute{
-            .index = 0
-    };
-    if (asBool) {
-        toExecute.instructions = conditionInformation.body;
-    } else {
-        toExecute.instructions = conditionInformation.elseBody;
-    }
-    bool success;
-    auto result = this->execute(c, &toExecute, &success);
-    if (!success) {
-        return result;
-    }
-    c->lastObject = result;
+    push_condition_frame(c, OneLinerFrame, isTrue ? &conditionInformation.body : &conditionInformation.elseBody);
     return nullptr;
 }
 
 plasma::vm::value *
 plasma::vm::virtual_machine::unless_one_liner_op(context *c, const condition_information &conditionInformation) {
-    bool asBool = false;
-    auto interpretationError = this->interpret_as_boolean(c, c->pop_value(), &asBool);
+    bool isTrue = false;
+    auto interpretationError = this->interpret_as_boolean(c, c->pop_value(), &isTrue);
     if (interpretationError != nullptr) {
         return interpretationError;
     }
-    bytecode toExecute{
-            .index = 0
-    };
-    if (!asBool) {
-        toExecute.instructions = conditionInformation.body;
-    } else {
-        toExecute.instructions = conditionInformation.elseBody;
-    }
-    bool success;
-    auto result = this->execute(c, &toExecute, &success);
-    if (!success) {
-        return result;
-    }
-    c->lastObject = result;
+    push_condition_frame(c, OneLinerFrame, !isTrue ? &conditionInformation.body : &conditionInformation.elseBody);
     return nullptr;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::new_lambda_function_op(context *c, bytecode *bc,
+plasma::vm::value *plasma::vm::virtual_machine::new_lambda_function_op(context *c, frame *f,
                                                                        const function_information &functionInformation) {
-    auto functionInstructions = bc->nextN(functionInformation.bodyLength);
+    auto functionInstructions = f->nextN(functionInformation.bodyLength);
     c->lastObject = this->new_function(
             c,
             false,
@@ -602,12 +576,12 @@ plasma::vm::value *plasma::vm::virtual_machine::new_lambda_function_op(context *
     return nullptr;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::new_generator_op(context *c, bytecode *bc,
+plasma::vm::value *plasma::vm::virtual_machine::new_generator_op(context *c, frame *f,
                                                                  const generator_information &generatorInformation) {
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
 
-    auto operationCode = bc->nextN(generatorInformation.operationLength);
+    auto operationCode = f->nextN(generatorInformation.operationLength);
 
     auto result = new_iterator(c, false);
     c->protect_value(result);
@@ -662,9 +636,9 @@ plasma::vm::value *plasma::vm::virtual_machine::new_generator_op(context *c, byt
                     result,
                     new_builtin_callable(
                             0,
-                            [c, this, hasNext](value *self, const std::vector<value *> &arguments,
+                            [c, this, hasNext](value *self, arguments_span arguments,
                                                bool *success) -> value * {
-                                return this->call_function(c, hasNext, std::vector<value *>{}, success);
+                                return this->call_function(c, hasNext, arguments_span(), success);
                             }
                     )
             )
@@ -679,11 +653,11 @@ plasma::vm::value *plasma::vm::virtual_machine::new_generator_op(context *c, byt
                     new_builtin_callable(
                             0,
                             [c, this, next, operationFunction, generatorInformation](value *self,
-                                                                                     const std::vector<value *> &arguments,
+                                                                                     arguments_span arguments,
                                                                                      bool *success) -> value * {
                                 bool callSuccess;
                                 // Receive the next value
-                                auto nextValue = this->call_function(c, next, std::vector<value *>{}, &callSuccess);
+                                auto nextValue = this->call_function(c, next, arguments_span(), &callSuccess);
                                 if (!callSuccess) {
                                     (*success) = false;
                                     return nextValue;
@@ -691,7 +665,7 @@ plasma::vm::value *plasma::vm::virtual_machine::new_generator_op(context *c, byt
 
                                 // If is only one receiver pass it directly to the operation function
                                 if (generatorInformation.numberOfReceivers == 1) {
-                                    return this->call_function(c, operationFunction, std::vector<value *>{nextValue},
+                                    return this->call_function(c, operationFunction, arguments_span(&nextValue, 1),
                                                                success);
                                 }
                                 // Unpack the values
@@ -729,156 +703,65 @@ plasma::vm::value *plasma::vm::virtual_machine::raise_op(context *c) {
     return raisedError;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::new_module_op(context *c, bytecode *bc,
+plasma::vm::value *plasma::vm::virtual_machine::new_module_op(context *c, frame *f,
                                                               const class_information &moduleInformation) {
-    auto state = c->protected_values_state();
-    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
-
-    auto moduleBody = bc->nextN(moduleInformation.bodyLength);
-    bytecode moduleCode = {
-            .instructions = moduleBody,
-            .index = 0
-    };
-
     auto result = this->new_module(c, false);
-    c->protect_value(result);
+    // The module body is executed directly from the code of the current frame
+    frame moduleFrame{
+            .kind = ModuleFrame,
+            .ownsSymbolTable = true,
+            .code = f->code,
+            .index = f->index,
+            .end = f->index + moduleInformation.bodyLength,
+            .module = result,
+            .moduleInformation = &moduleInformation
+    };
+    f->index += moduleInformation.bodyLength;
 
     c->push_symbol_table(result->symbols);
-
-    bool success = false;
-    auto executionError = this->execute(c, &moduleCode, &success);
-    c->pop_symbol_table();
-
-    if (!success) {
-        return executionError;
-    }
-
-    c->peek_symbol_table()->set(moduleInformation.name, result);
+    c->push_frame(moduleFrame);
     return nullptr;
 }
 
 plasma::vm::value *
 plasma::vm::virtual_machine::execute_try_block(context *c, const try_information &tryBlockInformation) {
-    auto state = c->protected_values_state();
-    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
-
-    bytecode bodyBytecode{
-            .instructions = tryBlockInformation.body,
-            .index =0
+    frame tryFrame{
+            .kind = TryFrame,
+            .tryInformation = &tryBlockInformation
     };
-    bool success = false;
-    auto executionError = this->execute(c, &bodyBytecode, &success);
-    if (success) {
-        if (c->lastState == Return) {
-            c->lastObject = executionError;
-        } else {
-            success = false;
-            bytecode finally{
-                    .instructions  = tryBlockInformation.finally,
-                    .index = 0
-            };
-            auto finallyExecutionResult = this->execute(c, &finally, &success);
-            if (!success) {
-                return finallyExecutionResult;
-            }
-            if (c->lastState == Return) {
-                c->lastObject = finallyExecutionResult;
-            }
-            return nullptr;
-        }
-        return nullptr;
-    }
-    c->protect_value(executionError);
+    tryFrame.start(BodyPhase, &tryBlockInformation.body);
+    c->push_frame(tryFrame);
+    return nullptr;
+}
 
-    for (const except_block &exceptBlock : tryBlockInformation.exceptBlocks) {
-        success = false;
-        bytecode targetsBytecode{
-                .instructions = exceptBlock.targets,
-                .index = 0
-        };
-        auto targets = this->execute(c, &targetsBytecode, &success);
-        if (!success) {
-            return targets;
-        }
-        c->protect_value(targets);
-
-        bool doesContains = targets->content.empty();
-        for (value *v : targets->content) {
-            if (!v->implements(c, this, this->force_any_from_master(c, RuntimeError))) {
-                return this->new_invalid_type_error(c, v->get_type(c, this), std::vector<std::string>{RuntimeError});
-            }
-            if (executionError->get_type(c, this)->implements(c, this, v)) {
-                doesContains = true;
-                break;
-            }
-        }
-        if (!doesContains) {
-            continue;
-        }
-        c->peek_symbol_table()->set(exceptBlock.captureName, executionError);
-        success = false;
-        bytecode exceptBodyBytecode{
-                .instructions = exceptBlock.body,
-                .index= 0
-        };
-        auto exceptExecutionResult = this->execute(c, &exceptBodyBytecode, &success);
-        if (!success) {
-            return exceptExecutionResult;
+plasma::vm::value *
+plasma::vm::virtual_machine::try_match_except(context *c, frame *tryFrame, value *targets, bool *matched) {
+    auto state = c->protected_values_state();
+    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+    c->protect_value(targets);
+
+    const except_block &exceptBlock = tryFrame->tryInformation->exceptBlocks[tryFrame->exceptIndex];
+    bool doesContains = targets->content.empty();
+    for (size_t index = 0; index < targets->content.size(); index++) {
+        value *v = this->content_element(c, targets->content, index);
+        if (!v->implements(c, this, this->force_any_from_master(c, RuntimeError))) {
+            return this->new_invalid_type_error(c, v->get_type(c, this), std::vector<std::string>{RuntimeError});
         }
-        c->protect_value(exceptExecutionResult);
-        if (c->lastState == Return) {
-            c->lastObject = exceptExecutionResult;
-        } else {
-            success = false;
-            bytecode finally{
-                    .instructions  = tryBlockInformation.finally,
-                    .index = 0
-            };
-            auto finallyExecutionResult = this->execute(c, &finally, &success);
-            if (!success) {
-                return finallyExecutionResult;
-            }
-            if (c->lastState == Return) {
-                c->lastObject = finallyExecutionResult;
-            }
-            return nullptr;
+        if (tryFrame->error->get_type(c, this)->implements(c, this, v)) {
+            doesContains = true;
+            break;
         }
-        return nullptr;
     }
-    if (!tryBlockInformation.elseBody.empty()) {
-        success = false;
-        bytecode elseBody{
-                .instructions = tryBlockInformation.elseBody,
-                .index= 0
-        };
-        auto exceptExecutionResult = this->execute(c, &elseBody, &success);
-        if (!success) {
-            return exceptExecutionResult;
-        }
-        c->protect_value(exceptExecutionResult);
-        if (c->lastState == Return) {
-            c->lastObject = exceptExecutionResult;
-        } else {
-            success = false;
-            bytecode finally{
-                    .instructions  = tryBlockInformation.finally,
-                    .index = 0
-            };
-            auto finallyExecutionResult = this->execute(c, &finally, &success);
-            if (!success) {
-                return finallyExecutionResult;
-            }
-            if (c->lastState == Return) {
-                c->lastObject = finallyExecutionResult;
-            }
-            return nullptr;
-        }
+    (*matched) = doesContains;
+    if (!doesContains) {
         return nullptr;
     }
-    return executionError;
+    c->peek_symbol_table()->set(exceptBlock.captureName, tryFrame->error);
+    tryFrame->start(ExceptBodyPhase, &exceptBlock.body);
+    return nullptr;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::for_loop_op(context *c, loop_information loopInformation) {
+plasma::vm::value *plasma::vm::virtual_machine::for_loop_op(context *c, const loop_information &loopInformation) {
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
 
@@ -899,277 +782,156 @@ plasma::vm::value *plasma::vm::virtual_machine::for_loop_op(context *c, loop_inf
     if (!getSuccess) {
         return hasNext;
     }
-    c->protect_value(hasNext);
-
-    auto bodyBytecode = bytecode{
-            .instructions = loopInformation.body,
-            .index = 0
-    };
-    value *doesHasNext;
-    value *nextValue;
-    value *result;
-
-    bool success = false;
-    while (true) {
-        continueState:
 
-        doesHasNext = this->call_function(c, hasNext, std::vector<value *>(), &success);
-        if (!success) {
-            return doesHasNext;
-        }
-        c->protect_value(doesHasNext);
-        bool asBool = false;
-        auto interpretationError = this->interpret_as_boolean(c, doesHasNext, &asBool);
-        if (interpretationError != nullptr) {
-            return interpretationError;
-        }
-        if (!asBool) {
-            break;
-        }
-        nextValue = this->call_function(c, next, std::vector<value *>(), &success);
-        if (!success) {
-            return nextValue;
-        }
-        c->protect_value(nextValue);
-        redoState:
-        std::vector<value *> unpackedValues;
-        if (loopInformation.receivers.size() == 1) {
-            unpackedValues.push_back(nextValue);
-        } else {
-            auto unpackError = this->unpack_values(c, nextValue, loopInformation.receivers.size(), &unpackedValues);
-            if (unpackError != nullptr) {
-                return unpackError;
-            }
-        }
-        if (unpackedValues.size() != loopInformation.receivers.size()) {
-            return this->new_invalid_number_of_arguments_error(c, loopInformation.receivers.size(),
-                                                               unpackedValues.size());
-        }
-        for (size_t index = 0; index < unpackedValues.size(); index++) {
-            c->protect_value(unpackedValues[index]);
-            c->peek_symbol_table()->set(loopInformation.receivers[index], unpackedValues[index]);
-        }
-        bodyBytecode.index = 0;
-        success = false;
-        result = this->execute(c, &bodyBytecode, &success);
-        if (!success) {
-            return result;
-        }
-        switch (c->lastState) {
-            case Return:
-                c->lastObject = result;
-                return nullptr;
-            case Continue:
-                goto continueState;
-                break;
-            case Redo:
-                goto redoState;
-                break;
-            case Break:
-                goto finish;
-                break;
-        }
+    c->push_frame(frame{
+            .kind = ForLoopFrame,
+            .loopInformation = &loopInformation,
+            .source = source,
+            .hasNext = hasNext,
+            .next = next
+    });
+    bool finished = false;
+    value *stepError = this->for_loop_step(c, &c->peek_frame(), &finished);
+    if (stepError != nullptr || finished) {
+        c->pop_frame();
     }
-    finish:
-    c->lastState = NoState;
-    return nullptr;
+    return stepError;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::while_loop_op(context *c, loop_information loopInformation) {
+plasma::vm::value *plasma::vm::virtual_machine::for_loop_step(context *c, frame *loopFrame, bool *finished) {
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
 
-    auto conditionBytecode = bytecode{
-            .instructions = loopInformation.condition,
-            .index = 0
-    };
-    auto bodyBytecode = bytecode{
-            .instructions = loopInformation.body,
-            .index = 0
-    };
-    value *conditionResult;
-    value *result;
     bool success = false;
-
-    while (true) {
-        continueState:
-
-        success = false;
-        conditionBytecode.index = 0;
-        conditionResult = this->execute(c, &conditionBytecode, &success);
-        if (!success) {
-            return conditionResult;
-        }
-        c->protect_value(conditionResult);
-        bool asBool = false;
-        auto interpretationError = this->interpret_as_boolean(c, conditionResult, &asBool);
-        if (interpretationError != nullptr) {
-            return interpretationError;
-        }
-        if (!asBool) {
-            break;
-        }
-
-        redoState:
-        success = false;
-        bodyBytecode.index = 0;
-        result = this->execute(c, &bodyBytecode, &success);
-        if (!success) {
-            return result;
-        }
-        switch (c->lastState) {
-            case Return:
-                c->lastObject = result;
-                return nullptr;
-            case Continue:
-                goto continueState;
-                break;
-            case Redo:
-                goto redoState;
-                break;
-            case Break:
-                goto finish;
-                break;
-        }
+    value *doesHasNext = this->call_function(c, loopFrame->hasNext, arguments_span(), &success);
+    if (!success) {
+        return doesHasNext;
     }
-    finish:
-    c->lastState = NoState;
-    return nullptr;
+    c->protect_value(doesHasNext);
+    bool asBool = false;
+    auto interpretationError = this->interpret_as_boolean(c, doesHasNext, &asBool);
+    if (interpretationError != nullptr) {
+        return interpretationError;
+    }
+    if (!asBool) {
+        (*finished) = true;
+        return nullptr;
+    }
+    value *nextValue = this->call_function(c, loopFrame->next, arguments_span(), &success);
+    if (!success) {
+        return nextValue;
+    }
+    loopFrame->nextValue = nextValue;
+    return this->for_loop_receive(c, loopFrame);
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::until_loop_op(context *c, loop_information loopInformation) {
+plasma::vm::value *plasma::vm::virtual_machine::for_loop_receive(context *c, frame *loopFrame) {
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
 
-    auto conditionBytecode = bytecode{
-            .instructions = loopInformation.condition,
-            .index = 0
-    };
-    auto bodyBytecode = bytecode{
-            .instructions = loopInformation.body,
-            .index = 0
-    };
-    value *conditionResult;
-    value *result;
-    bool success = false;
-
-    while (true) {
-        continueState:
-
-        success = false;
-        conditionBytecode.index = 0;
-        conditionResult = this->execute(c, &conditionBytecode, &success);
-        if (!success) {
-            return conditionResult;
-        }
-        c->protect_value(conditionResult);
-        bool asBool = false;
-        auto interpretationError = this->interpret_as_boolean(c, conditionResult, &asBool);
-        if (interpretationError != nullptr) {
-            return interpretationError;
-        }
-        if (asBool) {
-            break;
-        }
-
-        redoState:
-        success = false;
-        bodyBytecode.index = 0;
-        result = this->execute(c, &bodyBytecode, &success);
-        if (!success) {
-            return result;
-        }
-        switch (c->lastState) {
-            case Return:
-                c->lastObject = result;
-                return nullptr;
-            case Continue:
-                goto continueState;
-                break;
-            case Redo:
-                goto redoState;
-                break;
-            case Break:
-                goto finish;
-                break;
+    const loop_information *loopInformation = loopFrame->loopInformation;
+    std::vector<value *> unpackedValues;
+    if (loopInformation->receivers.size() == 1) {
+        unpackedValues.push_back(loopFrame->nextValue);
+    } else {
+        auto unpackError = this->unpack_values(c, loopFrame->nextValue, loopInformation->receivers.size(),
+                                               &unpackedValues);
+        if (unpackError != nullptr) {
+            return unpackError;
         }
     }
-    finish:
-    c->lastState = NoState;
+    if (unpackedValues.size() != loopInformation->receivers.size()) {
+        return this->new_invalid_number_of_arguments_error(c, loopInformation->receivers.size(),
+                                                           unpackedValues.size());
+    }
+    for (size_t index = 0; index < unpackedValues.size(); index++) {
+        c->protect_value(unpackedValues[index]);
+        c->peek_symbol_table()->set(loopInformation->receivers[index], unpackedValues[index]);
+    }
+    loopFrame->start(BodyPhase, &loopInformation->body);
     return nullptr;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::do_while_loop_op(context *c, loop_information loopInformation) {
-    auto state = c->protected_values_state();
-    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+plasma::vm::value *plasma::vm::virtual_machine::while_loop_op(context *c, const loop_information &loopInformation) {
+    frame loopFrame{
+            .kind = WhileLoopFrame,
+            .loopInformation = &loopInformation
+    };
+    loopFrame.start(ConditionPhase, &loopInformation.condition);
+    c->push_frame(loopFrame);
+    return nullptr;
+}
 
-    auto conditionBytecode = bytecode{
-            .instructions = loopInformation.condition,
-            .index = 0
+plasma::vm::value *plasma::vm::virtual_machine::until_loop_op(context *c, const loop_information &loopInformation) {
+    frame loopFrame{
+            .kind = UntilLoopFrame,
+            .loopInformation = &loopInformation
     };
-    auto bodyBytecode = bytecode{
-            .instructions = loopInformation.body,
-            .index = 0
+    loopFrame.start(ConditionPhase, &loopInformation.condition);
+    c->push_frame(loopFrame);
+    return nullptr;
+}
+
+plasma::vm::value *
+plasma::vm::virtual_machine::do_while_loop_op(context *c, const loop_information &loopInformation) {
+    frame loopFrame{
+            .kind = DoWhileLoopFrame,
+            .loopInformation = &loopInformation
     };
-    value *conditionResult;
-    value *result;
-    bool success = false;
+    loopFrame.start(BodyPhase, &loopInformation.body);
+    c->push_frame(loopFrame);
+    return nullptr;
+}
 
-    while (true) {
-        redoState:
-        success = false;
-        bodyBytecode.index = 0;
-        result = this->execute(c, &bodyBytecode, &success);
-        if (!success) {
-            return result;
-        }
-        switch (c->lastState) {
-            case Return:
-                c->lastObject = result;
-                return nullptr;
-            case Continue:
-                goto continueState;
-                break;
-            case Redo:
-                goto redoState;
-                break;
-            case Break:
-                goto finish;
-                break;
-        }
+plasma::vm::value *plasma::vm::virtual_machine::execute(context *c, bytecode *bc, bool *success) {
+    c->push_frame(frame{
+            .kind = ExecutionFrame,
+            .nativeEntry = true,
+            .code = &bc->instructions,
+            .index = bc->index,
+            .end = bc->instructions.size()
+    });
+    bc->index = bc->instructions.size();
+    return this->run(c, success);
+}
 
-        continueState:
-        success = false;
-        conditionBytecode.index = 0;
-        conditionResult = this->execute(c, &conditionBytecode, &success);
-        if (!success) {
-            return conditionResult;
-        }
-        c->protect_value(conditionResult);
-        bool asBool = false;
-        auto interpretationError = this->interpret_as_boolean(c, conditionResult, &asBool);
-        if (interpretationError != nullptr) {
-            return interpretationError;
-        }
-        if (!asBool) {
-            break;
+plasma::vm::value *plasma::vm::virtual_machine::run(context *c, bool *success) {
+    size_t nativeDepth = c->nativeDepth;
+    if (!c->memoryFatal) {
+        try {
+            return this->interpret(c, success);
+        } catch (const memory_reserve_exhausted &) {
+            // The instruction was left half done, the frames are dropped without running any more code
+            c->nativeDepth = nativeDepth;
         }
     }
-    finish:
-    c->lastState = NoState;
-    return nullptr;
+    value *result = nullptr;
+    this->unwind(c, Failure, c->fatalMemoryError, &result, success);
+    return result;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::execute(context *c, bytecode *bc, bool *success) {
-    value *executionError = nullptr;
+plasma::vm::value *plasma::vm::virtual_machine::interpret(context *c, bool *success) {
     value *result = nullptr;
-    while (bc->has_next()) {
-        c->lastState = NoState;
-        instruction instruct = bc->next();
-        // 
+    if (c->nativeDepth >= c->nativeRecursionLimit) {
+        this->unwind(c, Failure, this->new_recursion_error(c, c->nativeRecursionLimit), &result, success);
+        return result;
+    }
+    c->nativeDepth++;
+    bool left = false;
+    while (!left) {
+        frame &current = c->peek_frame();
+        if (!current.has_next()) {
+            left = this->unwind(c, NoState, nullptr, &result, success);
+            continue;
+        }
+        const instruction &instruct = current.fetch();
+        value *executionError = nullptr;
+        uint8_t state = NoState;
+        value *stateObject = nullptr;
+        //
         switch (instruct.op_code) {
             case NewStringOP:
-                executionError = this->new_string_op(c, std::any_cast<std::string>(instruct.value));
+                executionError = this->new_string_op(c, *std::any_cast<immutable_string>(&instruct.value));
                 break;
             case NewFloatOP:
                 executionError = this->new_float_op(c, std::any_cast<double>(instruct.value));
@@ -1178,7 +940,7 @@ plasma::vm::value *plasma::vm::virtual_machine::execute(context *c, bytecode *bc
                 executionError = this->new_integer_op(c, std::any_cast<int64_t>(instruct.value));
                 break;
             case NewBytesOP:
-                executionError = this->new_bytes_op(c, std::any_cast<std::string>(instruct.value));
+                executionError = this->new_bytes_op(c, *std::any_cast<immutable_bytes>(&instruct.value));
                 break;
             case GetTrueOP:
                 c->lastObject = this->get_true(c);
@@ -1205,10 +967,10 @@ plasma::vm::value *plasma::vm::virtual_machine::execute(context *c, bytecode *bc
                 executionError = this->binary_op(c, std::any_cast<uint8_t>(instruct.value));
                 break;
             case GetIdentifierOP:
-                executionError = this->get_identifier_op(c, std::any_cast<std::string>(instruct.value));
+                executionError = this->get_identifier_op(c, *std::any_cast<std::string>(&instruct.value));
                 break;
             case SelectNameFromObjectOP:
-                executionError = this->select_name_from_object_op(c, std::any_cast<std::string>(instruct.value));
+                executionError = this->select_name_from_object_op(c, *std::any_cast<std::string>(&instruct.value));
                 break;
             case IndexOP:
                 executionError = this->index_op(c);
@@ -1217,134 +979,64 @@ plasma::vm::value *plasma::vm::virtual_machine::execute(context *c, bytecode *bc
                 executionError = this->method_invocation_op(c, std::any_cast<size_t>(instruct.value));
                 break;
             case AssignIdentifierOP:
-                executionError = this->assign_identifier_op(c, std::any_cast<std::string>(instruct.value));
+                executionError = this->assign_identifier_op(c, *std::any_cast<std::string>(&instruct.value));
                 break;
             case AssignSelectorOP:
-                executionError = this->assign_selector_op(c, std::any_cast<std::string>(instruct.value));
+                executionError = this->assign_selector_op(c, *std::any_cast<std::string>(&instruct.value));
                 break;
             case AssignIndexOP:
                 executionError = this->assign_index_op(c);
                 break;
             case NewInterfaceOP:
             case NewClassOP:
-                executionError = this->new_class_op(c, bc, std::any_cast<class_information>(instruct.value));
+                executionError = this->new_class_op(c, &current,
+                                                    *std::any_cast<class_information>(&instruct.value));
                 break;
             case ForLoopOP:
-                executionError = this->for_loop_op(c, std::any_cast<loop_information>(instruct.value));
-                if (executionError != nullptr) {
-                    (*success) = false;
-                    return executionError;
-                }
-                if (c->lastState == Return) {
-                    result = c->lastObject;
-                    c->lastObject = nullptr;
-                    (*success) = true;
-                    return result;
-                }
+                executionError = this->for_loop_op(c, *std::any_cast<loop_information>(&instruct.value));
                 break;
             case WhileLoopOP:
-                executionError = this->while_loop_op(c, std::any_cast<loop_information>(instruct.value));
-                if (executionError != nullptr) {
-                    (*success) = false;
-                    return executionError;
-                }
-                if (c->lastState == Return) {
-                    result = c->lastObject;
-                    c->lastObject = nullptr;
-                    (*success) = true;
-                    return result;
-                }
+                executionError = this->while_loop_op(c, *std::any_cast<loop_information>(&instruct.value));
                 break;
             case UntilLoopOP:
-                executionError = this->until_loop_op(c, std::any_cast<loop_information>(instruct.value));
-                if (executionError != nullptr) {
-                    (*success) = false;
-                    return executionError;
-                }
-                if (c->lastState == Return) {
-                    result = c->lastObject;
-                    c->lastObject = nullptr;
-                    (*success) = true;
-                    return result;
-                }
+                executionError = this->until_loop_op(c, *std::any_cast<loop_information>(&instruct.value));
                 break;
             case DoWhileLoopOP:
-                executionError = this->do_while_loop_op(c, std::any_cast<loop_information>(instruct.value));
-                if (executionError != nullptr) {
-                    (*success) = false;
-                    return executionError;
-                }
-                if (c->lastState == Return) {
-                    result = c->lastObject;
-                    c->lastObject = nullptr;
-                    (*success) = true;
-                    return result;
-                }
+                executionError = this->do_while_loop_op(c, *std::any_cast<loop_information>(&instruct.value));
                 break;
             case IfOP:
-                executionError = this->if_op(c, std::any_cast<condition_information>(instruct.value));
-                if (executionError != nullptr) {
-                    (*success) = false;
-                    return executionError;
-                }
-                switch (c->lastState) {
-                    case Continue:
-                    case Break:
-                    case Redo:
-                        (*success) = true;
-                        return this->get_none(c);
-                    case Return:
-                        // Leave alone so it get propagated
-                        result = c->lastObject;
-                        c->lastObject = nullptr;
-                        (*success) = true;
-                        return result;
-                }
+                executionError = this->if_op(c, *std::any_cast<condition_information>(&instruct.value));
                 break;
             case UnlessOP:
-                executionError = this->unless_op(c, std::any_cast<condition_information>(instruct.value));
-                if (executionError != nullptr) {
-                    (*success) = false;
-                    return executionError;
-                }
-                switch (c->lastState) {
-                    case Continue:
-                    case Break:
-                    case Redo:
-                        (*success) = true;
-                        return this->get_none(c);
-                    case Return:
-                        // Leave alone so it get propagated
-                        result = c->lastObject;
-                        c->lastObject = nullptr;
-                        (*success) = true;
-                        return result;
-                }
+                executionError = this->unless_op(c, *std::any_cast<condition_information>(&instruct.value));
                 break;
             case IfOneLinerOP:
-                executionError = this->if_one_liner_op(c, std::any_cast<condition_information>(instruct.value));
+                executionError = this->if_one_liner_op(c, *std::any_cast<condition_information>(&instruct.value));
                 break;
             case UnlessOneLinerOP:
-                executionError = this->unless_one_liner_op(c, std::any_cast<condition_information>(instruct.value));
+                executionError = this->unless_one_liner_op(c,
+                                                           *std::any_cast<condition_information>(&instruct.value));
                 break;
             case NewClassFunctionOP:
-                executionError = this->new_class_function_op(c, bc,
-                                                             std::any_cast<function_information>(instruct.value));
+                executionError = this->new_class_function_op(c, &current,
+                                                             *std::any_cast<function_information>(&instruct.value));
                 break;
             case LoadFunctionArgumentsOP:
                 executionError = this->load_function_arguments_op(c,
-                                                                  std::any_cast<std::vector<std::string>>(
-                                                                          instruct.value));
+                                                                  *std::any_cast<std::vector<std::string>>(
+                                                                          &instruct.value));
                 break;
             case NewFunctionOP:
-                executionError = this->new_function_op(c, bc, std::any_cast<function_information>(instruct.value));
+                executionError = this->new_function_op(c, &current,
+                                                       *std::any_cast<function_information>(&instruct.value));
                 break;
             case NewLambdaFunctionOP:
-                executionError = this->new_lambda_function_op(c, bc,
-                                                              std::any_cast<function_information>(instruct.value));
+                executionError = this->new_lambda_function_op(c, &current,
+                                                              *std::any_cast<function_information>(&instruct.value));
                 break;
             case NewGeneratorOP:
-                executionError = this->new_generator_op(c, bc, std::any_cast<generator_information>(instruct.value));
+                executionError = this->new_generator_op(c, &current,
+                                                        *std::any_cast<generator_information>(&instruct.value));
                 break;
             case PushOP:
                 if (c->lastObject != nullptr) {
@@ -1354,39 +1046,44 @@ plasma::vm::value *plasma::vm::virtual_machine::execute(context *c, bytecode *bc
             case NOP:
                 break;
             case ReturnOP:
-                (*success) = true;
-                return this->return_op(c, std::any_cast<size_t>(instruct.value));
+                state = Return;
+                stateObject = this->return_op(c, std::any_cast<size_t>(instruct.value));
+                break;
             case BreakOP:
-                c->lastState = Break;
-                (*success) = true;
-                return this->get_none(c);
+                state = Break;
+                break;
             case ContinueOP:
-                c->lastState = Continue;
-                (*success) = true;
-                return this->get_none(c);
+                state = Continue;
+                break;
             case RedoOP:
-                c->lastState = Redo;
-                (*success) = true;
-                return this->get_none(c);
+                state = Redo;
+                break;
             case RaiseOP:
                 executionError = this->raise_op(c);
                 break;
             case NewModuleOP:
-                executionError = this->new_module_op(c, bc, std::any_cast<class_information>(instruct.value));
+                executionError = this->new_module_op(c, &current,
+                                                     *std::any_cast<class_information>(&instruct.value));
                 break;
             case TryOP:
-                executionError = this->execute_try_block(c, std::any_cast<try_information>(instruct.value));
+                executionError = this->execute_try_block(c, *std::any_cast<try_information>(&instruct.value));
                 break;
             default:
                 // FixMe: Do something when
                 throw std::exception("OP NOT IMPLEMENTED");
                 break;
         }
+        if (c->memoryExhausted) {
+            executionError = this->new_memory_error(c);
+        }
         if (executionError != nullptr) {
-            (*success) = false;
-            return executionError;
+            state = Failure;
+            stateObject = executionError;
+        }
+        if (state != NoState) {
+            left = this->unwind(c, state, stateObject, &result, success);
         }
     }
-    (*success) = true;
-    return this->get_none(c);
+    c->nativeDepth--;
+    return result;
 }
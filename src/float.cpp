@@ -4,863 +4,547 @@
 #include <iomanip>
 #include "vm/virtual_machine.h"
 
+namespace plasma::vm {
+    static value *
+    float_negative(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_float(c, false, -self->floating);
+    }
+
+    static value *float_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false, self->floating + right->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->floating + right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false, left->integer + self->floating);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating + self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *float_sub(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false, self->floating - right->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->floating - right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_sub(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false, left->integer - self->floating);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating - self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *float_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false, self->floating * right->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->floating * right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false, left->integer * self->floating);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating * self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *float_div(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     self->floating / (0.0 + right->integer));
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->floating / right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_div(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     (0.0 + left->integer) / self->floating);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating / self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_floor_div(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     self->floating / (0.0 + right->integer));
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->floating / right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_floor_div(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     (0.0 + left->integer) / self->floating);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating / self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *float_pow(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     std::pow(self->floating, right->integer));
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     std::pow(self->floating, right->floating));
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_pow(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     std::pow(left->integer, self->floating));
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     std::pow(left->floating, self->floating));
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *float_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating == right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating == right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer == self->floating);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating == self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating != right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating != right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer != self->floating);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating != self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_greater_than(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating > right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating > right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_greater_than(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer > self->floating);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating > self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_less_than(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating < right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating < right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_less_than(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer < self->floating);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating < self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_greater_than_or_equal(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating >= right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating >= right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_greater_than_or_equal(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer >= self->floating);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating >= self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_less_than_or_equal(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating <= right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->floating <= right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    float_right_less_than_or_equal(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer <= self->floating);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating <= self->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *float_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_integer(c, false, vm->hash_float(self->floating));
+    }
+
+    static value *float_copy(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_float(c, false, self->floating);
+    }
+
+    static value *
+    float_to_integer(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_integer(c, false, self->floating);
+    }
+
+    static value *
+    float_to_float(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_float(c, false, self->floating);
+    }
+
+    static value *
+    float_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        std::stringstream stringBuilder;
+        stringBuilder << std::fixed << std::setprecision(20) << self->floating;
+        (*success) = true;
+        return vm->new_string(c, false, stringBuilder.str());
+    }
+
+    static value *float_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_boolean(c, self->floating != 0);
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::float_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Negative, {0, float_negative}},
+            {Add, {1, float_add}},
+            {RightAdd, {1, float_right_add}},
+            {Sub, {1, float_sub}},
+            {RightSub, {1, float_right_sub}},
+            {Mul, {1, float_mul}},
+            {RightMul, {1, float_right_mul}},
+            {Div, {1, float_div}},
+            {RightDiv, {1, float_right_div}},
+            {FloorDiv, {1, float_floor_div}},
+            {RightFloorDiv, {1, float_right_floor_div}},
+            {Pow, {1, float_pow}},
+            {RightPow, {1, float_right_pow}},
+            {Equals, {1, float_equals}},
+            {RightEquals, {1, float_right_equals}},
+            {NotEquals, {1, float_not_equals}},
+            {RightNotEquals, {1, float_right_not_equals}},
+            {GreaterThan, {1, float_greater_than}},
+            {RightGreaterThan, {1, float_right_greater_than}},
+            {LessThan, {1, float_less_than}},
+            {RightLessThan, {1, float_right_less_than}},
+            {GreaterThanOrEqual, {1, float_greater_than_or_equal}},
+            {RightGreaterThanOrEqual, {1, float_right_greater_than_or_equal}},
+            {LessThanOrEqual, {1, float_less_than_or_equal}},
+            {RightLessThanOrEqual, {1, float_right_less_than_or_equal}},
+            {Hash, {0, float_hash}},
+            {Copy, {0, float_copy}},
+            {ToInteger, {0, float_to_integer}},
+            {ToFloat, {0, float_to_float}},
+            {ToString, {0, float_to_string}},
+            {ToBool, {0, float_to_bool}},
+    });
+    return registry;
+}
+
 plasma::vm::constructor_callback plasma::vm::virtual_machine::float_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                Negative,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_float(c, false, -self->floating);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Add,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->floating + right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->floating + right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightAdd,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->integer + self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating + self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Sub,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->floating - right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->floating - right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightSub,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->integer - self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating - self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Mul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->floating * right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->floating * right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightMul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->integer * self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating * self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Div,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       self->floating / (0.0 + right->integer));
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->floating / right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightDiv,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       (0.0 + left->integer) / self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating / self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                FloorDiv,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       self->floating / (0.0 + right->integer));
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->floating / right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightFloorDiv,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       (0.0 + left->integer) / self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating / self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Pow,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       std::pow(self->floating, right->integer));
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       std::pow(self->floating, right->floating));
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightPow,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       std::pow(left->integer, self->floating));
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       std::pow(left->floating, self->floating));
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating == right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating == right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer == self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating == self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating != right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating != right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer != self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating != self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                GreaterThan,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating > right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating > right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightGreaterThan,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer > self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating > self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                LessThan,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating < right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating < right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightLessThan,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer < self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating < self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                GreaterThanOrEqual,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating >= right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating >= right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightGreaterThanOrEqual,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer >= self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating >= self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                LessThanOrEqual,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating <= right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->floating <= right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightLessThanOrEqual,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer <= self->floating);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating <= self->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        if (self->hash == 0) {
-                                            self->hash = this->hash_string(
-                                                    std::string(FloatName) + "-" + std::to_string(self->floating)
-                                            );
-                                        }
-                                        (*success) = true;
-                                        return this->new_integer(c, false, self->hash);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Copy,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_float(c, false, self->floating);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToInteger,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_integer(c, false, self->floating);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToFloat,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_float(c, false, self->floating);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        std::stringstream stringBuilder;
-                                        stringBuilder << std::fixed << std::setprecision(20) << self->floating;
-                                        (*success) = true;
-                                        return this->new_string(c, false, stringBuilder.str());
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_boolean(c, self->floating != 0);
-                                    }
-                            )
-                    );
-                }
-        );
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &float_methods();
         return nullptr;
     };
 }
@@ -0,0 +1,220 @@
+#include "vm/virtual_machine.h"
+
+bool plasma::vm::virtual_machine::unwind(context *c, uint8_t state, value *object, value **result, bool *success) {
+    auto protectionState = c->protected_values_state();
+    defer _(nullptr, [c, protectionState](...) { c->restore_protected_state(protectionState); });
+    c->protect_value(object);
+
+    while (true) {
+        frame &current = c->peek_frame();
+        switch (current.kind) {
+            case ExecutionFrame:
+                c->pop_frame();
+                (*success) = state != Failure;
+                if (state == Failure || state == Return) {
+                    (*result) = object;
+                } else {
+                    (*result) = this->get_none(c);
+                }
+                return true;
+            case FunctionFrame: {
+                bool nativeEntry = current.nativeEntry;
+                value *returned;
+                if (state == Failure) {
+                    returned = object;
+                } else if (current.constructed != nullptr) {
+                    returned = current.constructed;
+                } else if (state == Return) {
+                    returned = object;
+                } else {
+                    returned = this->get_none(c);
+                }
+                c->pop_frame();
+                if (nativeEntry) {
+                    (*success) = state != Failure;
+                    (*result) = returned;
+                    return true;
+                }
+                if (state == Failure) {
+                    continue;
+                }
+                c->lastObject = returned;
+                return false;
+            }
+            case ConditionFrame:
+                c->pop_frame();
+                if (state != NoState) {
+                    continue;
+                }
+                c->lastObject = this->get_none(c);
+                return false;
+            case OneLinerFrame:
+                // One-liner bodies yield their value with a return
+                c->pop_frame();
+                if (state == Return) {
+                    c->lastObject = object;
+                    return false;
+                }
+                if (state != NoState) {
+                    continue;
+                }
+                c->lastObject = this->get_none(c);
+                return false;
+            case ModuleFrame: {
+                value *module = current.module;
+                const class_information *moduleInformation = current.moduleInformation;
+                c->pop_frame();
+                if (state == Failure) {
+                    continue;
+                }
+                c->peek_symbol_table()->set(moduleInformation->name, module);
+                return false;
+            }
+            case WhileLoopFrame:
+            case UntilLoopFrame:
+            case DoWhileLoopFrame:
+                // The condition yields its value with a return
+                if (current.phase == ConditionPhase && state == Return) {
+                    bool asBool = false;
+                    auto interpretationError = this->interpret_as_boolean(c, object, &asBool);
+                    if (interpretationError != nullptr) {
+                        c->pop_frame();
+                        state = Failure;
+                        object = interpretationError;
+                        c->protect_value(object);
+                        continue;
+                    }
+                    if (asBool == (current.kind != UntilLoopFrame)) {
+                        current.start(BodyPhase, &current.loopInformation->body);
+                    } else {
+                        c->pop_frame();
+                    }
+                    return false;
+                }
+                switch (state) {
+                    case NoState:
+                    case Continue:
+                        current.start(ConditionPhase, &current.loopInformation->condition);
+                        return false;
+                    case Redo:
+                        current.start(BodyPhase, &current.loopInformation->body);
+                        return false;
+                    case Break:
+                        c->pop_frame();
+                        return false;
+                    default:
+                        c->pop_frame();
+                        continue;
+                }
+            case ForLoopFrame: {
+                value *stepError;
+                switch (state) {
+                    case NoState:
+                    case Continue: {
+                        bool finished = false;
+                        stepError = this->for_loop_step(c, &current, &finished);
+                        if (stepError == nullptr && finished) {
+                            c->pop_frame();
+                        }
+                        break;
+                    }
+                    case Redo:
+                        stepError = this->for_loop_receive(c, &current);
+                        break;
+                    case Break:
+                        c->pop_frame();
+                        return false;
+                    default:
+                        c->pop_frame();
+                        continue;
+                }
+                if (stepError == nullptr) {
+                    return false;
+                }
+                c->pop_frame();
+                state = Failure;
+                object = stepError;
+                c->protect_value(object);
+                continue;
+            }
+            case TryFrame: {
+                if (c->memoryFatal) {
+                    // Handling the error would need memory, the fatal MemoryError can not be caught
+                    c->pop_frame();
+                    continue;
+                }
+                const try_information *tryInformation = current.tryInformation;
+                if (current.phase == FinallyPhase) {
+                    // A state raised inside the finally block replaces the pending one
+                    if (state == NoState) {
+                        state = current.pendingState;
+                        object = current.pendingObject;
+                        c->protect_value(object);
+                    }
+                    c->pop_frame();
+                    if (state == NoState) {
+                        return false;
+                    }
+                    continue;
+                }
+                if (current.phase == ExceptTargetsPhase) {
+                    // The targets yield their tuple with a return
+                    if (state != Return) {
+                        c->pop_frame();
+                        continue;
+                    }
+                    bool matched = false;
+                    auto matchError = this->try_match_except(c, &current, object, &matched);
+                    if (matchError != nullptr) {
+                        c->pop_frame();
+                        state = Failure;
+                        object = matchError;
+                        c->protect_value(object);
+                        continue;
+                    }
+                    if (matched) {
+                        return false;
+                    }
+                    current.exceptIndex++;
+                    state = Failure;
+                    object = current.error;
+                } else if (state == Failure && current.phase == BodyPhase) {
+                    current.error = object;
+                    current.exceptIndex = 0;
+                } else if (state == Failure) {
+                    c->pop_frame();
+                    continue;
+                }
+                if (state == Failure) {
+                    // Look for the next except block that could handle the error
+                    if (current.exceptIndex < tryInformation->exceptBlocks.size()) {
+                        current.start(ExceptTargetsPhase, &tryInformation->exceptBlocks[current.exceptIndex].targets);
+                        return false;
+                    }
+                    if (!tryInformation->elseBody.empty()) {
+                        current.start(ElsePhase, &tryInformation->elseBody);
+                        return false;
+                    }
+                    c->protect_value(object);
+                    c->pop_frame();
+                    continue;
+                }
+                // Body, except or else block finished, run the finally block before leaving
+                current.pendingState = state;
+                current.pendingObject = object;
+                if (!tryInformation->finally.empty()) {
+                    current.start(FinallyPhase, &tryInformation->finally);
+                    return false;
+                }
+                c->pop_frame();
+                if (state == NoState) {
+                    return false;
+                }
+                continue;
+            }
+            default:
+                c->pop_frame();
+                continue;
+        }
+    }
+}
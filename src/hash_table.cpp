@@ -1,323 +1,177 @@
 #include "vm/virtual_machine.h"
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::hash_table_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            false,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != HashTable) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool result;
-                                        value *equalsError = this->hashtable_equals(
-                                                c,
-                                                self,
-                                                right,
-                                                &result
-                                        );
-                                        if (equalsError != nullptr) {
-                                            (*success) = false;
-                                            return equalsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            false,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != HashTable) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool result;
-                                        value *equalsError = this->hashtable_equals(
-                                                c,
-                                                left,
-                                                self,
-                                                &result
-                                        );
-                                        if (equalsError != nullptr) {
-                                            (*success) = false;
-                                            return equalsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            false,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId == HashTable) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool result;
-                                        value *equalsError = this->hashtable_equals(
-                                                c,
-                                                self,
-                                                right,
-                                                &result
-                                        );
-                                        if (equalsError != nullptr) {
-                                            (*success) = false;
-                                            return equalsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            false,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId == HashTable) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool result;
-                                        value *equalsError = this->hashtable_equals(c, left, self,
-                                                                                    &result);
-                                        if (equalsError != nullptr) {
-                                            (*success) = false;
-                                            return equalsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Contains,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *element = arguments[0];
-                                        bool contains = false;
-                                        value *containsError = this->hashtable_contains(c, self, element,
-                                                                                        &contains);
-                                        if (containsError != nullptr) {
-                                            (*success) = false;
-                                            return containsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, contains);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = false;
-                                        return this->new_unhashable_type_error(c, self->get_type(c, this));
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Copy,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->hashtable_copy(c, self, success);
-                                    }
-                            )
-                    );
-                }
+namespace plasma::vm {
+    static value *
+    hash_table_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != HashTable) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool result;
+        value *equalsError = vm->hashtable_equals(
+                c,
+                self,
+                right,
+                &result
         );
-        object->set_on_demand_symbol(
-                Index,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->hashtable_index(c, self, arguments[0], success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Assign,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    2,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->hashtable_assign(c, self, arguments[0], arguments[1], success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Iter,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->hashtable_iterator(c, self);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+        if (equalsError != nullptr) {
+            (*success) = false;
+            return equalsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, result);
+    }
 
-                                        return this->hashtable_to_string(c, self, success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->get_boolean(c, !self->keyValues.empty());
-                                    }
-                            )
-                    );
-                }
+    static value *
+    hash_table_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != HashTable) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool result;
+        value *equalsError = vm->hashtable_equals(
+                c,
+                left,
+                self,
+                &result
         );
-        object->set_on_demand_symbol(
-                ToArray,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_array(c, false, hashtable_to_content(self));
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToTuple,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_tuple(c, false, hashtable_to_content(self));
-                                    }
-                            )
-                    );
-                }
+        if (equalsError != nullptr) {
+            (*success) = false;
+            return equalsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, result);
+    }
+
+    static value *
+    hash_table_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != HashTable) {
+            (*success) = true;
+            return vm->get_true(c);
+        }
+        bool result;
+        value *equalsError = vm->hashtable_equals(
+                c,
+                self,
+                right,
+                &result
         );
+        if (equalsError != nullptr) {
+            (*success) = false;
+            return equalsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !result);
+    }
+
+    static value *
+    hash_table_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != HashTable) {
+            (*success) = true;
+            return vm->get_true(c);
+        }
+        bool result;
+        value *equalsError = vm->hashtable_equals(c, left, self,
+                                                  &result);
+        if (equalsError != nullptr) {
+            (*success) = false;
+            return equalsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !result);
+    }
+
+    static value *
+    hash_table_contains(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *element = arguments[0];
+        bool contains = false;
+        value *containsError = vm->hashtable_contains(c, self, element,
+                                                      &contains);
+        if (containsError != nullptr) {
+            (*success) = false;
+            return containsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, contains);
+    }
+
+    static value *
+    hash_table_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = false;
+        return vm->new_unhashable_type_error(c, self->get_type(c, vm));
+    }
+
+    static value *
+    hash_table_copy(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->hashtable_copy(c, self, success);
+    }
+
+    static value *
+    hash_table_index(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->hashtable_index(c, self, arguments[0], success);
+    }
+
+    static value *
+    hash_table_assign(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->hashtable_assign(c, self, arguments[0], arguments[1], success);
+    }
+
+    static value *
+    hash_table_iter(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->hashtable_iterator(c, self);
+    }
+
+    static value *
+    hash_table_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->hashtable_to_string(c, self, success);
+    }
+
+    static value *
+    hash_table_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->get_boolean(c, !self->keyValues.empty());
+    }
+
+    static value *
+    hash_table_to_array(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_array(c, false, vm->hashtable_to_content(self));
+    }
+
+    static value *
+    hash_table_to_tuple(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_tuple(c, false, vm->hashtable_to_content(self));
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::hash_table_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Equals, {1, hash_table_equals}},
+            {RightEquals, {1, hash_table_right_equals}},
+            {NotEquals, {1, hash_table_not_equals}},
+            {RightNotEquals, {1, hash_table_right_not_equals}},
+            {Contains, {1, hash_table_contains}},
+            {Hash, {0, hash_table_hash}},
+            {Copy, {0, hash_table_copy}},
+            {Index, {1, hash_table_index}},
+            {Assign, {2, hash_table_assign}},
+            {Iter, {0, hash_table_iter}},
+            {ToString, {0, hash_table_to_string}},
+            {ToBool, {0, hash_table_to_bool}},
+            {ToArray, {0, hash_table_to_array}},
+            {ToTuple, {0, hash_table_to_tuple}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::hash_table_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &hash_table_methods();
         return nullptr;
     };
 }
\ No newline at end of file
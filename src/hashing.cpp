@@ -1,131 +1,136 @@
-#include "vm/virtual_machine.h"
-
-#define BIG_CONSTANT(x) (x##LLU)
-
-#ifdef __x86_64__
+#include <cmath>
+#include <cstring>
 
-static uint64_t MurmurHash64(const void *key, int len, uint64_t seed) {
-    const uint64_t m = BIG_CONSTANT(0xc6a4a7935bd1e995);
-    const int r = 47;
+#include "vm/virtual_machine.h"
 
-    uint64_t h = seed ^(len * m);
+#if defined(_MSC_VER) && defined(_M_X64)
 
-    const uint64_t *data = (const uint64_t *) key;
-    const uint64_t *end = data + (len / 8);
+#include <intrin.h>
 
-    while (data != end) {
-        uint64_t k = *data++;
+#pragma intrinsic(_umul128)
+#endif
 
-        k *= m;
-        k ^= k >> r;
-        k *= m;
+/*
+ * wyhash (final version 4) by Wang Yi, released in the public domain
+ * Every step is a 64x64->128 bit multiplication folded back to 64 bits, inputs are read 8 bytes at a time
+ */
+
+static const uint64_t secret[4] = {
+        0x2d358dccaa6c78a5ull,
+        0x8bb84b93962eacc9ull,
+        0x4b33a62ed433d4a3ull,
+        0x4d5a2da51de1aa47ull,
+};
+
+static inline void wymum(uint64_t *a, uint64_t *b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = *a;
+    r *= *b;
+    (*a) = (uint64_t) r;
+    (*b) = (uint64_t) (r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    (*a) = _umul128(*a, *b, b);
+#else
+    uint64_t ha = (*a) >> 32, hb = (*b) >> 32, la = (uint32_t) (*a), lb = (uint32_t) (*b);
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+    uint64_t carry = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    (*a) = lo;
+    (*b) = hi;
+#endif
+}
 
-        h ^= k;
-        h *= m;
-    }
+static inline uint64_t wymix(uint64_t a, uint64_t b) {
+    wymum(&a, &b);
+    return a ^ b;
+}
 
-    const unsigned char *data2 = (const unsigned char *) data;
-
-    switch (len & 7) {
-        case 7:
-            h ^= uint64_t(data2[6]) << 48;
-        case 6:
-            h ^= uint64_t(data2[5]) << 40;
-        case 5:
-            h ^= uint64_t(data2[4]) << 32;
-        case 4:
-            h ^= uint64_t(data2[3]) << 24;
-        case 3:
-            h ^= uint64_t(data2[2]) << 16;
-        case 2:
-            h ^= uint64_t(data2[1]) << 8;
-        case 1:
-            h ^= uint64_t(data2[0]);
-            h *= m;
-    };
-
-    h ^= h >> r;
-    h *= m;
-    h ^= h >> r;
-
-    return h;
+// Inputs are read as little endian, the only byte order the VM targets
+static inline uint64_t wyr8(const uint8_t *p) {
+    uint64_t v;
+    std::memcpy(&v, p, 8);
+    return v;
 }
 
-#else
+static inline uint64_t wyr4(const uint8_t *p) {
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
 
-static uint64_t MurmurHash64(const void *key, int len, uint64_t seed) {
-    const uint32_t m = 0x5bd1e995;
-    const int r = 24;
-
-    uint32_t h1 = uint32_t(seed) ^len;
-    uint32_t h2 = uint32_t(seed >> 32);
-
-    const uint32_t *data = (const uint32_t *) key;
-
-    while (len >= 8) {
-        uint32_t k1 = *data++;
-        k1 *= m;
-        k1 ^= k1 >> r;
-        k1 *= m;
-        h1 *= m;
-        h1 ^= k1;
-        len -= 4;
-
-        uint32_t k2 = *data++;
-        k2 *= m;
-        k2 ^= k2 >> r;
-        k2 *= m;
-        h2 *= m;
-        h2 ^= k2;
-        len -= 4;
-    }
+static inline uint64_t wyr3(const uint8_t *p, size_t k) {
+    return (((uint64_t) p[0]) << 16) | (((uint64_t) p[k >> 1]) << 8) | p[k - 1];
+}
 
-    if (len >= 4) {
-        uint32_t k1 = *data++;
-        k1 *= m;
-        k1 ^= k1 >> r;
-        k1 *= m;
-        h1 *= m;
-        h1 ^= k1;
-        len -= 4;
+static uint64_t wyhash(const void *key, size_t len, uint64_t seed) {
+    const auto *p = (const uint8_t *) key;
+    seed ^= wymix(seed ^ secret[0], secret[1]);
+    uint64_t a, b;
+    if (len <= 16) {
+        if (len >= 4) {
+            a = (wyr4(p) << 32) | wyr4(p + ((len >> 3) << 2));
+            b = (wyr4(p + len - 4) << 32) | wyr4(p + len - 4 - ((len >> 3) << 2));
+        } else if (len > 0) {
+            a = wyr3(p, len);
+            b = 0;
+        } else {
+            // Empty inputs never touch the pointer
+            a = b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i >= 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = wymix(wyr8(p) ^ secret[1], wyr8(p + 8) ^ seed);
+                see1 = wymix(wyr8(p + 16) ^ secret[2], wyr8(p + 24) ^ see1);
+                see2 = wymix(wyr8(p + 32) ^ secret[3], wyr8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = wymix(wyr8(p) ^ secret[1], wyr8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = wyr8(p + i - 16);
+        b = wyr8(p + i - 8);
     }
-
-    switch (len) {
-        case 3:
-            h2 ^= ((unsigned char *) data)[2] << 16;
-        case 2:
-            h2 ^= ((unsigned char *) data)[1] << 8;
-        case 1:
-            h2 ^= ((unsigned char *) data)[0];
-            h2 *= m;
-    };
-
-    h1 ^= h2 >> 18;
-    h1 *= m;
-    h2 ^= h1 >> 22;
-    h2 *= m;
-    h1 ^= h2 >> 17;
-    h1 *= m;
-    h2 ^= h1 >> 19;
-    h2 *= m;
-
-    uint64_t h = h1;
-
-    h = (h << 32) | h2;
-
-    return h;
+    a ^= secret[1];
+    b ^= seed;
+    wymum(&a, &b);
+    return wymix(a ^ secret[0] ^ len, b ^ secret[1]);
 }
 
-#endif
+int64_t plasma::vm::virtual_machine::hash_combine(int64_t state, int64_t element) const {
+    // Not commutative, (1, 2) and (2, 1) get different hashes
+    return (int64_t) wymix(((uint64_t) state) ^ secret[0], ((uint64_t) element) ^ this->seed ^ secret[1]);
+}
 
 int64_t plasma::vm::virtual_machine::hash_array(const std::vector<int64_t> &values) {
-    return MurmurHash64(&(*values.begin()), values.size(), this->seed);
+    auto result = (int64_t) (this->seed ^ values.size());
+    for (int64_t value : values) {
+        result = this->hash_combine(result, value);
+    }
+    return result;
+}
+
+int64_t plasma::vm::virtual_machine::hash_string(std::string_view string) {
+    return (int64_t) wyhash(string.data(), string.size(), this->seed);
 }
 
-int64_t plasma::vm::virtual_machine::hash_string(const std::string &string) {
-    return MurmurHash64(&(*string.begin()), string.size(), this->seed);
+int64_t plasma::vm::virtual_machine::hash_bytes(std::span<const uint8_t> bytes) {
+    return (int64_t) wyhash(bytes.data(), bytes.size(), this->seed);
 }
 
-int64_t plasma::vm::virtual_machine::hash_bytes(const std::vector<uint8_t> &bytes) {
-    return MurmurHash64(&(*bytes.begin()), bytes.size(), this->seed);
-}
\ No newline at end of file
+int64_t plasma::vm::virtual_machine::hash_float(double floating) {
+    // Integral floats equal integers, so they also need to hash like them
+    if (std::trunc(floating) == floating && floating >= -9.2e18 && floating <= 9.2e18) {
+        return (int64_t) floating;
+    }
+    return (int64_t) wyhash(&floating, sizeof(floating), this->seed);
+}
@@ -0,0 +1,136 @@
+#include <map>
+#include <sstream>
+
+#include "vm/virtual_machine.h"
+
+static const char *type_id_name(uint8_t typeId) {
+    switch (typeId) {
+        case plasma::vm::Array:
+            return plasma::vm::ArrayName;
+        case plasma::vm::Boolean:
+            return plasma::vm::BoolName;
+        case plasma::vm::Bytes:
+            return plasma::vm::BytesName;
+        case plasma::vm::Float:
+            return plasma::vm::FloatName;
+        case plasma::vm::Function:
+            return plasma::vm::FunctionName;
+        case plasma::vm::HashTable:
+            return plasma::vm::HashTableName;
+        case plasma::vm::Integer:
+            return plasma::vm::IntegerName;
+        case plasma::vm::Iterator:
+            return plasma::vm::IteratorName;
+        case plasma::vm::Module:
+            return plasma::vm::ModuleName;
+        case plasma::vm::NoneType:
+            return plasma::vm::NoneName;
+        case plasma::vm::Object:
+            return plasma::vm::ObjectName;
+        case plasma::vm::String:
+            return plasma::vm::StringName;
+        case plasma::vm::Tuple:
+            return plasma::vm::TupleName;
+        case plasma::vm::Type:
+            return plasma::vm::TypeName;
+        default:
+            return "Unknown";
+    }
+}
+
+/*
+ * Approximation of the memory retained by a value, its slot plus the buffers it owns
+ */
+static size_t value_footprint(const plasma::vm::value *v) {
+    size_t result = sizeof(plasma::vm::value);
+    result += v->string.memory_usage();
+    result += v->bytes.memory_usage();
+    result += v->content.memory_usage();
+    result += v->subTypes.capacity() * sizeof(plasma::vm::value *);
+    result += v->keyValues.memory_usage();
+    for (const auto &instruct : v->callable_.code) {
+        result += sizeof(instruct);
+    }
+    return result;
+}
+
+template<typename T>
+static void write_heap(std::stringstream &output, const memory::memory<T> &heap) {
+    size_t slots = 0;
+    size_t allocated = 0;
+    for (const auto &keyValue : heap.pages) {
+        slots += keyValue.second->length;
+        allocated += keyValue.second->allocatedElements;
+    }
+    output << "{\"pages\": " << heap.pages.size()
+           << ", \"slots\": " << slots
+           << ", \"allocated\": " << allocated
+           << ", \"slot_bytes\": " << sizeof(T) << "}";
+}
+
+void plasma::vm::context::set_allocation_sampling(uint64_t interval) {
+    this->statistics.samplingInterval = interval;
+    this->statistics.allocationSites.clear();
+}
+
+std::string plasma::vm::context::heap_statistics_json() {
+    struct type_usage {
+        uint64_t count = 0;
+        uint64_t bytes = 0;
+    };
+    std::map<uint8_t, type_usage> live;
+    for (const auto &keyValue : this->value_heap.pages) {
+        for (size_t index = 0; index < keyValue.second->length; index++) {
+            value *v = keyValue.second->index(index);
+            if (!v->isSet) {
+                continue;
+            }
+            auto &usage = live[v->typeId];
+            usage.count++;
+            usage.bytes += value_footprint(v);
+        }
+    }
+
+    std::stringstream output;
+    output << "{\"heap\": {\"values\": ";
+    write_heap(output, this->value_heap);
+    output << ", \"symbol_tables\": ";
+    write_heap(output, this->symbol_table_heap);
+    output << "}, \"live\": {";
+    bool first = true;
+    for (const auto &keyValue : live) {
+        if (first) {
+            first = false;
+        } else {
+            output << ", ";
+        }
+        output << "\"" << type_id_name(keyValue.first) << "\": {\"count\": " << keyValue.second.count
+               << ", \"bytes\": " << keyValue.second.bytes << "}";
+    }
+    output << "}, \"gc\": {\"collections\": " << this->statistics.collections
+           << ", \"symbol_table_collections\": " << this->statistics.symbolTableCollections
+           << ", \"collected_values\": " << this->statistics.collectedValues
+           << ", \"collected_symbol_tables\": " << this->statistics.collectedSymbolTables
+           << ", \"last_mark_ns\": " << this->statistics.lastMarkNanoseconds
+           << ", \"last_sweep_ns\": " << this->statistics.lastSweepNanoseconds
+           << ", \"total_mark_ns\": " << this->statistics.totalMarkNanoseconds
+           << ", \"total_sweep_ns\": " << this->statistics.totalSweepNanoseconds
+           << "}, \"allocations\": {\"values\": " << this->statistics.allocatedValues
+           << ", \"symbol_tables\": " << this->statistics.allocatedSymbolTables
+           << ", \"sampling_interval\": " << this->statistics.samplingInterval
+           << ", \"sites\": {";
+    // Sort the sites by line so consecutive dumps can be diffed
+    std::map<size_t, uint64_t> sites(this->statistics.allocationSites.begin(),
+                                     this->statistics.allocationSites.end());
+    first = true;
+    for (const auto &keyValue : sites) {
+        if (first) {
+            first = false;
+        } else {
+            output << ", ";
+        }
+        output << "\"" << keyValue.first << "\": " << keyValue.second;
+    }
+    output << "}}}";
+    return output.str();
+}
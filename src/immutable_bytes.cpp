@@ -0,0 +1,53 @@
+#include <cstring>
+
+#include "vm/immutable_bytes.h"
+
+plasma::vm::immutable_bytes::immutable_bytes(const std::vector<uint8_t> &bytes) {
+    this->length = bytes.size();
+    this->buffer = std::make_shared<const std::vector<uint8_t>>(bytes);
+}
+
+plasma::vm::immutable_bytes::immutable_bytes(std::vector<uint8_t> &&bytes) {
+    this->length = bytes.size();
+    this->buffer = std::make_shared<const std::vector<uint8_t>>(std::move(bytes));
+}
+
+plasma::vm::immutable_bytes::immutable_bytes(std::string_view bytes) {
+    this->length = bytes.size();
+    this->buffer = std::make_shared<const std::vector<uint8_t>>(bytes.begin(), bytes.end());
+}
+
+plasma::vm::immutable_bytes plasma::vm::immutable_bytes::slice(size_t start, size_t count) const {
+    immutable_bytes result;
+    result.buffer = this->buffer;
+    result.offset = this->offset + start;
+    result.length = count;
+    if (start == 0 && count == this->length) {
+        result.hash = this->hash;
+    }
+    return result;
+}
+
+size_t plasma::vm::immutable_bytes::memory_usage() const {
+    if (this->buffer == nullptr) {
+        return 0;
+    }
+    return this->buffer->capacity();
+}
+
+size_t plasma::vm::immutable_bytes::shared_memory_usage() const {
+    if (this->buffer == nullptr) {
+        return 0;
+    }
+    return this->buffer->capacity() / this->buffer.use_count();
+}
+
+bool plasma::vm::operator==(const immutable_bytes &left, const immutable_bytes &right) {
+    if (left.length != right.length) {
+        return false;
+    }
+    if (left.hash != 0 && right.hash != 0 && left.hash != right.hash) {
+        return false;
+    }
+    return left.length == 0 || std::memcmp(left.data(), right.data(), left.length) == 0;
+}
@@ -0,0 +1,84 @@
+#include <cstring>
+
+#include "vm/immutable_string.h"
+
+plasma::vm::immutable_string::immutable_string(std::string_view string) {
+    this->length = string.size();
+    if (string.size() <= InlineCapacity) {
+        std::memcpy(this->inlineCharacters, string.data(), string.size());
+        this->inlineCharacters[string.size()] = '\0';
+        return;
+    }
+    this->buffer = std::make_shared<shared_buffer>(std::string(string), string.size());
+}
+
+plasma::vm::immutable_string::immutable_string(std::string &&string) {
+    this->length = string.size();
+    if (string.size() <= InlineCapacity) {
+        std::memcpy(this->inlineCharacters, string.data(), string.size());
+        this->inlineCharacters[string.size()] = '\0';
+        return;
+    }
+    this->buffer = std::make_shared<shared_buffer>(std::move(string), this->length);
+}
+
+plasma::vm::immutable_string plasma::vm::immutable_string::substring(size_t start, size_t count) const {
+    // Small pieces of big buffers are copied, so they do not keep the whole buffer alive
+    if (this->buffer == nullptr || count <= InlineCapacity || count * 4 < this->buffer->characters.size()) {
+        return immutable_string(std::string_view(this->data() + start, count));
+    }
+    immutable_string result;
+    result.buffer = this->buffer;
+    result.offset = this->offset + start;
+    result.length = count;
+    if (start == 0 && count == this->length) {
+        result.hash = this->hash;
+    }
+    return result;
+}
+
+plasma::vm::immutable_string
+plasma::vm::immutable_string::concatenate(const immutable_string &left, std::string_view right) {
+    size_t length = left.length + right.size();
+    if (length <= InlineCapacity) {
+        std::string result;
+        result.reserve(length);
+        result.append(left.view());
+        result.append(right);
+        return immutable_string(std::move(result));
+    }
+    immutable_string result;
+    result.length = length;
+    if (left.buffer != nullptr) {
+        size_t end = left.offset + left.length;
+        size_t committed = end;
+        if (end + right.size() <= left.buffer->characters.size() &&
+            left.buffer->committed.compare_exchange_strong(committed, end + right.size())) {
+            // The room after end is ours now, no other string reads it and the characters before it do not move
+            std::memcpy(left.buffer->characters.data() + end, right.data(), right.size());
+            result.buffer = left.buffer;
+            result.offset = left.offset;
+            return result;
+        }
+    }
+    // Growing strings get twice the room they need, so appending onto them stays amortized O(right.size())
+    std::string characters(left.buffer != nullptr ? length * 2 : length, '\0');
+    std::memcpy(characters.data(), left.data(), left.length);
+    std::memcpy(characters.data() + left.length, right.data(), right.size());
+    result.buffer = std::make_shared<shared_buffer>(std::move(characters), length);
+    return result;
+}
+
+size_t plasma::vm::immutable_string::memory_usage() const {
+    if (this->buffer == nullptr) {
+        return 0;
+    }
+    return this->buffer->characters.size();
+}
+
+size_t plasma::vm::immutable_string::shared_memory_usage() const {
+    if (this->buffer == nullptr) {
+        return 0;
+    }
+    return this->buffer->characters.size() / this->buffer.use_count();
+}
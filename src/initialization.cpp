@@ -37,6 +37,10 @@ void plasma::vm::virtual_machine::initialize_context(context *c) {
     c->master = c->allocate_symbol_table(nullptr);
     c->push_symbol_table(c->master);
     this->initialize_builtin_symbols(c);
+    if (c->configuration.maximumHeapSize != 0) {
+        // Raised once the reserve is spent, by then there is no memory left to build it
+        c->fatalMemoryError = this->new_memory_error(c);
+    }
 }
 
 void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
@@ -271,6 +275,27 @@ void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
                                   }
                    )
     );
+    c->master->set(MemoryError,
+                   this->new_type(c, true, MemoryError, std::vector<value *>{runtimeError}, constructor{
+                                          .isBuiltIn = true,
+                                          .callback = memory_error_initialize(false)
+                                  }
+                   )
+    );
+    c->master->set(RecursionError,
+                   this->new_type(c, true, RecursionError, std::vector<value *>{runtimeError}, constructor{
+                                          .isBuiltIn = true,
+                                          .callback = recursion_error_initialize(false)
+                                  }
+                   )
+    );
+    c->master->set(ValueError,
+                   this->new_type(c, true, ValueError, std::vector<value *>{runtimeError}, constructor{
+                                          .isBuiltIn = true,
+                                          .callback = value_error_initialize(false)
+                                  }
+                   )
+    );
     //// Functions
     c->master->set(
             "println",
@@ -280,7 +305,7 @@ void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
                     nullptr,
                     new_builtin_callable(
                             1,
-                            [this, c](value *self, const std::vector<value *> &arguments, bool *success) {
+                            [this, c](value *self, arguments_span arguments, bool *success) {
                                 value *resultAsString;
                                 auto target = arguments[0];
                                 if (target->typeId == String) {
@@ -295,7 +320,7 @@ void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
                                     bool callSuccess = false;
 
                                     resultAsString = this->call_function(c, resultToString,
-                                                                         std::vector<value *>(), &callSuccess);
+                                                                         arguments_span(), &callSuccess);
                                     if (!callSuccess) {
 
                                         (*success) = false;
@@ -323,7 +348,7 @@ void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
                     nullptr,
                     new_builtin_callable(
                             1,
-                            [this, c](value *self, const std::vector<value *> &arguments, bool *success) {
+                            [this, c](value *self, arguments_span arguments, bool *success) {
 
                                 value *resultAsString;
                                 auto target = arguments[0];
@@ -340,7 +365,7 @@ void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
                                     bool callSuccess = false;
 
                                     resultAsString = this->call_function(c, resultToString,
-                                                                         std::vector<value *>(), &callSuccess);
+                                                                         arguments_span(), &callSuccess);
                                     if (!callSuccess) {
 
                                         (*success) = false;
@@ -369,7 +394,7 @@ void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
                     nullptr,
                     new_builtin_callable(
                             3,
-                            [this, c](value *self, const std::vector<value *> &arguments, bool *success) {
+                            [this, c](value *self, arguments_span arguments, bool *success) {
                                 auto state = c->protected_values_state();
                                 defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
 
@@ -409,7 +434,7 @@ void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
                                                         .isBuiltIn = true,
                                                         .numberOfArguments = 0,
                                                         .callback = [this, c, end](value *self,
-                                                                                   const std::vector<value *> &arguments,
+                                                                                   arguments_span arguments,
                                                                                    bool *success) -> value * {
                                                             (*success) = true;
                                                             return this->get_boolean(c, self->integer < end->integer);
@@ -426,7 +451,7 @@ void plasma::vm::virtual_machine::initialize_builtin_symbols(context *c) {
                                                         .isBuiltIn = true,
                                                         .numberOfArguments = 0,
                                                         .callback = [this, c, step](value *self,
-                                                                                    const std::vector<value *> &arguments,
+                                                                                    arguments_span arguments,
                                                                                     bool *success) -> value * {
                                                             auto yieldResult = this->new_integer(c, false,
                                                                                                  self->integer);
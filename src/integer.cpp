@@ -1,1185 +1,743 @@
 #include <cmath>
 #include "vm/virtual_machine.h"
 
+namespace plasma::vm {
+    static value *
+    integer_neg_bits(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_integer(c, false, ~self->integer);
+    }
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::integer_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                NegBits,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_integer(c, false, ~self->integer);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Negative,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_integer(c, false, -self->integer);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Add,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer + right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->integer + right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightAdd,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer + self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating + self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Sub,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer - right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->integer - right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightSub,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer - self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating - self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Mul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer * right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->integer * right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightMul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer * self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating * self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Div,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       (0.0 + self->integer) / (0.0 + right->integer));
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, self->integer / right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightDiv,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       (0.0 + left->integer) / (0.0 + self->integer));
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false, left->floating / self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                FloorDiv,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer / right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer / right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightFloorDiv,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer / self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->floating / self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Mod,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer % right->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightMod,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer % self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Pow,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false,
-                                                                         std::pow(self->integer, right->integer));
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       std::pow(self->integer, right->floating));
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightPow,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false,
-                                                                         std::pow(left->integer, self->integer));
-                                            case Float:
-                                                (*success) = true;
-                                                return this->new_float(c, false,
-                                                                       std::pow(left->floating, self->integer));
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                BitXor,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer ^ right->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightBitXor,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer ^ self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                BitAnd,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer & right->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightBitAnd,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer & self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                BitOr,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer | right->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightBitOr,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer | self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                BitLeft,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer << right->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightBitLeft,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer << self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                BitRight,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, self->integer >> right->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightBitRight,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->new_integer(c, false, left->integer >> self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+    static value *
+    integer_negative(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_integer(c, false, -self->integer);
+    }
+
+    static value *integer_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer + right->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->integer + right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer + self->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating + self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *integer_sub(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer - right->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->integer - right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_sub(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer - self->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating - self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *integer_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer * right->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->integer * right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer * self->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating * self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *integer_div(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     (0.0 + self->integer) / (0.0 + right->integer));
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, self->integer / right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_div(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     (0.0 + left->integer) / (0.0 + self->integer));
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false, left->floating / self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_floor_div(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer / right->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer / right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_floor_div(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer / self->integer);
+            case Float:
+                (*success) = true;
+                return vm->new_integer(c, false, left->floating / self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *integer_mod(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer % right->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_right_mod(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer % self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *integer_pow(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false,
+                                       std::pow(self->integer, right->integer));
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     std::pow(self->integer, right->floating));
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_pow(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false,
+                                       std::pow(left->integer, self->integer));
+            case Float:
+                (*success) = true;
+                return vm->new_float(c, false,
+                                     std::pow(left->floating, self->integer));
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_bit_xor(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer ^ right->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_right_bit_xor(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer ^ self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_bit_and(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer & right->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_right_bit_and(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer & self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_bit_or(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer | right->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_right_bit_or(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer | self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_bit_left(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer << right->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_right_bit_left(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer << self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
 
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer == right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer == right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer == self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating == self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer != right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer != right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer != self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating != self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                GreaterThan,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer > right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer > right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightGreaterThan,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer > self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating > self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                LessThan,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer < right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer < right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightLessThan,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer < self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating < self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                GreaterThanOrEqual,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer >= right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer >= right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightGreaterThanOrEqual,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer >= self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating >= self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                LessThanOrEqual,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        switch (right->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer <= right->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, self->integer <= right->floating);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, right->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightLessThanOrEqual,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        switch (left->typeId) {
-                                            case Integer:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->integer <= self->integer);
-                                            case Float:
-                                                (*success) = true;
-                                                return this->get_boolean(c, left->floating <= self->integer);
-                                            default:
-                                                (*success) = false;
-                                                return this->new_invalid_type_error(c, left->type,
-                                                                                    std::vector<std::string>{
-                                                                                            IntegerName,
-                                                                                            FloatName});
-                                        }
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_integer(c, false, self->integer);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Copy,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_integer(c, false, self->integer);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToInteger,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_integer(c, false, self->integer);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToFloat,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_float(c, false, self->integer);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+    static value *
+    integer_bit_right(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, self->integer >> right->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
 
-                                        (*success) = true;
-                                        return this->new_string(c, false, std::to_string(self->integer));
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_boolean(c, self->integer != 0);
-                                    }
-                            )
-                    );
-                }
-        );
+    static value *
+    integer_right_bit_right(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->new_integer(c, false, left->integer >> self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName});
+        }
+    }
+
+    static value *
+    integer_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer == right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer == right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer == self->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating == self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer != right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer != right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer != self->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating != self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_greater_than(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer > right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer > right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_greater_than(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer > self->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating > self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_less_than(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer < right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer < right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_less_than(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer < self->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating < self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_greater_than_or_equal(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer >= right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer >= right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_greater_than_or_equal(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer >= self->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating >= self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_less_than_or_equal(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        switch (right->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer <= right->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, self->integer <= right->floating);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, right->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *
+    integer_right_less_than_or_equal(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        switch (left->typeId) {
+            case Integer:
+                (*success) = true;
+                return vm->get_boolean(c, left->integer <= self->integer);
+            case Float:
+                (*success) = true;
+                return vm->get_boolean(c, left->floating <= self->integer);
+            default:
+                (*success) = false;
+                return vm->new_invalid_type_error(c, left->type,
+                                                  std::vector<std::string>{
+                                                          IntegerName,
+                                                          FloatName});
+        }
+    }
+
+    static value *integer_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_integer(c, false, self->integer);
+    }
+
+    static value *integer_copy(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_integer(c, false, self->integer);
+    }
+
+    static value *
+    integer_to_integer(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_integer(c, false, self->integer);
+    }
+
+    static value *
+    integer_to_float(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_float(c, false, self->integer);
+    }
+
+    static value *
+    integer_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_string(c, false, std::to_string(self->integer));
+    }
+
+    static value *
+    integer_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_boolean(c, self->integer != 0);
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::integer_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {NegBits, {0, integer_neg_bits}},
+            {Negative, {0, integer_negative}},
+            {Add, {1, integer_add}},
+            {RightAdd, {1, integer_right_add}},
+            {Sub, {1, integer_sub}},
+            {RightSub, {1, integer_right_sub}},
+            {Mul, {1, integer_mul}},
+            {RightMul, {1, integer_right_mul}},
+            {Div, {1, integer_div}},
+            {RightDiv, {1, integer_right_div}},
+            {FloorDiv, {1, integer_floor_div}},
+            {RightFloorDiv, {1, integer_right_floor_div}},
+            {Mod, {1, integer_mod}},
+            {RightMod, {1, integer_right_mod}},
+            {Pow, {1, integer_pow}},
+            {RightPow, {1, integer_right_pow}},
+            {BitXor, {1, integer_bit_xor}},
+            {RightBitXor, {1, integer_right_bit_xor}},
+            {BitAnd, {1, integer_bit_and}},
+            {RightBitAnd, {1, integer_right_bit_and}},
+            {BitOr, {1, integer_bit_or}},
+            {RightBitOr, {1, integer_right_bit_or}},
+            {BitLeft, {1, integer_bit_left}},
+            {RightBitLeft, {1, integer_right_bit_left}},
+            {BitRight, {1, integer_bit_right}},
+            {RightBitRight, {1, integer_right_bit_right}},
+            {Equals, {1, integer_equals}},
+            {RightEquals, {1, integer_right_equals}},
+            {NotEquals, {1, integer_not_equals}},
+            {RightNotEquals, {1, integer_right_not_equals}},
+            {GreaterThan, {1, integer_greater_than}},
+            {RightGreaterThan, {1, integer_right_greater_than}},
+            {LessThan, {1, integer_less_than}},
+            {RightLessThan, {1, integer_right_less_than}},
+            {GreaterThanOrEqual, {1, integer_greater_than_or_equal}},
+            {RightGreaterThanOrEqual, {1, integer_right_greater_than_or_equal}},
+            {LessThanOrEqual, {1, integer_less_than_or_equal}},
+            {RightLessThanOrEqual, {1, integer_right_less_than_or_equal}},
+            {Hash, {0, integer_hash}},
+            {Copy, {0, integer_copy}},
+            {ToInteger, {0, integer_to_integer}},
+            {ToFloat, {0, integer_to_float}},
+            {ToString, {0, integer_to_string}},
+            {ToBool, {0, integer_to_bool}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::integer_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &integer_methods();
         return nullptr;
     };
 }
@@ -1,59 +1,35 @@
 #include "vm/virtual_machine.h"
 
+namespace plasma::vm {
+    static value *
+    iterator_has_next(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_false(c);
+    }
+
+    static value *iterator_next(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_none(c);
+    }
+
+    static value *iterator_iter(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return self;
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::iterator_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {HasNext, {0, iterator_has_next}},
+            {Next, {0, iterator_next}},
+            {Iter, {0, iterator_iter}},
+    });
+    return registry;
+}
 
 plasma::vm::constructor_callback plasma::vm::virtual_machine::iterator_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                HasNext,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_false(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Next,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_none(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Iter,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [](value *self, const std::vector<value *> &arguments,
-                                       bool *success) -> value * {
-                                        (*success) = true;
-                                        return self;
-                                    }
-                            )
-                    );
-                }
-        );
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &iterator_methods();
         return nullptr;
     };
 }
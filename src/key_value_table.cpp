@@ -0,0 +1,68 @@
+#include "vm/key_value_table.h"
+
+plasma::vm::key_value *plasma::vm::key_value_table::insert(int64_t hash, value *key, value *v) {
+    this->modifications++;
+    // Keep the load factor under 7/8
+    if ((this->entries.size() + 1) * 8 > this->control.size() * 7) {
+        this->rehash(this->control.empty() ? GroupWidth : this->control.size() * 2);
+    }
+    auto entryIndex = (uint32_t) this->entries.size();
+    this->entries.push_back(
+            key_value{
+                    .hash = hash,
+                    .key = key,
+                    .value = v,
+            }
+    );
+    this->place(mix(hash), entryIndex);
+    return &this->entries.back();
+}
+
+void plasma::vm::key_value_table::reserve(size_t numberOfEntries) {
+    this->modifications++;
+    size_t capacity = this->control.empty() ? GroupWidth : this->control.size();
+    while (numberOfEntries * 8 > capacity * 7) {
+        capacity *= 2;
+    }
+    this->entries.reserve(numberOfEntries);
+    if (capacity != this->control.size()) {
+        this->rehash(capacity);
+    }
+}
+
+void plasma::vm::key_value_table::clear() {
+    this->modifications++;
+    // Release the buffers, values are recycled by the garbage collector with their tables
+    this->entries = std::vector<key_value>();
+    this->control = std::vector<int8_t>();
+    this->slots = std::vector<uint32_t>();
+}
+
+size_t plasma::vm::key_value_table::memory_usage() const {
+    return this->entries.capacity() * sizeof(key_value) +
+           this->control.capacity() * sizeof(int8_t) +
+           this->slots.capacity() * sizeof(uint32_t);
+}
+
+void plasma::vm::key_value_table::place(uint64_t mixed, uint32_t entryIndex) {
+    size_t groupMask = (this->control.size() / GroupWidth) - 1;
+    size_t group = (mixed >> 7) & groupMask;
+    for (size_t step = 1;; step++) {
+        uint32_t available = match_group(&this->control[group * GroupWidth], Empty);
+        if (available != 0) {
+            size_t slot = group * GroupWidth + std::countr_zero(available);
+            this->control[slot] = control_tag(mixed);
+            this->slots[slot] = entryIndex;
+            return;
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+void plasma::vm::key_value_table::rehash(size_t capacity) {
+    this->control.assign(capacity, Empty);
+    this->slots.assign(capacity, 0);
+    for (size_t index = 0; index < this->entries.size(); index++) {
+        this->place(mix(this->entries[index].hash), (uint32_t) index);
+    }
+}
@@ -1,121 +1,167 @@
+#include <array>
+
 #include "compiler/lexer.h"
+#include "tools.h"
+
+/*
+ * Character classes, indexed by the unsigned value of the character
+ */
+
+enum : uint8_t {
+    IdentifierStartClass = 1 << 0, // a-z A-Z _
+    DigitClass = 1 << 1, // 0-9
+    HexadecimalClass = 1 << 2, // 0-9 a-f A-F
+    OctalClass = 1 << 3, // 0-7
+    BinaryClass = 1 << 4, // 0 1
+    EscapableClass = 1 << 5, // Characters allowed after a backslash inside strings
+};
+
+static constexpr std::array<uint8_t, 256> characterClasses = [] {
+    std::array<uint8_t, 256> classes{};
+    for (int character = 'a'; character <= 'z'; character++) {
+        classes[character] |= IdentifierStartClass;
+        classes[character - 'a' + 'A'] |= IdentifierStartClass;
+    }
+    classes['_'] |= IdentifierStartClass;
+    for (int character = '0'; character <= '9'; character++) {
+        classes[character] |= DigitClass | HexadecimalClass;
+    }
+    for (int character = 'a'; character <= 'f'; character++) {
+        classes[character] |= HexadecimalClass;
+        classes[character - 'a' + 'A'] |= HexadecimalClass;
+    }
+    for (int character = '0'; character <= '7'; character++) {
+        classes[character] |= OctalClass;
+    }
+    classes['0'] |= BinaryClass;
+    classes['1'] |= BinaryClass;
+    for (char character : {'\\', '\'', '"', '`', 'a', 'b', 'e', 'f', 'n', 'r', 't', '?', 'u', 'x'}) {
+        classes[(uint8_t) character] |= EscapableClass;
+    }
+    return classes;
+}();
+
+static inline bool is_class(char character, uint8_t classes) {
+    return (characterClasses[(uint8_t) character] & classes) != 0;
+}
+
+// Digits of numbers can be separated by _ after the first one
+static inline bool is_digit_or_separator(char character, uint8_t classes) {
+    return is_class(character, classes) || character == '_';
+}
+
+/*
+ * Keyword recognition
+ * The hash of every keyword lands in a different slot, so a lookup is one hash and one comparison
+ */
+
+struct keyword {
+    std::string_view string;
+    uint8_t kind;
+    uint8_t directValue;
+};
+
+static constexpr keyword keywords[] = {
+        {plasma::lexer::PassString,      plasma::lexer::Keyboard,      plasma::lexer::Pass},
+        {plasma::lexer::EndString,       plasma::lexer::Keyboard,      plasma::lexer::End},
+        {plasma::lexer::IfString,        plasma::lexer::Keyboard,      plasma::lexer::If},
+        {plasma::lexer::UnlessString,    plasma::lexer::Keyboard,      plasma::lexer::Unless},
+        {plasma::lexer::ElseString,      plasma::lexer::Keyboard,      plasma::lexer::Else},
+        {plasma::lexer::ElifString,      plasma::lexer::Keyboard,      plasma::lexer::Elif},
+        {plasma::lexer::WhileString,     plasma::lexer::Keyboard,      plasma::lexer::While},
+        {plasma::lexer::DoString,        plasma::lexer::Keyboard,      plasma::lexer::Do},
+        {plasma::lexer::ForString,       plasma::lexer::Keyboard,      plasma::lexer::For},
+        {plasma::lexer::UntilString,     plasma::lexer::Keyboard,      plasma::lexer::Until},
+        {plasma::lexer::SwitchString,    plasma::lexer::Keyboard,      plasma::lexer::Switch},
+        {plasma::lexer::CaseString,      plasma::lexer::Keyboard,      plasma::lexer::Case},
+        {plasma::lexer::DefaultString,   plasma::lexer::Keyboard,      plasma::lexer::Default},
+        {plasma::lexer::ReturnString,    plasma::lexer::Keyboard,      plasma::lexer::Return},
+        {plasma::lexer::ContinueString,  plasma::lexer::Keyboard,      plasma::lexer::Continue},
+        {plasma::lexer::BreakString,     plasma::lexer::Keyboard,      plasma::lexer::Break},
+        {plasma::lexer::RedoString,      plasma::lexer::Keyboard,      plasma::lexer::Redo},
+        {plasma::lexer::ModuleString,    plasma::lexer::Keyboard,      plasma::lexer::Module},
+        {plasma::lexer::DefString,       plasma::lexer::Keyboard,      plasma::lexer::Def},
+        {plasma::lexer::LambdaString,    plasma::lexer::Keyboard,      plasma::lexer::Lambda},
+        {plasma::lexer::InterfaceString, plasma::lexer::Keyboard,      plasma::lexer::Interface},
+        {plasma::lexer::ClassString,     plasma::lexer::Keyboard,      plasma::lexer::Class},
+        {plasma::lexer::TryString,       plasma::lexer::Keyboard,      plasma::lexer::Try},
+        {plasma::lexer::ExceptString,    plasma::lexer::Keyboard,      plasma::lexer::Except},
+        {plasma::lexer::FinallyString,   plasma::lexer::Keyboard,      plasma::lexer::Finally},
+        {plasma::lexer::AndString,       plasma::lexer::Operator,      plasma::lexer::And},
+        {plasma::lexer::OrString,        plasma::lexer::Operator,      plasma::lexer::Or},
+        {plasma::lexer::XorString,       plasma::lexer::Operator,      plasma::lexer::Xor},
+        {plasma::lexer::InString,        plasma::lexer::Operator,      plasma::lexer::In},
+        {plasma::lexer::AsString,        plasma::lexer::Keyboard,      plasma::lexer::As},
+        {plasma::lexer::RaiseString,     plasma::lexer::Keyboard,      plasma::lexer::Raise},
+        {plasma::lexer::AwaitString,     plasma::lexer::AwaitKeyboard, plasma::lexer::Await},
+        {plasma::lexer::BEGINString,     plasma::lexer::Keyboard,      plasma::lexer::BEGIN},
+        {plasma::lexer::ENDString,       plasma::lexer::Keyboard,      plasma::lexer::END},
+        {plasma::lexer::NotString,       plasma::lexer::Operator,      plasma::lexer::Not},
+        {plasma::lexer::TrueString,      plasma::lexer::Boolean,       plasma::lexer::True},
+        {plasma::lexer::FalseString,     plasma::lexer::Boolean,       plasma::lexer::False},
+        {plasma::lexer::NoneString,      plasma::lexer::NoneType,      plasma::lexer::None},
+        {plasma::lexer::DeferString,     plasma::lexer::Keyboard,      plasma::lexer::Defer},
+        {plasma::lexer::ContextString,   plasma::lexer::Keyboard,      plasma::lexer::Context},
+};
+
+static constexpr size_t keywordSlots = 128;
+static constexpr int8_t emptySlot = -1;
 
+static constexpr size_t keyword_hash(std::string_view pattern) {
+    return (pattern.size() * 4 + (uint8_t) pattern.front() + (uint8_t) pattern.back() * 56) & (keywordSlots - 1);
+}
+
+static constexpr std::array<int8_t, keywordSlots> keywordTable = [] {
+    std::array<int8_t, keywordSlots> table{};
+    table.fill(emptySlot);
+    for (size_t index = 0; index < std::size(keywords); index++) {
+        table[keyword_hash(keywords[index].string)] = (int8_t) index;
+    }
+    return table;
+}();
 
-plasma::lexer::lexer::lexer(plasma::reader::reader *codeReader) {
-    this->codeReader = codeReader;
+static constexpr bool keyword_hash_is_perfect() {
+    for (size_t index = 0; index < std::size(keywords); index++) {
+        if (keywordTable[keyword_hash(keywords[index].string)] != (int8_t) index) {
+            return false;
+        }
+    }
+    return true;
 }
 
+static_assert(keyword_hash_is_perfect(), "two keywords share a slot, keyword_hash needs new factors");
+
 bool plasma::lexer::lexer::hasNext() const {
     return !this->complete;
 }
 
-void plasma::lexer::lexer::guessKind(const std::string &pattern, uint8_t *kind, uint8_t *directValue) {
-
-    (*kind) = Keyboard;
-    if (pattern == PassString) {
-        (*directValue) = Pass;
-    } else if (pattern == EndString) {
-        (*directValue) = End;
-    } else if (pattern == IfString) {
-        (*directValue) = If;
-    } else if (pattern == UnlessString) {
-        (*directValue) = Unless;
-    } else if (pattern == ElseString) {
-        (*directValue) = Else;
-    } else if (pattern == ElifString) {
-        (*directValue) = Elif;
-    } else if (pattern == WhileString) {
-        (*directValue) = While;
-    } else if (pattern == DoString) {
-        (*directValue) = Do;
-    } else if (pattern == ForString) {
-        (*directValue) = For;
-    } else if (pattern == UntilString) {
-        (*directValue) = Until;
-    } else if (pattern == SwitchString) {
-        (*directValue) = Switch;
-    } else if (pattern == CaseString) {
-        (*directValue) = Case;
-    } else if (pattern == DefaultString) {
-        (*directValue) = Default;
-    } else if (pattern == ReturnString) {
-        (*directValue) = Return;
-    } else if (pattern == ContinueString) {
-        (*directValue) = Continue;
-    } else if (pattern == BreakString) {
-        (*directValue) = Break;
-    } else if (pattern == RedoString) {
-        (*directValue) = Redo;
-    } else if (pattern == ModuleString) {
-        (*directValue) = Module;
-    } else if (pattern == DefString) {
-        (*directValue) = Def;
-    } else if (pattern == LambdaString) {
-        (*directValue) = Lambda;
-    } else if (pattern == InterfaceString) {
-        (*directValue) = Interface;
-    } else if (pattern == ClassString) {
-        (*directValue) = Class;
-    } else if (pattern == TryString) {
-        (*directValue) = Try;
-    } else if (pattern == ExceptString) {
-        (*directValue) = Except;
-    } else if (pattern == FinallyString) {
-        (*directValue) = Finally;
-    } else if (pattern == AndString) {
-        (*kind) = Operator;
-        (*directValue) = And;
-    } else if (pattern == OrString) {
-        (*kind) = Operator;
-        (*directValue) = Or;
-    } else if (pattern == XorString) {
-        (*kind) = Operator;
-        (*directValue) = Xor;
-    } else if (pattern == InString) {
-        (*kind) = Operator;
-        (*directValue) = In;
-    } else if (pattern == AsString) {
-        (*directValue) = As;
-    } else if (pattern == RaiseString) {
-        (*directValue) = Raise;
-    } else if (pattern == AwaitString) {
-        (*kind) = AwaitKeyboard;
-        (*directValue) = Await;
-    } else if (pattern == BEGINString) {
-        (*directValue) = BEGIN;
-    } else if (pattern == ENDString) {
-        (*directValue) = END;
-    } else if (pattern == NotString) {
-        (*kind) = Operator;
-        (*directValue) = Not;
-    } else if (pattern == TrueString) {
-        (*kind) = Boolean;
-        (*directValue) = True;
-    } else if (pattern == FalseString) {
-        (*kind) = Boolean;
-        (*directValue) = False;
-    } else if (pattern == NoneString) {
-        (*kind) = NoneType;
-        (*directValue) = None;
-    } else if (pattern == DeferString) {
-        (*directValue) = Defer;
-    } else if (pattern == ContextString) {
-        (*directValue) = Context;
-    } else if (std::regex_match(pattern, identifierCheck)) {
-        (*kind) = IdentifierKind;
-        (*directValue) = Unknown;
-    } else if (std::regex_match(pattern, junkKindCheck)) {
-        (*kind) = JunkKind;
-        (*directValue) = Unknown;
-    } else {
+void plasma::lexer::lexer::guessKind(std::string_view pattern, uint8_t *kind, uint8_t *directValue) {
+    (*directValue) = Unknown;
+    if (pattern.empty()) {
         (*kind) = Unknown;
-        (*directValue) = Unknown;
+        return;
+    }
+    int8_t slot = keywordTable[keyword_hash(pattern)];
+    if (slot != emptySlot && keywords[slot].string == pattern) {
+        (*kind) = keywords[slot].kind;
+        (*directValue) = keywords[slot].directValue;
+        return;
+    }
+    if (!is_class(pattern.front(), IdentifierStartClass)) {
+        (*kind) = pattern == std::string_view("\0", 1) ? JunkKind : Unknown;
+        return;
+    }
+    for (char character : pattern) {
+        if (!is_class(character, IdentifierStartClass | DigitClass)) {
+            (*kind) = Unknown;
+            return;
+        }
     }
+    (*kind) = IdentifierKind;
 }
 
-bool plasma::lexer::lexer::tokenizeStringLikeExpressions(char stringOpener, std::string *content, uint8_t *kind,
-                                                         uint8_t *directValue, error::error *result_error) {
-    content->push_back(stringOpener);
+bool plasma::lexer::lexer::tokenizeStringLikeExpressions(char stringOpener, uint8_t *kind, uint8_t *directValue,
+                                                         error::error *result_error) {
     uint8_t target;
     switch (stringOpener) {
         case '\'':
@@ -133,355 +179,229 @@ bool plasma::lexer::lexer::tokenizeStringLikeExpressions(char stringOpener, std:
     (*kind) = Literal;
     (*directValue) = Unknown;
     bool escaped = false;
-    bool finish = false;
-    for (; this->codeReader->hasNext() && !finish; this->codeReader->next()) {
-        char currentChar = this->codeReader->currentChar();
+    for (; this->sourceHasNext(); this->position++) {
+        char currentChar = this->currentChar();
         if (escaped) {
-            switch (currentChar) {
-                case '\\':
-                case '\'':
-                case '"':
-                case '`':
-                case 'a':
-                case 'b':
-                case 'e':
-                case 'f':
-                case 'n':
-                case 'r':
-                case 't':
-                case '?':
-                case 'u':
-                case 'x':
-                    escaped = false;
-                    break;
-                default:
-                    (*result_error) = error::error(error::LexingError, "invalid escape sequence", this->line);
-                    return false;
+            if (!is_class(currentChar, EscapableClass)) {
+                (*result_error) = error::error(error::LexingError, "invalid escape sequence", this->line);
+                return false;
             }
+            escaped = false;
         } else if (currentChar == '\n') {
             this->line++;
+            this->lineStart = this->position + 1;
         } else if (currentChar == stringOpener) {
             (*directValue) = target;
-            finish = true;
+            this->position++;
+            return true;
         } else if (currentChar == '\\') {
             escaped = true;
         }
-        content->push_back(currentChar);
     }
-    if ((*directValue) != target) {
-        (*result_error) = error::error(error::LexingError, "string never closed", this->line);
-        return false;
-    }
-    return true;
+    (*result_error) = error::error(error::LexingError, "string never closed", this->line);
+    return false;
 }
 
-bool plasma::lexer::lexer::tokenizeHexadecimal(char letterX, std::string *content, uint8_t *kind, uint8_t *directValue,
-                                               error::error *result_error) const {
-    content->push_back('0');
-    content->push_back(letterX);
+bool plasma::lexer::lexer::tokenizeHexadecimal(uint8_t *kind, uint8_t *directValue, error::error *result_error) {
     (*kind) = Literal;
     (*directValue) = Unknown;
-    if (!this->codeReader->hasNext()) {
+    if (!this->sourceHasNext() || !is_class(this->currentChar(), HexadecimalClass)) {
         error::new_unknown_token_lind(result_error, this->line);
         return false;
     }
-    char nextDigit = this->codeReader->currentChar();
-    if (!(('0' <= nextDigit && nextDigit <= '9') ||
-          ('a' <= nextDigit && nextDigit <= 'f') ||
-          ('A' <= nextDigit && nextDigit <= 'F'))) {
-        error::new_unknown_token_lind(result_error, this->line);
-        return false;
+    this->position++;
+    while (this->sourceHasNext() && is_digit_or_separator(this->currentChar(), HexadecimalClass)) {
+        this->position++;
     }
-    this->codeReader->next();
-    content->push_back(nextDigit);
     (*directValue) = HexadecimalInteger;
-    for (; this->codeReader->hasNext(); this->codeReader->next()) {
-        nextDigit = this->codeReader->currentChar();
-        if (!(('0' <= nextDigit && nextDigit <= '9') ||
-              ('a' <= nextDigit && nextDigit <= 'f') ||
-              ('A' <= nextDigit && nextDigit <= 'F')) &&
-            nextDigit != '_') {
-            return true;
-        }
-        content->push_back(nextDigit);
-    }
     return true;
 }
 
-bool plasma::lexer::lexer::tokenizeBinary(char letterB, std::string *content, uint8_t *kind, uint8_t *directValue,
-                                          error::error *result_error) const {
-    content->push_back('0');
-    content->push_back(letterB);
+bool plasma::lexer::lexer::tokenizeBinary(uint8_t *kind, uint8_t *directValue, error::error *result_error) {
     (*kind) = Literal;
     (*directValue) = Unknown;
-    if (!this->codeReader->hasNext()) {
+    if (!this->sourceHasNext() || !is_class(this->currentChar(), BinaryClass)) {
         error::new_unknown_token_lind(result_error, this->line);
         return false;
     }
-    char nextDigit = this->codeReader->currentChar();
-    if (!(nextDigit == '0' || nextDigit == '1')) {
-        error::new_unknown_token_lind(result_error, this->line);
-        return false;
+    this->position++;
+    while (this->sourceHasNext() && is_digit_or_separator(this->currentChar(), BinaryClass)) {
+        this->position++;
     }
-    this->codeReader->next();
-    content->push_back(nextDigit);
     (*directValue) = BinaryInteger;
-    for (; this->codeReader->hasNext(); this->codeReader->next()) {
-        nextDigit = this->codeReader->currentChar();
-        if (!(nextDigit == '0' || nextDigit == '1') && nextDigit != '_') {
-            return true;
-        }
-        content->push_back(nextDigit);
-    }
     return true;
 }
 
-bool plasma::lexer::lexer::tokenizeOctal(char letterO, std::string *content, uint8_t *kind, uint8_t *directValue,
-                                         error::error *result_error) const {
-    content->push_back('0');
-    content->push_back(letterO);
+bool plasma::lexer::lexer::tokenizeOctal(uint8_t *kind, uint8_t *directValue, error::error *result_error) {
     (*kind) = Literal;
     (*directValue) = Unknown;
-    if (!this->codeReader->hasNext()) {
+    if (!this->sourceHasNext() || !is_class(this->currentChar(), OctalClass)) {
         error::new_unknown_token_lind(result_error, this->line);
         return false;
     }
-    char nextDigit = this->codeReader->currentChar();
-    if (!('0' <= nextDigit && nextDigit <= '7')) {
-        error::new_unknown_token_lind(result_error, this->line);
-        return false;
+    this->position++;
+    while (this->sourceHasNext() && is_digit_or_separator(this->currentChar(), OctalClass)) {
+        this->position++;
     }
-    this->codeReader->next();
-    content->push_back(nextDigit);
     (*directValue) = OctalInteger;
-    for (; this->codeReader->hasNext(); this->codeReader->next()) {
-        nextDigit = this->codeReader->currentChar();
-        if (!('0' <= nextDigit && nextDigit <= '7') && nextDigit != '_') {
-            return true;
-        }
-        content->push_back(nextDigit);
-    }
     return true;
 }
 
-bool plasma::lexer::lexer::tokenizeScientificFloat(std::string base, std::string *content, uint8_t *kind,
-                                                   uint8_t *directValue, error::error *result_error) const {
-    std::string result = std::move(base);
+// The e of the exponent was already consumed
+bool plasma::lexer::lexer::tokenizeScientificFloat(uint8_t *kind, uint8_t *directValue, error::error *result_error) {
     (*kind) = Literal;
     (*directValue) = Unknown;
-    if (!this->codeReader->hasNext()) {
+    if (!this->sourceHasNext()) {
         error::new_unknown_token_lind(result_error, this->line);
         return false;
     }
-    char direction = this->codeReader->currentChar();
+    char direction = this->currentChar();
     if ((direction != '-') && (direction != '+')) {
         error::new_unknown_token_lind(result_error, this->line);
         return false;
     }
-    this->codeReader->next();
-    if (!this->codeReader->hasNext()) {
-        error::new_unknown_token_lind(result_error, this->line);
-        return false;
-    }
-    result.push_back(direction);
-    char nextDigit = this->codeReader->currentChar();
-    if (!('0' <= nextDigit && nextDigit <= '9')) {
+    this->position++;
+    if (!this->sourceHasNext() || !is_class(this->currentChar(), DigitClass)) {
         error::new_unknown_token_lind(result_error, this->line);
         return false;
     }
-    result.push_back(nextDigit);
-    this->codeReader->next();
-    for (; this->codeReader->hasNext(); this->codeReader->next()) {
-        nextDigit = this->codeReader->currentChar();
-        if (!('0' <= nextDigit && nextDigit <= '9') && nextDigit != '_') {
-            (*directValue) = ScientificFloat;
-            (*content) = result;
-            return true;
-        }
-        result.push_back(nextDigit);
+    this->position++;
+    while (this->sourceHasNext() && is_digit_or_separator(this->currentChar(), DigitClass)) {
+        this->position++;
     }
     (*directValue) = ScientificFloat;
-    (*content) = result;
     return true;
 }
 
-bool plasma::lexer::lexer::tokenizeFloat(
-        std::string base,
-        std::string *content,
-        uint8_t *kind,
-        uint8_t *directValue,
-        error::error *result_error) const {
+// The dot was already consumed, it is given back when no digit follows it
+bool plasma::lexer::lexer::tokenizeFloat(uint8_t *kind, uint8_t *directValue, error::error *result_error) {
     (*kind) = Literal;
     (*directValue) = Integer;
-    if (!this->codeReader->hasNext()) {
-        this->codeReader->redo();
-        base.pop_back();
-        (*content) = base;
+    if (!this->sourceHasNext() || !is_class(this->currentChar(), DigitClass)) {
+        this->position--;
         return true;
     }
-    char nextDigit = this->codeReader->currentChar();
-    if (!('0' <= nextDigit && nextDigit <= '9')) {
-        this->codeReader->redo();
-        base.pop_back();
-        (*content) = base;
-        return true;
-    }
-    this->codeReader->next();
-    base.push_back(nextDigit);
-    for (; this->codeReader->hasNext(); this->codeReader->next()) {
-        nextDigit = this->codeReader->currentChar();
-        if (('0' <= nextDigit && nextDigit <= '9') || nextDigit == '_') {
-            base.push_back(nextDigit);
-        } else if ((nextDigit == 'e') || (nextDigit == 'E')) {
-            this->codeReader->next();
-            base.push_back(nextDigit);
-            return this->tokenizeScientificFloat(base, content, kind, directValue, result_error);
-        } else {
+    this->position++;
+    for (; this->sourceHasNext(); this->position++) {
+        char nextDigit = this->currentChar();
+        if ((nextDigit == 'e') || (nextDigit == 'E')) {
+            this->position++;
+            return this->tokenizeScientificFloat(kind, directValue, result_error);
+        } else if (!is_digit_or_separator(nextDigit, DigitClass)) {
             break;
         }
     }
     (*directValue) = Float;
-    (*content) = base;
     return true;
 }
 
-bool plasma::lexer::lexer::tokenizeInteger(std::string base, std::string *content, uint8_t *kind, uint8_t *directValue,
-                                           error::error *result_error) const {
+bool plasma::lexer::lexer::tokenizeInteger(uint8_t *kind, uint8_t *directValue, error::error *result_error) {
     (*kind) = Literal;
-    (*directValue) = Unknown;
-    if (!this->codeReader->hasNext()) {
-        (*content) = std::move(base);
-        (*directValue) = Integer;
+    (*directValue) = Integer;
+    if (!this->sourceHasNext()) {
         return true;
     }
-    char nextDigit = this->codeReader->currentChar();
+    char nextDigit = this->currentChar();
     if (nextDigit == '.') {
-        this->codeReader->next();
-        base.push_back(nextDigit);
-        return this->tokenizeFloat(base, content, kind, directValue, result_error);
+        this->position++;
+        return this->tokenizeFloat(kind, directValue, result_error);
     } else if (nextDigit == 'e' || nextDigit == 'E') {
-        this->codeReader->next();
-        base.push_back(nextDigit);
-        return this->tokenizeScientificFloat(base, content, kind, directValue, result_error);
-    } else if (!('0' <= nextDigit && nextDigit <= '9')) {
-        (*content) = base;
-        (*directValue) = Integer;
+        this->position++;
+        return this->tokenizeScientificFloat(kind, directValue, result_error);
+    } else if (!is_class(nextDigit, DigitClass)) {
         return true;
     }
-    this->codeReader->next();
-    base.push_back(nextDigit);
-    for (; this->codeReader->hasNext(); this->codeReader->next()) {
-        nextDigit = this->codeReader->currentChar();
+    this->position++;
+    for (; this->sourceHasNext(); this->position++) {
+        nextDigit = this->currentChar();
         if (nextDigit == 'e' || nextDigit == 'E') {
-            this->codeReader->next();
-            base.push_back(nextDigit);
-            return this->tokenizeScientificFloat(base, content, kind, directValue, result_error);
+            this->position++;
+            return this->tokenizeScientificFloat(kind, directValue, result_error);
         } else if (nextDigit == '.') {
-            this->codeReader->next();
-            base.push_back(nextDigit);
-            return this->tokenizeFloat(base, content, kind, directValue, result_error);
-        } else if (('0' <= nextDigit && nextDigit <= '9') || nextDigit == '_') {
-            base.push_back(nextDigit);
-        } else {
+            this->position++;
+            return this->tokenizeFloat(kind, directValue, result_error);
+        } else if (!is_digit_or_separator(nextDigit, DigitClass)) {
             break;
         }
     }
-    (*content) = base;
-    (*directValue) = Integer;
     return true;
 }
 
-bool
-plasma::lexer::lexer::tokenizeNumeric(char firstDigit, std::string *content, uint8_t *kind, uint8_t *direct_value,
-                                      error::error *result_error) const {
+bool plasma::lexer::lexer::tokenizeNumeric(char firstDigit, uint8_t *kind, uint8_t *directValue,
+                                           error::error *result_error) {
     (*kind) = Literal;
-    (*direct_value) = Integer;
-    if (!this->codeReader->hasNext()) {
-        (*content) = std::string(1, firstDigit);
+    (*directValue) = Integer;
+    if (!this->sourceHasNext()) {
         return true;
     }
-    char nextChar = this->codeReader->currentChar();
-    this->codeReader->next();
-    std::string base;
-    base.push_back(firstDigit);
-    base.push_back(nextChar);
-    if (firstDigit == '0') {
-        switch (nextChar) {
-            case 'x':
-            case 'X': // Hexadecimal
-                return this->tokenizeHexadecimal(nextChar, content, kind, direct_value, result_error);
-            case 'b':
-            case 'B': // Binary
-                return this->tokenizeBinary(nextChar, content, kind, direct_value, result_error);
-            case 'o':
-            case 'O': // Octal
-                return this->tokenizeOctal(nextChar, content, kind, direct_value, result_error);
-            case 'e':
-            case 'E': // Scientific float
-                return this->tokenizeScientificFloat(base, content, kind, direct_value, result_error);
-            case '.': // Maybe a float
-                return this->tokenizeFloat(base, content, kind, direct_value,
-                                           result_error); // Integer, Float Or Scientific Float
-            default:
-                if (('0' <= nextChar && nextChar <= '9') || nextChar == '_') {
-                    return this->tokenizeInteger(base, content, kind, direct_value,
-                                                 result_error); // Integer, Float or Scientific Float
-                }
-                break;
-        }
-    } else {
-        switch (nextChar) {
-            case 'e':
-            case 'E': // Scientific float
-                return this->tokenizeScientificFloat(base, content, kind, direct_value,
-                                                     result_error);
-            case '.': // Maybe a float
-                return this->tokenizeFloat(base, content, kind, direct_value,
-                                           result_error); // Integer, Float Or Scientific Float
-            default:
-                if (('0' <= nextChar && nextChar <= '9') || nextChar == '_') {
-                    return this->tokenizeInteger(base, content, kind, direct_value,
-                                                 result_error); // Integer, Float or Scientific Float
-                }
-        }
+    char nextChar = this->currentChar();
+    this->position++;
+    switch (nextChar) {
+        case 'x':
+        case 'X': // Hexadecimal
+            if (firstDigit == '0') {
+                return this->tokenizeHexadecimal(kind, directValue, result_error);
+            }
+            break;
+        case 'b':
+        case 'B': // Binary
+            if (firstDigit == '0') {
+                return this->tokenizeBinary(kind, directValue, result_error);
+            }
+            break;
+        case 'o':
+        case 'O': // Octal
+            if (firstDigit == '0') {
+                return this->tokenizeOctal(kind, directValue, result_error);
+            }
+            break;
+        case 'e':
+        case 'E': // Scientific float
+            return this->tokenizeScientificFloat(kind, directValue, result_error);
+        case '.': // Maybe a float
+            return this->tokenizeFloat(kind, directValue, result_error); // Integer, Float Or Scientific Float
+        default:
+            if (is_digit_or_separator(nextChar, DigitClass)) {
+                return this->tokenizeInteger(kind, directValue, result_error); // Integer, Float or Scientific Float
+            }
+            break;
     }
-    this->codeReader->redo();
-    (*content) = std::string(1, firstDigit);
+    this->position--;
     (*kind) = Literal;
-    (*direct_value) = Integer;
+    (*directValue) = Integer;
     return true;
 }
 
-bool plasma::lexer::lexer::tokenizeChars(char startingChar, std::string *content, uint8_t *kind, uint8_t *direct_value,
+// The literal was already validated by the tokenize functions, only values out of range fail
+bool plasma::lexer::lexer::convertNumeric(std::string_view literal, uint8_t directValue, numeric_value *number,
+                                          error::error *result_error) const {
+    bool success;
+    if (directValue == Float || directValue == ScientificFloat) {
+        number->floating = general_tooling::parse_float(literal, &success);
+    } else {
+        number->integer = general_tooling::parse_integer(literal, &success);
+    }
+    if (!success) {
+        (*result_error) = error::error(error::LexingError, "numeric literal out of range", this->line);
+    }
+    return success;
+}
+
+// The first character is already consumed, start is its position
+bool plasma::lexer::lexer::tokenizeChars(size_t start, uint8_t *kind, uint8_t *directValue,
                                          error::error *result_error) {
-    std::string result = std::string(1, startingChar);
-    for (; this->codeReader->hasNext(); this->codeReader->next()) {
-        char currentChar = this->codeReader->currentChar();
-        if (('a' <= currentChar && currentChar <= 'z') || ('A' <= currentChar && currentChar <= 'Z') ||
-            ('0' <= currentChar && currentChar <= '9') || (currentChar == '_')) {
-            result.push_back(currentChar);
-        } else {
-            break;
-        }
+    while (this->sourceHasNext() && is_class(this->currentChar(), IdentifierStartClass | DigitClass)) {
+        this->position++;
     }
-    this->guessKind(result, kind, direct_value);
-    (*content) = result;
+    guessKind(this->source.substr(start, this->position - start), kind, directValue);
     return true;
 }
 
-bool plasma::lexer::lexer::tokenizeComment(std::string *content, uint8_t *kind, uint8_t *directValue,
-                                           error::error *result_error) const {
-    std::string result;
-    for (; this->codeReader->hasNext(); this->codeReader->next()) {
-        char currentChar = this->codeReader->currentChar();
-        if (currentChar == '\n') {
-            break;
-        }
-        result.push_back(currentChar);
-    }
+bool plasma::lexer::lexer::tokenizeComment(uint8_t *kind, uint8_t *directValue, error::error *result_error) {
+    size_t end = this->source.find('\n', this->position);
+    this->position = end == std::string_view::npos ? this->source.size() : end;
     (*kind) = Comment;
     (*directValue) = Comment;
-    (*content) = result;
     return true;
 }
 
@@ -489,159 +409,133 @@ bool plasma::lexer::lexer::tokenizeRepeatableOperator(char op, uint8_t directVal
                                                       uint8_t directValueWhenDouble, uint8_t kindWhenDouble,
                                                       uint8_t directValueWhenSingleAssign, uint8_t kindWhenSingleAssign,
                                                       uint8_t directValueWhenDoubleAssign, uint8_t kindWhenDoubleAssign,
-                                                      std::string *content, uint8_t *kind, uint8_t *directValue,
-                                                      error::error *result_error) const {
-    std::string result(1, op);
+                                                      uint8_t *kind, uint8_t *directValue,
+                                                      error::error *result_error) {
     (*kind) = kindWhenSingle;
     (*directValue) = directValueWhenSingle;
-    if (this->codeReader->hasNext()) {
-        char nextChar = this->codeReader->currentChar();
+    if (this->sourceHasNext()) {
+        char nextChar = this->currentChar();
         if (nextChar == op) {
-            result.push_back(op);
-            this->codeReader->next();
+            this->position++;
             (*kind) = kindWhenDouble;
             (*directValue) = directValueWhenDouble;
-
-            if (this->codeReader->hasNext()) {
-                char nextNextChar = this->codeReader->currentChar();
-                if (nextNextChar == '=') {
-                    result.push_back('=');
-                    (*kind) = kindWhenDoubleAssign;
-                    this->codeReader->next();
-                    (*directValue) = directValueWhenDoubleAssign;
-                }
+            if (this->sourceHasNext() && this->currentChar() == '=') {
+                this->position++;
+                (*kind) = kindWhenDoubleAssign;
+                (*directValue) = directValueWhenDoubleAssign;
             }
         } else if (nextChar == '=') {
+            this->position++;
             (*kind) = kindWhenSingleAssign;
             (*directValue) = directValueWhenSingleAssign;
-            result.push_back('=');
-
-            this->codeReader->next();
         }
     }
-    (*content) = result;
     return true;
 }
 
-bool plasma::lexer::lexer::tokenizeNotRepeatableOperator(char op, uint8_t directValueWhenOperator,
-                                                         uint8_t kindWhenOperator, uint8_t directValueWhenAssign,
-                                                         uint8_t kindWhenAssign, std::string *content, uint8_t *kind,
-                                                         uint8_t *directValue, error::error *result_error) const {
-    std::string result(1, op);
+bool plasma::lexer::lexer::tokenizeNotRepeatableOperator(uint8_t directValueWhenOperator, uint8_t kindWhenOperator,
+                                                         uint8_t directValueWhenAssign, uint8_t kindWhenAssign,
+                                                         uint8_t *kind, uint8_t *directValue,
+                                                         error::error *result_error) {
     (*kind) = kindWhenOperator;
     (*directValue) = directValueWhenOperator;
-    if (this->codeReader->hasNext()) {
-        char nextChar = this->codeReader->currentChar();
-        if (nextChar == '=') {
-            (*kind) = kindWhenAssign;
-            (*directValue) = directValueWhenAssign;
-            result.push_back('=');
-            this->codeReader->next();
-        }
+    if (this->sourceHasNext() && this->currentChar() == '=') {
+        this->position++;
+        (*kind) = kindWhenAssign;
+        (*directValue) = directValueWhenAssign;
     }
-    (*content) = result;
     return true;
 }
 
 bool plasma::lexer::lexer::_next(token *result, error::error *result_error) {
-    if (!this->codeReader->hasNext()) {
+    if (!this->sourceHasNext()) {
         this->complete = true;
-        (*result) = token{"EOF", EndOfFile, EndOfFile, this->line};
+        (*result) = token{"EOF", EndOfFile, EndOfFile, this->line, (int) (this->position - this->lineStart)};
 
         return true;
     }
     uint8_t kind = Unknown;
     uint8_t directValue = Unknown;
-    std::string content;
 
     int currentLine = this->line;
-    int index = this->codeReader->index();
-    char currentChar = this->codeReader->currentChar();
-    std::string base(1, currentChar);
+    int currentColumn = (int) (this->position - this->lineStart);
+    size_t start = this->position;
+    char currentChar = this->currentChar();
 
-    this->codeReader->next();
+    this->position++;
 
     bool success = true;
+    numeric_value number{.integer = 0};
     switch (currentChar) {
         case NewLineChar:
             this->line++;
-            content = base;
+            this->lineStart = this->position;
             directValue = NewLine;
             kind = Separator;
             break;
         case SemiColonChar:
-            content = base;
             directValue = SemiColon;
             kind = Separator;
             break;
         case ColonChar:
-            content = base;
             directValue = Colon;
             kind = Punctuation;
             break;
         case CommaChar:
-            content = base;
             directValue = Comma;
             kind = Punctuation;
             break;
         case OpenParenthesesChar:
-            content = base;
             directValue = OpenParentheses;
             kind = Punctuation;
             break;
         case CloseParenthesesChar:
-            content = base;
             directValue = CloseParentheses;
             kind = Punctuation;
             break;
         case OpenSquareBracketChar:
-            content = base;
             directValue = OpenSquareBracket;
             kind = Punctuation;
             break;
         case CloseSquareBracketChar:
-            content = base;
             directValue = CloseSquareBracket;
             kind = Punctuation;
             break;
         case OpenBraceChar:
-            content = base;
             directValue = OpenBrace;
             kind = Punctuation;
             break;
         case CloseBraceChar:
-            content = base;
             directValue = CloseBrace;
             kind = Punctuation;
             break;
         case DollarSignChar:
-            content = base;
             directValue = DollarSign;
             kind = Punctuation;
             break;
         case DotChar:
-            content = base;
             directValue = Dot;
             kind = Punctuation;
             break;
         case WhiteSpaceChar:
-            content = base;
             directValue = Whitespace;
             kind = Whitespace;
             break;
         case TabChar:
-            content = base;
             directValue = Tab;
             kind = Whitespace;
             break;
+        case CarriageReturnChar: // Files are read byte for byte, so CRLF line endings reach the lexer
+            directValue = Whitespace;
+            kind = Whitespace;
+            break;
         case CommentChar:
-            success = this->tokenizeComment(&content, &kind, &directValue, result_error);
-            content = "+" + content;
+            success = this->tokenizeComment(&kind, &directValue, result_error);
             break;
         case '`':
         case '\'':
         case '"': // String1
-            success = this->tokenizeStringLikeExpressions(currentChar, &content, &kind, &directValue, result_error);
+            success = this->tokenizeStringLikeExpressions(currentChar, &kind, &directValue, result_error);
             break;
         case '1':
         case '2':
@@ -653,130 +547,116 @@ bool plasma::lexer::lexer::_next(token *result, error::error *result_error) {
         case '8':
         case '9':
         case '0':
-            success = this->tokenizeNumeric(currentChar, &content, &kind, &directValue, result_error);
+            success = this->tokenizeNumeric(currentChar, &kind, &directValue, result_error) &&
+                      this->convertNumeric(this->source.substr(start, this->position - start), directValue,
+                                           &number, result_error);
             break;
         case StarChar:
             success = tokenizeRepeatableOperator(currentChar, Star, Operator, PowerOf, Operator,
                                                  StarAssign, Assignment, PowerOfAssign,
-                                                 Assignment, &content, &kind, &directValue, result_error);
+                                                 Assignment, &kind, &directValue, result_error);
             break;
         case DivChar:
             success = this->tokenizeRepeatableOperator(currentChar, Div, Operator, FloorDiv, Operator,
                                                        DivAssign, Assignment, FloorDivAssign,
-                                                       Assignment, &content, &kind, &directValue, result_error);
+                                                       Assignment, &kind, &directValue, result_error);
             break;
         case LessThanChar:
             success = this->tokenizeRepeatableOperator(currentChar, LessThan, Operator, BitwiseLeft,
                                                        Operator, LessOrEqualThan, Operator,
-                                                       BitwiseLeftAssign, Assignment, &content, &kind, &directValue,
+                                                       BitwiseLeftAssign, Assignment, &kind, &directValue,
                                                        result_error);
             break;
         case GreatThanChar:
             success = this->tokenizeRepeatableOperator(currentChar, GreaterThan, Operator, BitwiseRight,
                                                        Operator, GreaterOrEqualThan, Operator,
-                                                       BitwiseRightAssign, Assignment, &content, &kind,
+                                                       BitwiseRightAssign, Assignment, &kind,
                                                        &directValue, result_error);
             break;
         case AddChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, Add, Operator, AddAssign, Assignment, &content,
+            success = this->tokenizeNotRepeatableOperator(Add, Operator, AddAssign, Assignment,
                                                           &kind, &directValue, result_error);
             break;
         case SubChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, Sub, Operator, SubAssign, Assignment, &content,
+            success = this->tokenizeNotRepeatableOperator(Sub, Operator, SubAssign, Assignment,
                                                           &kind, &directValue, result_error);
-
             break;
         case ModulusChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, Modulus, Operator, ModulusAssign,
-                                                          Assignment, &content, &kind, &directValue, result_error);
+            success = this->tokenizeNotRepeatableOperator(Modulus, Operator, ModulusAssign,
+                                                          Assignment, &kind, &directValue, result_error);
             break;
         case BitwiseXorChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, BitwiseXor, Operator,
-                                                          BitwiseXorAssign, Assignment, &content, &kind, &directValue,
+            success = this->tokenizeNotRepeatableOperator(BitwiseXor, Operator,
+                                                          BitwiseXorAssign, Assignment, &kind, &directValue,
                                                           result_error);
             break;
         case BitwiseAndChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, BitwiseAnd, Operator,
-                                                          BitwiseAndAssign, Assignment, &content, &kind, &directValue,
+            success = this->tokenizeNotRepeatableOperator(BitwiseAnd, Operator,
+                                                          BitwiseAndAssign, Assignment, &kind, &directValue,
                                                           result_error);
             break;
         case BitwiseOrChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, BitwiseOr, Operator, BitwiseOrAssign,
-                                                          Assignment, &content, &kind, &directValue, result_error);
+            success = this->tokenizeNotRepeatableOperator(BitwiseOr, Operator, BitwiseOrAssign,
+                                                          Assignment, &kind, &directValue, result_error);
             break;
         case SignNotChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, SignNot, Operator, NotEqual,
-                                                          Operator, &content, &kind, &directValue, result_error);
+            success = this->tokenizeNotRepeatableOperator(SignNot, Operator, NotEqual,
+                                                          Operator, &kind, &directValue, result_error);
             break;
         case NegateBitsChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, NegateBits, Operator,
-                                                          NegateBitsAssign, Assignment, &content, &kind, &directValue,
+            success = this->tokenizeNotRepeatableOperator(NegateBits, Operator,
+                                                          NegateBitsAssign, Assignment, &kind, &directValue,
                                                           result_error);
             break;
         case EqualsChar:
-            success = this->tokenizeNotRepeatableOperator(currentChar, Assign, Assignment, Equals,
-                                                          Operator, &content, &kind, &directValue, result_error);
+            success = this->tokenizeNotRepeatableOperator(Assign, Assignment, Equals,
+                                                          Operator, &kind, &directValue, result_error);
             break;
         case BackSlashChar:
-            if (this->codeReader->hasNext()) {
-                char nextChar = this->codeReader->currentChar();
-                if (nextChar != '\n') {
+            if (this->sourceHasNext()) {
+                if (this->currentChar() != '\n') {
                     (*result_error) = error::error(error::LexingError, "line escape not followed by a new line",
                                                    this->line);
                     return false;
                 }
-                base.push_back('\n');
-                content = base;
-                this->codeReader->next();
+                this->position++;
             }
             kind = PendingEscape;
             break;
         default:
-            if (currentChar == 'b') {
-                if (this->codeReader->hasNext()) {
-                    char nextChar = this->codeReader->currentChar();
-                    if (nextChar == '\'' || nextChar == '"') {
-                        this->codeReader->next();
-                        success = this->tokenizeStringLikeExpressions(nextChar, &content, &kind, &directValue,
-                                                                      result_error);
-                        if (success) {
-                            content = "b" + content;
-                        }
-                        if (directValue != Unknown) {
-                            directValue = ByteString;
-                        }
-                        break;
+            if (currentChar == 'b' && this->sourceHasNext()) {
+                char nextChar = this->currentChar();
+                if (nextChar == '\'' || nextChar == '"') {
+                    this->position++;
+                    success = this->tokenizeStringLikeExpressions(nextChar, &kind, &directValue, result_error);
+                    if (directValue != Unknown) {
+                        directValue = ByteString;
                     }
+                    break;
                 }
             }
-            success = this->tokenizeChars(currentChar, &content, &kind, &directValue, result_error);
+            success = this->tokenizeChars(start, &kind, &directValue, result_error);
             break;
     }
     if (!success) {
         return false;
     }
-    (*result) = token{content, directValue, kind, currentLine};
+    (*result) = token{this->source.substr(start, this->position - start), directValue, kind, currentLine,
+                      currentColumn, number};
     return true;
 }
 
 bool plasma::lexer::lexer::next(token *result, error::error *result_error) {
-    if (!this->_next(result, result_error)) {
-        return false;
-    }
-    if (result->kind == JunkKind) {
-        return this->next(result, result_error);
-    }
-    if (result->kind == Comment) {
-        return this->next(result, result_error);
-    }
-    if (result->kind == Whitespace) {
-        return this->next(result, result_error);
-    }
+    do {
+        if (!this->_next(result, result_error)) {
+            return false;
+        }
+    } while (result->kind == JunkKind || result->kind == Comment || result->kind == Whitespace);
     this->lastToken = *result;
     return true;
 }
 
 bool plasma::lexer::lexer::lastTokenIsSet() const {
     return this->lastToken.directValue == NotSet && this->lastToken.kind == NotSet && this->lastToken.line == -1 &&
-           this->lastToken.string.length() == 0;
+           this->lastToken.string.empty();
 }
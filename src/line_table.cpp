@@ -0,0 +1,108 @@
+#include "vm/line_table.h"
+
+static void write_varint(std::vector<uint8_t> *entries, uint64_t number) {
+    while (number >= 0x80) {
+        entries->push_back((uint8_t) (number | 0x80));
+        number >>= 7;
+    }
+    entries->push_back((uint8_t) number);
+}
+
+static uint64_t read_varint(const std::vector<uint8_t> &entries, size_t *offset) {
+    uint64_t number = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+        byte = entries[(*offset)++];
+        number |= (uint64_t) (byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return number;
+}
+
+static uint64_t zigzag(size_t current, size_t last) {
+    auto delta = (int64_t) (current - last);
+    return ((uint64_t) delta << 1) ^ (uint64_t) (delta >> 63);
+}
+
+static size_t unzigzag(uint64_t delta, size_t last) {
+    return last + (size_t) ((delta >> 1) ^ (~(delta & 1) + 1));
+}
+
+template<typename Visitor>
+void plasma::vm::line_table::decode(Visitor &&visit) const {
+    size_t offset = 0;
+    size_t index = 0;
+    size_t line = 0;
+    size_t column = 0;
+    while (offset < this->entries.size()) {
+        index += read_varint(this->entries, &offset);
+        line = unzigzag(read_varint(this->entries, &offset), line);
+        column = unzigzag(read_varint(this->entries, &offset), column);
+        if (!visit(index, line, column)) {
+            return;
+        }
+    }
+}
+
+void plasma::vm::line_table::add(size_t index, size_t line, size_t column) {
+    if (!this->entries.empty() && line == this->lastLine && column == this->lastColumn) {
+        return;
+    }
+    write_varint(&this->entries, index - this->lastIndex);
+    write_varint(&this->entries, zigzag(line, this->lastLine));
+    write_varint(&this->entries, zigzag(column, this->lastColumn));
+    this->lastIndex = index;
+    this->lastLine = line;
+    this->lastColumn = column;
+}
+
+bool plasma::vm::line_table::find(size_t index, size_t *line, size_t *column) const {
+    bool found = false;
+    this->decode([&](size_t entryIndex, size_t entryLine, size_t entryColumn) {
+        if (entryIndex > index) {
+            return false;
+        }
+        (*line) = entryLine;
+        (*column) = entryColumn;
+        found = true;
+        return true;
+    });
+    return found;
+}
+
+void plasma::vm::line_table::append(const line_table &other, size_t offset) {
+    other.decode([this, offset](size_t index, size_t line, size_t column) {
+        this->add(index + offset, line, column);
+        return true;
+    });
+}
+
+plasma::vm::line_table plasma::vm::line_table::slice(size_t start, size_t end) const {
+    line_table result;
+    bool hasPosition = false;
+    size_t line = 0;
+    size_t column = 0;
+    this->decode([&](size_t index, size_t entryLine, size_t entryColumn) {
+        if (index >= end) {
+            return false;
+        }
+        if (index <= start) {
+            // The last entry before the slice still positions its first instruction
+            hasPosition = true;
+            line = entryLine;
+            column = entryColumn;
+            return true;
+        }
+        if (hasPosition) {
+            result.add(0, line, column);
+            hasPosition = false;
+        }
+        result.add(index - start, entryLine, entryColumn);
+        return true;
+    });
+    if (hasPosition) {
+        result.add(0, line, column);
+    }
+    return result;
+}
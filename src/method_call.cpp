@@ -1,7 +1,7 @@
 #include "vm/virtual_machine.h"
 
 plasma::vm::value *plasma::vm::virtual_machine::call_function(context *c, value *function,
-                                                              const std::vector<value *> &arguments,
+                                                              arguments_span arguments,
                                                               bool *success) {
     auto state = c->protected_values_state();
     defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
@@ -9,19 +9,51 @@ plasma::vm::value *plasma::vm::virtual_machine::call_function(context *c, value
     for (const auto &argument : arguments) {
         c->protect_value(argument);
     }
-    bool isType = function->typeId == Type;
-    value *constructedObject;
+    value *constructedObject = nullptr;
+    value *callFunction = this->resolve_callable(c, function, arguments.size(), &constructedObject, success);
+    if (!(*success)) {
+        return callFunction;
+    }
+    c->protect_value(constructedObject);
+    c->protect_value(callFunction);
+    if (callFunction->callable_.isBuiltIn) {
+        return this->call_builtin(c, callFunction, constructedObject, arguments, success);
+    }
+    value *enterError = this->enter_function(c, callFunction, constructedObject);
+    if (enterError != nullptr) {
+        (*success) = false;
+        return enterError;
+    }
+    for (auto argument = arguments.rbegin();
+         argument != arguments.rend();
+         argument++) {
+
+        c->push_value(*argument);
+    }
+    // Run the function until its frame is left
+    c->peek_frame().nativeEntry = true;
+    return this->run(c, success);
+}
+
+plasma::vm::value *plasma::vm::virtual_machine::resolve_callable(context *c, value *function,
+                                                                 size_t numberOfArguments,
+                                                                 value **constructedObject,
+                                                                 bool *success) {
+    auto state = c->protected_values_state();
+    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+    c->protect_value(function);
+
     value *callFunction;
     if (function->typeId == Function) {
         callFunction = function;
-    } else if (isType) {
-        constructedObject = this->construct_object(c, function, success);
+    } else if (function->typeId == Type) {
+        (*constructedObject) = this->construct_object(c, function, success);
         if (!(*success)) {
-            return constructedObject;
+            return (*constructedObject);
         }
-        c->protect_value(constructedObject);
+        c->protect_value(*constructedObject);
         (*success) = false;
-        callFunction = constructedObject->get(c, this, Initialize, success);
+        callFunction = (*constructedObject)->get(c, this, Initialize, success);
         if (!(*success)) {
             return callFunction;
         }
@@ -31,54 +63,73 @@ plasma::vm::value *plasma::vm::virtual_machine::call_function(context *c, value
             return callFunction;
         }
         if (callFunction->typeId != Function) {
+            (*success) = false;
             return this->new_invalid_type_error(c, callFunction->get_type(c, this),
                                                 std::vector<std::string>{FunctionName, CallableName});
         }
     }
 
-    if (callFunction->callable_.numberOfArguments != arguments.size()) {
+    if (callFunction->callable_.numberOfArguments != numberOfArguments) {
         (*success) = false;
         return this->new_invalid_number_of_arguments_error(
-                c, callFunction->callable_.numberOfArguments, arguments.size()
+                c, callFunction->callable_.numberOfArguments, numberOfArguments
         );
     }
+    (*success) = true;
+    return callFunction;
+}
 
-    // Allocate a new symbol table
-    // The parent of this symbol table it always will be the parent symbol table  of the function
-    symbol_table *symbolTable = c->allocate_symbol_table(callFunction->symbols->parent);
-
-    value *self;
+/*
+ * Allocate the symbol table of a call
+ * The parent of this symbol table it always will be the parent symbol table  of the function
+ */
+static plasma::vm::symbol_table *call_symbol_table(plasma::vm::context *c, plasma::vm::value *callFunction,
+                                                   plasma::vm::value **self) {
+    plasma::vm::symbol_table *symbolTable = c->allocate_symbol_table(callFunction->symbols->parent);
     if (callFunction->self != nullptr) {
-        self = callFunction->self;
-        symbolTable->set(Self, callFunction->self);
+        (*self) = callFunction->self;
     } else {
-        self = callFunction;
-        symbolTable->set(Self, callFunction);
+        (*self) = callFunction;
     }
+    symbolTable->set(plasma::vm::Self, *self);
+    return symbolTable;
+}
 
-    c->push_symbol_table(symbolTable);
-
+plasma::vm::value *plasma::vm::virtual_machine::call_builtin(context *c, value *callFunction,
+                                                             value *constructedObject,
+                                                             arguments_span arguments,
+                                                             bool *success) {
+    value *self;
+    c->push_symbol_table(call_symbol_table(c, callFunction, &self));
     value *result;
-    if (callFunction->callable_.isBuiltIn) {
-        result = callFunction->callable_.callback(self, arguments, success);
+    if (callFunction->callable_.native != nullptr) {
+        result = callFunction->callable_.native(c, this, self, arguments, success);
     } else {
-        for (auto argument = arguments.rbegin();
-             argument != arguments.rend();
-             argument++) {
-
-            c->push_value(*argument);
-        }
-        // Fixme
-        bytecode bc = bytecode{
-                .instructions = callFunction->callable_.code,
-                .index = 0
-        };
-        result = this->execute(c, &bc, success);
+        result = callFunction->callable_.callback(self, arguments, success);
     }
-
     c->pop_symbol_table();
-    if (isType) {
+    if (constructedObject != nullptr && (*success)) {
         return constructedObject;
     }
     return result;
-}
\ No newline at end of file
+}
+
+plasma::vm::value *plasma::vm::virtual_machine::enter_function(context *c, value *callFunction,
+                                                               value *constructedObject) {
+    if (c->callDepth >= c->recursionLimit) {
+        return this->new_recursion_error(c, c->recursionLimit);
+    }
+    value *self;
+    // The symbol table is released when the frame is popped
+    c->push_symbol_table(call_symbol_table(c, callFunction, &self));
+    c->push_frame(frame{
+            .kind = FunctionFrame,
+            .ownsSymbolTable = true,
+            .code = &callFunction->callable_.code,
+            .index = 0,
+            .end = callFunction->callable_.code.size(),
+            .function = callFunction,
+            .constructed = constructedObject,
+    });
+    return nullptr;
+}
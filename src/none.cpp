@@ -1,151 +1,78 @@
 #include "vm/virtual_machine.h"
 
+namespace plasma::vm {
+    static value *none_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        (*success) = true;
+        if (right->typeId != NoneType) {
+            return vm->get_false(c);
+        }
+        return vm->get_true(c);
+    }
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::none_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        (*success) = true;
-                                        if (right->typeId != NoneType) {
-                                            return this->get_false(c);
-                                        }
-                                        return this->get_true(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        (*success) = true;
-                                        if (left->typeId != NoneType) {
-                                            return this->get_false(c);
-                                        }
-                                        return this->get_true(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        (*success) = true;
-                                        if (right->typeId != NoneType) {
-                                            return this->get_true(c);
-                                        }
-                                        return this->get_false(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        (*success) = true;
-                                        if (left->typeId != NoneType) {
-                                            return this->get_true(c);
-                                        }
-                                        return this->get_false(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_integer(c, false, -1);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+    static value *
+    none_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        (*success) = true;
+        if (left->typeId != NoneType) {
+            return vm->get_false(c);
+        }
+        return vm->get_true(c);
+    }
+
+    static value *
+    none_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        (*success) = true;
+        if (right->typeId != NoneType) {
+            return vm->get_true(c);
+        }
+        return vm->get_false(c);
+    }
+
+    static value *
+    none_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        (*success) = true;
+        if (left->typeId != NoneType) {
+            return vm->get_true(c);
+        }
+        return vm->get_false(c);
+    }
+
+    static value *none_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_integer(c, false, -1);
+    }
+
+    static value *
+    none_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_string(c, false, None);
+    }
 
-                                        (*success) = true;
-                                        return this->new_string(c, false, None);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_false(c);
-                                    }
-                            )
-                    );
-                }
-        );
+    static value *none_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_false(c);
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::none_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Equals, {1, none_equals}},
+            {RightEquals, {1, none_right_equals}},
+            {NotEquals, {1, none_not_equals}},
+            {RightNotEquals, {1, none_right_not_equals}},
+            {Hash, {0, none_hash}},
+            {ToString, {0, none_to_string}},
+            {ToBool, {0, none_to_bool}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::none_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &none_methods();
         return nullptr;
     };
 }
@@ -18,12 +18,12 @@ plasma::vm::virtual_machine::new_object(context *c, bool isBuiltIn, const std::s
     result->onDemandSymbols = std::unordered_map<std::string, on_demand_loader>();
 
     result->boolean = true;
-    result->string = "";
+    result->string = immutable_string();
     result->integer = 0;
     result->floating = 0;
-    result->content = std::vector<value *>();
-    result->keyValues = std::unordered_map<int64_t, std::vector<key_value>>();
-    result->bytes = std::vector<uint8_t>();
+    result->content = shared_content();
+    result->keyValues.clear();
+    result->bytes = immutable_bytes();
     this->object_initialize(isBuiltIn)(c, result);
     result->set(Self, result);
     return result;
@@ -37,11 +37,11 @@ plasma::vm::value *plasma::vm::virtual_machine::new_hash_table(context *c, bool
     return result;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::new_array(context *c, bool isBuiltIn,
-                                                          const std::vector<plasma::vm::value *> &content) {
+plasma::vm::value *plasma::vm::virtual_machine::new_array(context *c, bool isBuiltIn, shared_content content) {
     value *result = this->new_object(c, isBuiltIn, ArrayName, nullptr);
     result->typeId = Array;
-    result->content = content;
+    result->content = pack_content(content);
+    c->charge_payload(result->content.shared_memory_usage());
     this->array_initialize(isBuiltIn)(c, result);
 
     return result;
@@ -65,10 +65,11 @@ plasma::vm::virtual_machine::new_function(context *c, bool isBuiltIn,
 }
 
 plasma::vm::value *
-plasma::vm::virtual_machine::new_bytes(context *c, bool isBuiltIn, const std::vector<uint8_t> &bytes) {
+plasma::vm::virtual_machine::new_bytes(context *c, bool isBuiltIn, immutable_bytes bytes) {
     value *result = this->new_object(c, isBuiltIn, BytesName, nullptr);
     result->typeId = Bytes;
-    result->bytes = bytes;
+    result->bytes = std::move(bytes);
+    c->charge_payload(result->bytes.shared_memory_usage());
     this->bytes_initialize(isBuiltIn)(c, result);
 
     return result;
@@ -82,11 +83,17 @@ plasma::vm::value *plasma::vm::virtual_machine::new_iterator(context *c, bool is
     return result;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::new_tuple(context *c, bool isBuiltIn,
-                                                          const std::vector<plasma::vm::value *> &content) {
+plasma::vm::value *plasma::vm::virtual_machine::new_tuple(context *c, bool isBuiltIn, shared_content content) {
+    // Only Arrays hold packed content
+    if (content.packed()) {
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        return this->new_tuple(c, isBuiltIn, this->materialize_content(c, content));
+    }
     value *result = this->new_object(c, isBuiltIn, TupleName, nullptr);
     result->typeId = Tuple;
-    result->content = content;
+    result->content = std::move(content);
+    c->charge_payload(result->content.shared_memory_usage());
     this->tuple_initialize(isBuiltIn)(c, result);
 
     return result;
@@ -149,11 +156,12 @@ plasma::vm::value *plasma::vm::virtual_machine::new_integer(context *c, bool isB
     return result;
 }
 
-plasma::vm::value *plasma::vm::virtual_machine::new_string(context *c, bool isBuiltIn, const std::string &value_) {
+plasma::vm::value *plasma::vm::virtual_machine::new_string(context *c, bool isBuiltIn, immutable_string value_) {
     value *result = this->new_object(c, isBuiltIn, StringName, nullptr);
     result->typeId = String;
 
-    result->string = value_;
+    result->string = std::move(value_);
+    c->charge_payload(result->string.shared_memory_usage());
     this->string_initialize(isBuiltIn)(c, result);
 
     return result;
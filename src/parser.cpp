@@ -1,4 +1,3 @@
-#include <iostream>
 #include <utility>
 #include "compiler/parser.h"
 
@@ -56,6 +55,94 @@ void plasma::parser::parser::next() {
     this->currentToken = result;
 }
 
+void plasma::parser::parser::parseStatement(ast::node_list<ast::Node *> *body) {
+    lexer::lexer statementLexer = *this->Lexer;
+    lexer::token statementStart = this->currentToken;
+    try {
+        body->push_back(this->parseBinaryExpression(0));
+    } catch (error::error &syntaxError) {
+        this->recover(syntaxError, statementLexer, statementStart);
+    }
+}
+
+void plasma::parser::parser::recover(const error::error &syntaxError, const lexer::lexer &statementLexer,
+                                     const lexer::token &statementStart) {
+    // Once the lexer failed the enclosing statements can only fail because their source was cut
+    if (this->abandoned) {
+        return;
+    }
+    this->Errors.push_back(syntaxError);
+    if (syntaxError.type == error::LexingError) {
+        this->abandoned = true;
+        this->Lexer->complete = true;
+        return;
+    }
+    // Go back to the start of the statement to skip it as a whole
+    (*this->Lexer) = statementLexer;
+    this->currentToken = statementStart;
+    try {
+        this->skipStatement();
+    } catch (error::error &lexingError) {
+        this->Errors.push_back(lexingError);
+        this->abandoned = true;
+        this->Lexer->complete = true;
+    }
+}
+
+static bool opens_block(uint8_t directValue) {
+    switch (directValue) {
+        case plasma::lexer::If:
+        case plasma::lexer::Unless:
+        case plasma::lexer::While:
+        case plasma::lexer::For:
+        case plasma::lexer::Until:
+        case plasma::lexer::Switch:
+        case plasma::lexer::Module:
+        case plasma::lexer::Def:
+        case plasma::lexer::Interface:
+        case plasma::lexer::Class:
+        case plasma::lexer::Try:
+        case plasma::lexer::BEGIN:
+        case plasma::lexer::END:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void plasma::parser::parser::skipStatement() {
+    // Keywords that close the open blocks, end for most of them and while for do
+    std::vector<uint8_t> closers;
+    // Block keywords only count at the start of a line, if and unless are also one liner operators
+    bool lineStart = true;
+    while (this->hasNext()) {
+        if (this->kindMatch(lexer::Separator)) {
+            if (closers.empty()) {
+                return;
+            }
+            lineStart = true;
+            this->next();
+            continue;
+        }
+        if (lineStart) {
+            uint8_t directValue = this->currentToken.directValue;
+            if (!closers.empty() && directValue == closers.back()) {
+                closers.pop_back();
+                if (closers.empty() && directValue == lexer::End) {
+                    this->next();
+                    return;
+                }
+            } else if (opens_block(directValue)) {
+                closers.push_back(lexer::End);
+            } else if (directValue == lexer::Do) {
+                closers.push_back(lexer::While);
+            }
+        }
+        lineStart = false;
+        this->next();
+    }
+}
+
 bool plasma::parser::parser::directValueMatch(uint8_t directValue) const {
     return this->currentToken.directValue == directValue;
 }
@@ -84,7 +171,7 @@ plasma::parser::parser::parseAssignStatement(ast::Expression *leftHandSide) {
     if (!ast::isExpression(rightHandSide)) {
         throw newNonExpressionReceivedError(line, AssignStatement);
     }
-    return new ast::AssignStatement(
+    return this->Arena.make<ast::AssignStatement>(
             leftHandSide,
             assignmentToken,
             dynamic_cast<ast::Expression *>(rightHandSide)
@@ -94,7 +181,7 @@ plasma::parser::parser::parseAssignStatement(ast::Expression *leftHandSide) {
 plasma::ast::ForStatement *plasma::parser::parser::parseForStatement() {
     this->next();
     this->removeNewLines();
-    std::vector<ast::Identifier *> receivers;
+    ast::node_list<ast::Identifier *> receivers(&this->Arena);
     while (this->hasNext()) {
         if (this->directValueMatch(lexer::In)) {
             break;
@@ -102,7 +189,7 @@ plasma::ast::ForStatement *plasma::parser::parser::parseForStatement() {
             throw newSyntaxError(this->currentLine(), ForStatement);
         }
         this->removeNewLines();
-        receivers.push_back(new ast::Identifier(this->currentToken));
+        receivers.push_back(this->Arena.make<ast::Identifier>(this->currentToken));
         this->next();
         this->removeNewLines();
         if (this->directValueMatch(lexer::Comma)) {
@@ -127,7 +214,7 @@ plasma::ast::ForStatement *plasma::parser::parser::parseForStatement() {
         throw newSyntaxError(this->currentLine(), ForStatement);
     }
     this->next();
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -136,13 +223,17 @@ plasma::ast::ForStatement *plasma::parser::parser::parseForStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newStatementNeverEndedError(this->currentLine(), ForStatement);
     }
     this->next();
-    return new ast::ForStatement(receivers, dynamic_cast<ast::Expression *>(source), body);
+    return this->Arena.make<ast::ForStatement>(
+            std::move(receivers),
+            dynamic_cast<ast::Expression *>(source),
+            std::move(body)
+    );
 }
 
 plasma::ast::UntilStatement *plasma::parser::parser::parseUntilStatement() {
@@ -156,7 +247,7 @@ plasma::ast::UntilStatement *plasma::parser::parser::parseUntilStatement() {
         throw newSyntaxError(this->currentLine(), UntilStatement);
     }
     this->next();
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -165,13 +256,13 @@ plasma::ast::UntilStatement *plasma::parser::parser::parseUntilStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newStatementNeverEndedError(this->currentLine(), UntilStatement);
     }
     this->next();
-    return new ast::UntilStatement(dynamic_cast<ast::Expression *>(condition), body);
+    return this->Arena.make<ast::UntilStatement>(dynamic_cast<ast::Expression *>(condition), std::move(body));
 }
 
 plasma::ast::WhileStatement *plasma::parser::parser::parseWhileStatement() {
@@ -185,7 +276,7 @@ plasma::ast::WhileStatement *plasma::parser::parser::parseWhileStatement() {
         throw newSyntaxError(this->currentLine(), WhileStatement);
     }
     this->next();
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -194,18 +285,18 @@ plasma::ast::WhileStatement *plasma::parser::parser::parseWhileStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newStatementNeverEndedError(this->currentLine(), WhileStatement);
     }
     this->next();
-    return new ast::WhileStatement(dynamic_cast<ast::Expression *>(condition), body);
+    return this->Arena.make<ast::WhileStatement>(dynamic_cast<ast::Expression *>(condition), std::move(body));
 }
 
 plasma::ast::DoWhileStatement *plasma::parser::parser::parseDoWhileStatement() {
     this->next();
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     if (!this->directValueMatch(lexer::NewLine)) {
         throw newSyntaxError(this->currentLine(), DoWhileStatement);
     }
@@ -217,7 +308,7 @@ plasma::ast::DoWhileStatement *plasma::parser::parser::parseDoWhileStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::While)) {
         throw newSyntaxError(this->currentLine(), DoWhileStatement);
@@ -228,9 +319,9 @@ plasma::ast::DoWhileStatement *plasma::parser::parser::parseDoWhileStatement() {
     if (!ast::isExpression(condition)) {
         throw newNonExpressionReceivedError(this->currentLine(), DoWhileStatement);
     }
-    return new ast::DoWhileStatement(
+    return this->Arena.make<ast::DoWhileStatement>(
             dynamic_cast<ast::Expression *>(condition),
-            body
+            std::move(body)
     );
 }
 
@@ -240,12 +331,12 @@ plasma::ast::ModuleStatement *plasma::parser::parser::parseModuleStatement() {
     if (!this->kindMatch(lexer::IdentifierKind)) {
         throw newSyntaxError(this->currentLine(), ModuleStatement);
     }
-    ast::Identifier *name = new ast::Identifier(this->currentToken);
+    ast::Identifier *name = this->Arena.make<ast::Identifier>(this->currentToken);
     this->next();
     if (!this->directValueMatch(lexer::NewLine)) {
         throw newSyntaxError(this->currentLine(), ModuleStatement);
     }
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -254,15 +345,15 @@ plasma::ast::ModuleStatement *plasma::parser::parser::parseModuleStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newStatementNeverEndedError(this->currentLine(), ModuleStatement);
     }
     this->next();
-    return new ast::ModuleStatement(
+    return this->Arena.make<ast::ModuleStatement>(
             name,
-            body
+            std::move(body)
     );
 }
 
@@ -272,14 +363,14 @@ plasma::ast::FunctionDefinitionStatement *plasma::parser::parser::parseFunctionD
     if (!this->kindMatch(lexer::IdentifierKind)) {
         throw newSyntaxError(this->currentLine(), FunctionDefinitionStatement);
     }
-    ast::Identifier *name = new ast::Identifier(this->currentToken);
+    ast::Identifier *name = this->Arena.make<ast::Identifier>(this->currentToken);
     this->next();
     this->removeNewLines();
     if (!this->directValueMatch(lexer::OpenParentheses)) {
         throw newSyntaxError(this->currentLine(), FunctionDefinitionStatement);
     }
     this->next();
-    std::vector<ast::Identifier *> arguments;
+    ast::node_list<ast::Identifier *> arguments(&this->Arena);
     while (this->hasNext()) {
         if (this->directValueMatch(lexer::CloseParentheses)) {
             break;
@@ -288,7 +379,7 @@ plasma::ast::FunctionDefinitionStatement *plasma::parser::parser::parseFunctionD
         if (!this->kindMatch(lexer::IdentifierKind)) {
             throw newSyntaxError(this->currentLine(), FunctionDefinitionStatement);
         }
-        arguments.push_back(new ast::Identifier(this->currentToken));
+        arguments.push_back(this->Arena.make<ast::Identifier>(this->currentToken));
         this->next();
         this->removeNewLines();
         if (this->directValueMatch(lexer::Comma)) {
@@ -306,7 +397,7 @@ plasma::ast::FunctionDefinitionStatement *plasma::parser::parser::parseFunctionD
     if (!this->directValueMatch(lexer::NewLine)) {
         throw newSyntaxError(this->currentLine(), FunctionDefinitionStatement);
     }
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -315,13 +406,13 @@ plasma::ast::FunctionDefinitionStatement *plasma::parser::parser::parseFunctionD
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newStatementNeverEndedError(this->currentLine(), FunctionDefinitionStatement);
     }
     this->next();
-    return new ast::FunctionDefinitionStatement(name, arguments, body);
+    return this->Arena.make<ast::FunctionDefinitionStatement>(name, std::move(arguments), std::move(body));
 }
 
 plasma::ast::RaiseStatement *plasma::parser::parser::parseRaiseStatement() {
@@ -330,7 +421,7 @@ plasma::ast::RaiseStatement *plasma::parser::parser::parseRaiseStatement() {
     if (!ast::isExpression(x)) {
         throw newNonExpressionReceivedError(this->currentLine(), RaiseStatement);
     }
-    return new ast::RaiseStatement(dynamic_cast<ast::Expression *>(x));
+    return this->Arena.make<ast::RaiseStatement>(dynamic_cast<ast::Expression *>(x));
 }
 
 plasma::ast::TryStatement *plasma::parser::parser::parseTryStatement() {
@@ -338,7 +429,7 @@ plasma::ast::TryStatement *plasma::parser::parser::parseTryStatement() {
     if (!this->directValueMatch(lexer::NewLine)) {
         throw newSyntaxError(this->currentLine(), TryStatement);
     }
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -350,15 +441,15 @@ plasma::ast::TryStatement *plasma::parser::parser::parseTryStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
-    std::vector<ast::ExceptBlock *> exceptBlocks;
+    ast::node_list<ast::ExceptBlock *> exceptBlocks(&this->Arena);
     while (this->hasNext()) {
         if (!this->directValueMatch(lexer::Except)) {
             break;
         }
         this->next();
-        std::vector<ast::Expression *> targets;
+        ast::node_list<ast::Expression *> targets(&this->Arena);
         ast::Node *target;
         while (this->hasNext()) {
             if (this->directValueMatch(lexer::NewLine) ||
@@ -381,13 +472,13 @@ plasma::ast::TryStatement *plasma::parser::parser::parseTryStatement() {
             if (!this->kindMatch(lexer::IdentifierKind)) {
                 throw newSyntaxError(this->currentLine(), ExceptBlock);
             }
-            captureName = new ast::Identifier(this->currentToken);
+            captureName = this->Arena.make<ast::Identifier>(this->currentToken);
             this->next();
         }
         if (!this->directValueMatch(lexer::NewLine)) {
             throw newSyntaxError(this->currentLine(), ExceptBlock);
         }
-        std::vector<ast::Node *> exceptBody;
+        ast::node_list<ast::Node *> exceptBody(&this->Arena);
         while (this->hasNext()) {
             if (this->kindMatch(lexer::Separator)) {
                 this->next();
@@ -399,11 +490,17 @@ plasma::ast::TryStatement *plasma::parser::parser::parseTryStatement() {
                 }
                 continue;
             }
-            exceptBody.push_back(this->parseBinaryExpression(0));
-        }
-        exceptBlocks.push_back(new ast::ExceptBlock(new ast::TupleExpression(targets), captureName, exceptBody));
+            this->parseStatement(&exceptBody);
+        }
+        exceptBlocks.push_back(
+                this->Arena.make<ast::ExceptBlock>(
+                        this->Arena.make<ast::TupleExpression>(std::move(targets)),
+                        captureName,
+                        std::move(exceptBody)
+                )
+        );
     }
-    std::vector<ast::Node *> elseBody;
+    ast::node_list<ast::Node *> elseBody(&this->Arena);
     if (this->directValueMatch(lexer::Else)) {
         this->next();
         if (!this->directValueMatch(lexer::NewLine)) {
@@ -417,10 +514,10 @@ plasma::ast::TryStatement *plasma::parser::parser::parseTryStatement() {
                 }
                 continue;
             }
-            elseBody.push_back(this->parseBinaryExpression(0));
+            this->parseStatement(&elseBody);
         }
     }
-    std::vector<ast::Node *> finallyBody;
+    ast::node_list<ast::Node *> finallyBody(&this->Arena);
     if (this->directValueMatch(lexer::Finally)) {
         this->next();
         if (!this->directValueMatch(lexer::NewLine)) {
@@ -434,14 +531,19 @@ plasma::ast::TryStatement *plasma::parser::parser::parseTryStatement() {
                 }
                 continue;
             }
-            finallyBody.push_back(this->parseBinaryExpression(0));
+            this->parseStatement(&finallyBody);
         }
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newSyntaxError(this->currentLine(), TryStatement);
     }
     this->next();
-    return new ast::TryStatement(body, exceptBlocks, elseBody, finallyBody);
+    return this->Arena.make<ast::TryStatement>(
+            std::move(body),
+            std::move(exceptBlocks),
+            std::move(elseBody),
+            std::move(finallyBody)
+    );
 }
 
 plasma::ast::BeginStatement *plasma::parser::parser::parseBeginStatement() {
@@ -449,7 +551,7 @@ plasma::ast::BeginStatement *plasma::parser::parser::parseBeginStatement() {
     if (!this->directValueMatch(lexer::NewLine)) {
         throw newSyntaxError(this->currentLine(), BeginStatement);
     }
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -458,13 +560,13 @@ plasma::ast::BeginStatement *plasma::parser::parser::parseBeginStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newStatementNeverEndedError(this->currentLine(), BeginStatement);
     }
     this->next();
-    return new ast::BeginStatement(body);
+    return this->Arena.make<ast::BeginStatement>(std::move(body));
 }
 
 plasma::ast::EndStatement *plasma::parser::parser::parseEndStatement() {
@@ -472,7 +574,7 @@ plasma::ast::EndStatement *plasma::parser::parser::parseEndStatement() {
     if (!this->directValueMatch(lexer::NewLine)) {
         throw newSyntaxError(this->currentLine(), EndStatement);
     }
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -481,13 +583,13 @@ plasma::ast::EndStatement *plasma::parser::parser::parseEndStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newStatementNeverEndedError(this->currentLine(), EndStatement);
     }
     this->next();
-    return new ast::EndStatement(body);
+    return this->Arena.make<ast::EndStatement>(std::move(body));
 }
 
 plasma::ast::ClassStatement *plasma::parser::parser::parseClassStatement() {
@@ -496,9 +598,9 @@ plasma::ast::ClassStatement *plasma::parser::parser::parseClassStatement() {
     if (!this->kindMatch(lexer::IdentifierKind)) {
         throw newSyntaxError(this->currentLine(), ClassStatement);
     }
-    ast::Identifier *name = new ast::Identifier(this->currentToken);
+    ast::Identifier *name = this->Arena.make<ast::Identifier>(this->currentToken);
     this->next();
-    std::vector<ast::Expression *> bases;
+    ast::node_list<ast::Expression *> bases(&this->Arena);
     ast::Node *base;
     if (this->directValueMatch(lexer::OpenParentheses)) {
         this->next();
@@ -527,7 +629,7 @@ plasma::ast::ClassStatement *plasma::parser::parser::parseClassStatement() {
         throw newSyntaxError(this->currentLine(), ClassStatement);
     }
     this->next();
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->directValueMatch(lexer::End)) {
             break;
@@ -536,16 +638,16 @@ plasma::ast::ClassStatement *plasma::parser::parser::parseClassStatement() {
             this->next();
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newStatementNeverEndedError(this->currentLine(), ClassStatement);
     }
     this->next();
-    return new ast::ClassStatement(
+    return this->Arena.make<ast::ClassStatement>(
             name,
-            bases,
-            body
+            std::move(bases),
+            std::move(body)
     );
 }
 
@@ -555,9 +657,9 @@ plasma::ast::InterfaceStatement *plasma::parser::parser::parseInterfaceStatement
     if (!this->kindMatch(lexer::IdentifierKind)) {
         throw newSyntaxError(this->currentLine(), InterfaceStatement);
     }
-    ast::Identifier *name = new ast::Identifier(this->currentToken);
+    ast::Identifier *name = this->Arena.make<ast::Identifier>(this->currentToken);
     this->next();
-    std::vector<ast::Expression *> bases;
+    ast::node_list<ast::Expression *> bases(&this->Arena);
     ast::Node *base;
     if (this->directValueMatch(lexer::OpenParentheses)) {
         this->next();
@@ -586,7 +688,7 @@ plasma::ast::InterfaceStatement *plasma::parser::parser::parseInterfaceStatement
         throw newSyntaxError(this->currentLine(), InterfaceStatement);
     }
     this->removeNewLines();
-    std::vector<ast::FunctionDefinitionStatement *> methods;
+    ast::node_list<ast::FunctionDefinitionStatement *> methods(&this->Arena);
     ast::Node *node;
     while (this->hasNext()) {
         if (this->directValueMatch(lexer::End)) {
@@ -607,7 +709,7 @@ plasma::ast::InterfaceStatement *plasma::parser::parser::parseInterfaceStatement
         throw newStatementNeverEndedError(this->currentLine(), InterfaceStatement);
     }
     this->next();
-    return new ast::InterfaceStatement(name, bases, methods);
+    return this->Arena.make<ast::InterfaceStatement>(name, std::move(bases), std::move(methods));
 }
 
 plasma::ast::IfStatement *plasma::parser::parser::parseIfStatement() {
@@ -621,7 +723,7 @@ plasma::ast::IfStatement *plasma::parser::parser::parseIfStatement() {
     if (!this->directValueMatch(lexer::NewLine)) {
         throw newSyntaxError(this->currentLine(), IfStatement);
     }
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -632,12 +734,12 @@ plasma::ast::IfStatement *plasma::parser::parser::parseIfStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
-    auto rootIf = new ast::IfStatement(
+    auto rootIf = this->Arena.make<ast::IfStatement>(
             dynamic_cast<ast::Expression *>(condition),
-            body,
-            std::vector<ast::Node *>()
+            std::move(body),
+            ast::node_list<ast::Node *>(&this->Arena)
     );
     ast::IfStatement *lastIfBlock = rootIf;
     if (this->directValueMatch(lexer::Elif)) {
@@ -662,7 +764,7 @@ plasma::ast::IfStatement *plasma::parser::parser::parseIfStatement() {
             if (!this->directValueMatch(lexer::NewLine)) {
                 throw newSyntaxError(this->currentLine(), ElifBlock);
             }
-            std::vector<ast::Node *> elifBody;
+            ast::node_list<ast::Node *> elifBody(&this->Arena);
             while (this->hasNext()) {
                 if (this->kindMatch(lexer::Separator)) {
                     this->next();
@@ -673,12 +775,12 @@ plasma::ast::IfStatement *plasma::parser::parser::parseIfStatement() {
                     }
                     continue;
                 }
-                elifBody.push_back(this->parseBinaryExpression(0));
+                this->parseStatement(&elifBody);
             }
-            auto newLastIf = new ast::IfStatement(
+            auto newLastIf = this->Arena.make<ast::IfStatement>(
                     dynamic_cast<ast::Expression *>(elifCondition),
-                    elifBody,
-                    std::vector<ast::Node *>()
+                    std::move(elifBody),
+                    ast::node_list<ast::Node *>(&this->Arena)
             );
             lastIfBlock->Else.push_back(newLastIf);
             lastIfBlock = newLastIf;
@@ -701,7 +803,7 @@ plasma::ast::IfStatement *plasma::parser::parser::parseIfStatement() {
                 }
                 continue;
             }
-            lastIfBlock->Else.push_back(this->parseBinaryExpression(0));
+            this->parseStatement(&lastIfBlock->Else);
         }
     }
     if (!this->directValueMatch(lexer::End)) {
@@ -723,7 +825,7 @@ plasma::ast::UnlessStatement *plasma::parser::parser::parseUnlessStatement() {
     if (!this->directValueMatch(lexer::NewLine)) {
         throw newSyntaxError(this->currentLine(), UnlessStatement);
     }
-    std::vector<ast::Node *> body;
+    ast::node_list<ast::Node *> body(&this->Arena);
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
@@ -734,12 +836,12 @@ plasma::ast::UnlessStatement *plasma::parser::parser::parseUnlessStatement() {
             }
             continue;
         }
-        body.push_back(this->parseBinaryExpression(0));
+        this->parseStatement(&body);
     }
-    auto rootUnless = new ast::UnlessStatement(
+    auto rootUnless = this->Arena.make<ast::UnlessStatement>(
             dynamic_cast<ast::Expression *>(condition),
-            body,
-            std::vector<ast::Node *>()
+            std::move(body),
+            ast::node_list<ast::Node *>(&this->Arena)
     );
     ast::UnlessStatement *lastUnlessBlock = rootUnless;
     if (this->directValueMatch(lexer::Elif)) {
@@ -764,7 +866,7 @@ plasma::ast::UnlessStatement *plasma::parser::parser::parseUnlessStatement() {
             if (!this->directValueMatch(lexer::NewLine)) {
                 throw newSyntaxError(this->currentLine(), ElifBlock);
             }
-            std::vector<ast::Node *> elifBody;
+            ast::node_list<ast::Node *> elifBody(&this->Arena);
             while (this->hasNext()) {
                 if (this->kindMatch(lexer::Separator)) {
                     this->next();
@@ -775,12 +877,12 @@ plasma::ast::UnlessStatement *plasma::parser::parser::parseUnlessStatement() {
                     }
                     continue;
                 }
-                elifBody.push_back(this->parseBinaryExpression(0));
+                this->parseStatement(&elifBody);
             }
-            auto newLastUnless = new ast::UnlessStatement(
+            auto newLastUnless = this->Arena.make<ast::UnlessStatement>(
                     dynamic_cast<ast::Expression *>(elifCondition),
-                    elifBody,
-                    std::vector<ast::Node *>()
+                    std::move(elifBody),
+                    ast::node_list<ast::Node *>(&this->Arena)
             );
             lastUnlessBlock->Else.push_back(newLastUnless);
             lastUnlessBlock = newLastUnless;
@@ -803,7 +905,7 @@ plasma::ast::UnlessStatement *plasma::parser::parser::parseUnlessStatement() {
                 }
                 continue;
             }
-            lastUnlessBlock->Else.push_back(this->parseBinaryExpression(0));
+            this->parseStatement(&lastUnlessBlock->Else);
         }
     }
     if (!this->directValueMatch(lexer::End)) {
@@ -825,7 +927,7 @@ plasma::ast::SwitchStatement *plasma::parser::parser::parseSwitchStatement() {
         throw newSyntaxError(this->currentLine(), SwitchStatement);
     }
     this->next();
-    std::vector<ast::CaseBlock *> caseBlocks;
+    ast::node_list<ast::CaseBlock *> caseBlocks(&this->Arena);
     if (this->directValueMatch(lexer::Case)) {
         while (this->hasNext()) {
             if (this->directValueMatch(lexer::Default) || this->directValueMatch(lexer::End)) {
@@ -833,7 +935,7 @@ plasma::ast::SwitchStatement *plasma::parser::parser::parseSwitchStatement() {
             }
             this->next();
             this->removeNewLines();
-            std::vector<ast::Expression *> cases;
+            ast::node_list<ast::Expression *> cases(&this->Arena);
             ast::Node *caseTarget;
             while (this->hasNext()) {
                 caseTarget = this->parseBinaryExpression(0);
@@ -852,7 +954,7 @@ plasma::ast::SwitchStatement *plasma::parser::parser::parseSwitchStatement() {
             if (!this->directValueMatch(lexer::NewLine)) {
                 throw newSyntaxError(this->currentLine(), CaseBlock);
             }
-            std::vector<ast::Node *> caseBody;
+            ast::node_list<ast::Node *> caseBody(&this->Arena);
             while (this->hasNext()) {
                 if (this->kindMatch(lexer::Separator)) {
                     this->next();
@@ -862,12 +964,12 @@ plasma::ast::SwitchStatement *plasma::parser::parser::parseSwitchStatement() {
                     }
                     continue;
                 }
-                caseBody.push_back(this->parseBinaryExpression(0));
+                this->parseStatement(&caseBody);
             }
-            caseBlocks.push_back(new ast::CaseBlock(cases, caseBody));
+            caseBlocks.push_back(this->Arena.make<ast::CaseBlock>(std::move(cases), std::move(caseBody)));
         }
     }
-    std::vector<ast::Node *> defaultBody;
+    ast::node_list<ast::Node *> defaultBody(&this->Arena);
     if (this->directValueMatch(lexer::Default)) {
         this->next();
         if (!this->directValueMatch(lexer::NewLine)) {
@@ -881,20 +983,24 @@ plasma::ast::SwitchStatement *plasma::parser::parser::parseSwitchStatement() {
                 }
                 continue;
             }
-            defaultBody.push_back(this->parseBinaryExpression(0));
+            this->parseStatement(&defaultBody);
         }
     }
     if (!this->directValueMatch(lexer::End)) {
         throw newSyntaxError(this->currentLine(), SwitchStatement);
     }
     this->next();
-    return new ast::SwitchStatement(dynamic_cast<ast::Expression *>(target), caseBlocks, defaultBody);
+    return this->Arena.make<ast::SwitchStatement>(
+            dynamic_cast<ast::Expression *>(target),
+            std::move(caseBlocks),
+            std::move(defaultBody)
+    );
 }
 
 plasma::ast::ReturnStatement *plasma::parser::parser::parseReturnStatement() {
     this->next();
     this->removeNewLines();
-    std::vector<ast::Expression *> return_results;
+    ast::node_list<ast::Expression *> return_results(&this->Arena);
     ast::Node *return_result;
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator) || this->kindMatch(lexer::EndOfFile)) {
@@ -912,27 +1018,27 @@ plasma::ast::ReturnStatement *plasma::parser::parser::parseReturnStatement() {
             throw newSyntaxError(this->currentLine(), ReturnStatement);
         }
     }
-    return new ast::ReturnStatement(return_results);
+    return this->Arena.make<ast::ReturnStatement>(std::move(return_results));
 }
 
 plasma::ast::ContinueStatement *plasma::parser::parser::parseContinueStatement() {
     this->next();
-    return new ast::ContinueStatement();
+    return this->Arena.make<ast::ContinueStatement>();
 }
 
 plasma::ast::BreakStatement *plasma::parser::parser::parseBreakStatement() {
     this->next();
-    return new ast::BreakStatement();
+    return this->Arena.make<ast::BreakStatement>();
 }
 
 plasma::ast::RedoStatement *plasma::parser::parser::parseRedoStatement() {
     this->next();
-    return new ast::RedoStatement();
+    return this->Arena.make<ast::RedoStatement>();
 }
 
 plasma::ast::PassStatement *plasma::parser::parser::parsePassStatement() {
     this->next();
-    return new ast::PassStatement();
+    return this->Arena.make<ast::PassStatement>();
 }
 
 /*
@@ -961,8 +1067,8 @@ plasma::ast::Node *plasma::parser::parser::parseBinaryExpression(uint8_t precede
         if (!ast::isExpression(rightHandSide)) {
             throw newNonExpressionReceivedError(line, BinaryExpression);
         }
-        leftHandSide = new ast::BinaryExpression(dynamic_cast<ast::Expression *>(leftHandSide), operator_,
-                                                 dynamic_cast<ast::Expression *>(rightHandSide));
+        leftHandSide = this->Arena.make<ast::BinaryExpression>(dynamic_cast<ast::Expression *>(leftHandSide), operator_,
+                                                               dynamic_cast<ast::Expression *>(rightHandSide));
     }
     return leftHandSide;
 }
@@ -985,7 +1091,7 @@ plasma::ast::Node *plasma::parser::parser::parseUnaryExpression() {
                 if (!ast::isExpression(x)) {
                     throw newNonExpressionReceivedError(line, PointerExpression);
                 }
-                return new ast::UnaryExpression(operator_, dynamic_cast<ast::Expression *>(x));
+                return this->Arena.make<ast::UnaryExpression>(operator_, dynamic_cast<ast::Expression *>(x));
             default:
                 break;
         }
@@ -1044,7 +1150,7 @@ plasma::ast::BasicLiteralExpression *plasma::parser::parser::parseLiteral() {
         case lexer::None:
             tok = this->currentToken;
             this->next();
-            return new ast::BasicLiteralExpression(tok);
+            return this->Arena.make<ast::BasicLiteralExpression>(tok);
         default:
             break;
     }
@@ -1061,7 +1167,7 @@ plasma::ast::Node *plasma::parser::parser::parseOperand() {
         case lexer::IdentifierKind:
             identifier = this->currentToken;
             this->next();
-            return new ast::Identifier(identifier);
+            return this->Arena.make<ast::Identifier>(identifier);
         case lexer::Keyboard:
             switch (this->currentToken.directValue) {
                 case lexer::Lambda:
@@ -1119,14 +1225,12 @@ plasma::ast::Node *plasma::parser::parser::parseOperand() {
         default:
             break;
     }
-    // FixMe: Why is this a step behind?
-    std::cout << "Token: " << this->currentToken.string << " Kind: " << std::to_string(this->currentToken.kind)
-              << " Direct Value: " << std::to_string(this->currentToken.directValue) << std::endl;
-    throw error::error(error::LexingError, "Unknown Token", this->currentLine());
+    // The lexer produced the token, it just can not start an operand here
+    throw error::error(error::SyntaxError, "Unexpected Token " + std::string(this->currentToken.string), this->currentLine());
 }
 
 plasma::ast::LambdaExpression *plasma::parser::parser::parseLambdaExpression() {
-    std::vector<ast::Identifier *> arguments;
+    ast::node_list<ast::Identifier *> arguments(&this->Arena);
     this->next();
     int line;
     ast::Node *identifier;
@@ -1159,11 +1263,11 @@ plasma::ast::LambdaExpression *plasma::parser::parser::parseLambdaExpression() {
     if (!ast::isExpression(code)) {
         throw newNonExpressionReceivedError(line, LambdaExpression);
     }
-    std::vector<ast::Expression *> results;
+    ast::node_list<ast::Expression *> results(&this->Arena);
     results.push_back(dynamic_cast<ast::Expression *>(code));
-    return new ast::LambdaExpression(
-            arguments,
-            new ast::ReturnStatement(results)
+    return this->Arena.make<ast::LambdaExpression>(
+            std::move(arguments),
+            this->Arena.make<ast::ReturnStatement>(std::move(results))
     );
 }
 
@@ -1184,11 +1288,11 @@ plasma::ast::Node *plasma::parser::parser::parseParenthesesExpression() {
     }
     if (this->directValueMatch(lexer::CloseParentheses)) {
         this->next();
-        return new ast::ParenthesesExpression(dynamic_cast<ast::Expression *>(firstExpression));
+        return this->Arena.make<ast::ParenthesesExpression>(dynamic_cast<ast::Expression *>(firstExpression));
     } else if (!this->directValueMatch(lexer::Comma)) {
         throw newSyntaxError(this->currentLine(), ParenthesesExpression);
     }
-    std::vector<ast::Expression *> values;
+    ast::node_list<ast::Expression *> values(&this->Arena);
     values.push_back(dynamic_cast<ast::Expression *>(firstExpression));
     this->next();
     ast::Node *nextValue;
@@ -1215,14 +1319,14 @@ plasma::ast::Node *plasma::parser::parser::parseParenthesesExpression() {
         throw newExpressionNeverClosed(this->currentLine(), TupleExpression);
     }
     this->next();
-    return new ast::TupleExpression(values);
+    return this->Arena.make<ast::TupleExpression>(std::move(values));
 }
 
 plasma::ast::ArrayExpression *plasma::parser::parser::parseArrayExpression() {
     this->next();
     this->removeNewLines();
     ast::Node *value;
-    std::vector<ast::Expression *> values;
+    ast::node_list<ast::Expression *> values(&this->Arena);
     int line;
     while (this->hasNext()) {
         if (this->directValueMatch(lexer::CloseSquareBracket)) {
@@ -1243,14 +1347,14 @@ plasma::ast::ArrayExpression *plasma::parser::parser::parseArrayExpression() {
         }
     }
     this->next();
-    return new ast::ArrayExpression(values);
+    return this->Arena.make<ast::ArrayExpression>(std::move(values));
 }
 
 plasma::ast::HashExpression *plasma::parser::parser::parseHashExpression() {
     this->next();
     this->removeNewLines();
     int line;
-    std::vector<ast::KeyValue *> keyValues;
+    ast::node_list<ast::KeyValue *> keyValues(&this->Arena);
     ast::Node *leftHandSide;
     ast::Node *rightHandSide;
     while (this->hasNext()) {
@@ -1275,8 +1379,8 @@ plasma::ast::HashExpression *plasma::parser::parser::parseHashExpression() {
             throw newNonExpressionReceivedError(this->currentLine(), HashExpression);
         }
         keyValues.push_back(
-                new ast::KeyValue(dynamic_cast<ast::Expression *>(leftHandSide),
-                                  dynamic_cast<ast::Expression *>(rightHandSide))
+                this->Arena.make<ast::KeyValue>(dynamic_cast<ast::Expression *>(leftHandSide),
+                                                dynamic_cast<ast::Expression *>(rightHandSide))
         );
         this->removeNewLines();
         if (this->directValueMatch(lexer::Comma)) {
@@ -1288,7 +1392,7 @@ plasma::ast::HashExpression *plasma::parser::parser::parseHashExpression() {
         throw newSyntaxError(this->currentLine(), HashExpression);
     }
     this->next();
-    return new ast::HashExpression(keyValues);
+    return this->Arena.make<ast::HashExpression>(std::move(keyValues));
 }
 
 plasma::ast::SelectorExpression *
@@ -1304,7 +1408,7 @@ plasma::parser::parser::parseSelectorExpression(ast::Expression *source) {
         if (identifier.kind != lexer::IdentifierKind) {
             throw newSyntaxError(this->currentLine(), SelectorExpression);
         }
-        selector = new ast::SelectorExpression(selector, new ast::Identifier(identifier));
+        selector = this->Arena.make<ast::SelectorExpression>(selector, this->Arena.make<ast::Identifier>(identifier));
         this->next();
     }
     return dynamic_cast<ast::SelectorExpression *>(selector);
@@ -1312,7 +1416,7 @@ plasma::parser::parser::parseSelectorExpression(ast::Expression *source) {
 
 plasma::ast::MethodInvocationExpression *
 plasma::parser::parser::parseMethodInvocationExpression(ast::Expression *method) {
-    std::vector<ast::Expression *> arguments;
+    ast::node_list<ast::Expression *> arguments(&this->Arena);
     this->next();
     this->removeNewLines();
     int line;
@@ -1337,7 +1441,7 @@ plasma::parser::parser::parseMethodInvocationExpression(ast::Expression *method)
         throw newSyntaxError(this->currentLine(), MethodInvocationExpression);
     }
     this->next();
-    return new ast::MethodInvocationExpression(method, arguments);
+    return this->Arena.make<ast::MethodInvocationExpression>(method, std::move(arguments));
 }
 
 plasma::ast::IndexExpression *plasma::parser::parser::parseIndexExpression(ast::Expression *source) {
@@ -1353,7 +1457,7 @@ plasma::ast::IndexExpression *plasma::parser::parser::parseIndexExpression(ast::
         throw newSyntaxError(this->currentLine(), IndexExpression);
     }
     this->next();
-    return new ast::IndexExpression(
+    return this->Arena.make<ast::IndexExpression>(
             source,
             dynamic_cast<ast::Expression *>(index)
     );
@@ -1369,7 +1473,11 @@ plasma::parser::parser::parseIfOneLinerExpression(ast::Expression *onTrueResult)
         throw newNonExpressionReceivedError(line, IfOneLinerExpression);
     }
     if (!this->directValueMatch(lexer::Else)) {
-        return new ast::IfOneLinerExpression(onTrueResult, dynamic_cast<ast::Expression *>(condition));
+        return this->Arena.make<ast::IfOneLinerExpression>(
+                onTrueResult,
+                dynamic_cast<ast::Expression *>(condition),
+                this->Arena.make<ast::Identifier>(lexer::token{.string = lexer::NoneString})
+        );
     }
     this->next();
     this->removeNewLines();
@@ -1378,7 +1486,7 @@ plasma::parser::parser::parseIfOneLinerExpression(ast::Expression *onTrueResult)
     if (!ast::isExpression(elseResult)) {
         throw newNonExpressionReceivedError(line, OneLineElseBlock);
     }
-    return new ast::IfOneLinerExpression(
+    return this->Arena.make<ast::IfOneLinerExpression>(
             onTrueResult,
             dynamic_cast<ast::Expression *>(condition),
             dynamic_cast<ast::Expression *>(elseResult)
@@ -1395,7 +1503,11 @@ plasma::parser::parser::parseUnlessOneLinerExpression(ast::Expression *onFalseRe
         throw newNonExpressionReceivedError(line, UnlessOneLinerExpression);
     }
     if (!this->directValueMatch(lexer::Else)) {
-        return new ast::UnlessOneLinerExpression(onFalseResult, dynamic_cast<ast::Expression *>(condition));
+        return this->Arena.make<ast::UnlessOneLinerExpression>(
+                onFalseResult,
+                dynamic_cast<ast::Expression *>(condition),
+                this->Arena.make<ast::Identifier>(lexer::token{.string = lexer::NoneString})
+        );
     }
     this->next();
     this->removeNewLines();
@@ -1404,7 +1516,7 @@ plasma::parser::parser::parseUnlessOneLinerExpression(ast::Expression *onFalseRe
     if (!ast::isExpression(elseResult)) {
         throw newNonExpressionReceivedError(line, OneLineElseBlock);
     }
-    return new ast::UnlessOneLinerExpression(
+    return this->Arena.make<ast::UnlessOneLinerExpression>(
             onFalseResult,
             dynamic_cast<ast::Expression *>(condition),
             dynamic_cast<ast::Expression *>(elseResult)
@@ -1414,7 +1526,7 @@ plasma::parser::parser::parseUnlessOneLinerExpression(ast::Expression *onFalseRe
 plasma::ast::GeneratorExpression *plasma::parser::parser::parseGeneratorExpression(ast::Expression *expression) {
     this->next();
     this->removeNewLines();
-    std::vector<ast::Identifier *> variables;
+    ast::node_list<ast::Identifier *> variables(&this->Arena);
     int numberOfVariables = 0;
     while (this->hasNext()) {
         if (this->directValueMatch(lexer::In)) {
@@ -1424,7 +1536,7 @@ plasma::ast::GeneratorExpression *plasma::parser::parser::parseGeneratorExpressi
         if (!this->kindMatch(lexer::IdentifierKind)) {
             throw newNonIdentifierReceivedError(this->currentLine(), GeneratorExpression);
         }
-        variables.push_back(new ast::Identifier(this->currentToken));
+        variables.push_back(this->Arena.make<ast::Identifier>(this->currentToken));
         numberOfVariables++;
         this->next();
         this->removeNewLines();
@@ -1450,24 +1562,56 @@ plasma::ast::GeneratorExpression *plasma::parser::parser::parseGeneratorExpressi
         throw newSyntaxError(line, GeneratorExpression);
     }
     this->next();
-    return new ast::GeneratorExpression(expression, variables, dynamic_cast<ast::Expression *>(source));
+    return this->Arena.make<ast::GeneratorExpression>(
+            expression,
+            std::move(variables),
+            dynamic_cast<ast::Expression *>(source)
+    );
 }
 
 plasma::ast::Program *plasma::parser::parser::parse() {
-    auto result = new ast::Program();
-    this->next();
+    auto result = this->Arena.make<ast::Program>(&this->Arena);
+    for (ast::Node *node = this->parseTopLevelStatement();
+         node != nullptr;
+         node = this->parseTopLevelStatement()) {
+        if (node->TypeID == ast::BeginID) {
+            result->Begin = dynamic_cast<ast::BeginStatement *>(node);
+        } else if (node->TypeID == ast::EndID) {
+            result->End = dynamic_cast<ast::EndStatement *>(node);
+        } else {
+            result->Body.push_back(node);
+        }
+    }
+    return result;
+}
+
+plasma::ast::Node *plasma::parser::parser::parseTopLevelStatement() {
+    if (!this->started) {
+        this->started = true;
+        try {
+            this->next();
+        } catch (error::error &lexingError) {
+            this->recover(lexingError, *this->Lexer, this->currentToken);
+        }
+    }
     while (this->hasNext()) {
         if (this->kindMatch(lexer::Separator)) {
             this->next();
             continue;
         }
-        if (this->directValueMatch(lexer::BEGIN)) {
-            result->Begin = dynamic_cast<ast::BeginStatement *>(this->parseBeginStatement());
-        } else if (this->directValueMatch(lexer::END)) {
-            result->End = std::any_cast<ast::EndStatement *>(this->parseEndStatement());
-        } else {
-            result->Body.push_back(this->parseBinaryExpression(0));
+        lexer::lexer statementLexer = *this->Lexer;
+        lexer::token statementStart = this->currentToken;
+        try {
+            if (this->directValueMatch(lexer::BEGIN)) {
+                return this->parseBeginStatement();
+            }
+            if (this->directValueMatch(lexer::END)) {
+                return this->parseEndStatement();
+            }
+            return this->parseBinaryExpression(0);
+        } catch (error::error &syntaxError) {
+            this->recover(syntaxError, statementLexer, statementStart);
         }
     }
-    return result;
+    return nullptr;
 }
\ No newline at end of file
@@ -1,37 +1,116 @@
+#include <cstdio>
+#include <utility>
+
 #include "reader.h"
 
-void plasma::reader::string_reader::next() {
-    this->currentIndex++;
-}
+#ifdef _WIN32
+
+#include <windows.h>
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-void plasma::reader::string_reader::redo() {
-    this->currentIndex--;
+#endif
+
+void plasma::reader::string_reader_new(string_reader *s_reader, std::string string) {
+    s_reader->content = std::move(string);
 }
 
-int plasma::reader::string_reader::index() {
-    return this->currentIndex;
+bool plasma::reader::string_reader_new_from_file(string_reader *s_reader, const std::string &filePath) {
+    std::FILE *file = std::fopen(filePath.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool success = std::fseek(file, 0, SEEK_END) == 0;
+    long size = success ? std::ftell(file) : -1;
+    success = size >= 0 && std::fseek(file, 0, SEEK_SET) == 0;
+    if (success) {
+        s_reader->content.resize((size_t) size);
+        success = std::fread(s_reader->content.data(), 1, (size_t) size, file) == (size_t) size;
+    }
+    std::fclose(file);
+    return success;
 }
 
-char plasma::reader::string_reader::currentChar() {
-    return this->content[this->currentIndex];
+#ifdef _WIN32
+
+plasma::reader::file_reader::~file_reader() {
+    if (this->data != nullptr) {
+        UnmapViewOfFile(this->data);
+    }
+    if (this->mapping != nullptr) {
+        CloseHandle(this->mapping);
+    }
+    if (this->file != nullptr) {
+        CloseHandle(this->file);
+    }
 }
 
-bool plasma::reader::string_reader::hasNext() {
-    return this->currentIndex < this->content.length();
+bool plasma::reader::file_reader_new(file_reader *f_reader, const std::string &filePath) {
+    HANDLE file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    f_reader->file = file;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        return false;
+    }
+    // Empty files can not be mapped
+    if (size.QuadPart == 0) {
+        return true;
+    }
+    f_reader->mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (f_reader->mapping == nullptr) {
+        return false;
+    }
+    f_reader->data = (const char *) MapViewOfFile(f_reader->mapping, FILE_MAP_READ, 0, 0, 0);
+    if (f_reader->data == nullptr) {
+        return false;
+    }
+    f_reader->size = (size_t) size.QuadPart;
+    return true;
 }
 
-void plasma::reader::string_reader_new(string_reader *s_reader, std::string string) {
-    s_reader->content = std::move(string);
-    s_reader->currentIndex = 0;
+#else
+
+plasma::reader::file_reader::~file_reader() {
+    if (this->data != nullptr) {
+        munmap((void *) this->data, this->size);
+    }
+    if (this->file != -1) {
+        close(this->file);
+    }
 }
 
-bool plasma::reader::string_reader_new_from_file(string_reader *s_reader, const std::string &filePath) {
-    std::ifstream file;
-    file.open(filePath);
-    s_reader->content = std::string(
-            (std::istreambuf_iterator<char>(file)),
-            std::istreambuf_iterator<char>()
-    );
-    s_reader->currentIndex = 0;
+bool plasma::reader::file_reader_new(file_reader *f_reader, const std::string &filePath) {
+    int file = open(filePath.c_str(), O_RDONLY);
+    if (file == -1) {
+        return false;
+    }
+    f_reader->file = file;
+    struct stat information{};
+    if (fstat(file, &information) == -1 || !S_ISREG(information.st_mode)) {
+        return false;
+    }
+    // Empty files can not be mapped
+    if (information.st_size == 0) {
+        return true;
+    }
+    void *data = mmap(nullptr, (size_t) information.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    // The lexer reads the source once from start to end
+    madvise(data, (size_t) information.st_size, MADV_SEQUENTIAL);
+    f_reader->data = (const char *) data;
+    f_reader->size = (size_t) information.st_size;
     return true;
-}
\ No newline at end of file
+}
+
+#endif
@@ -1,56 +1,61 @@
 #include "vm/virtual_machine.h"
 
+namespace plasma::vm {
+    static value *
+    runtime_error_init(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *message = arguments[0];
+        if (message->typeId != String) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    message->get_type(c, vm),
+                    std::vector<std::string>{StringName}
+            );
+        }
+        self->string = message->string;
+        (*success) = true;
+        return vm->get_none(c);
+    }
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::runtime_error_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, struct value *object) -> value * {
-        object->set_on_demand_symbol(
-                Initialize,
-                [this, c, object, isBuiltIn]() -> value * {
-                    return this->new_function(
-                            c, isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *message = arguments[0];
-                                        if (message->typeId != String) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    message->get_type(c, this),
-                                                    std::vector<std::string>{StringName}
-                                            );
-                                        }
-                                        self->string = message->string;
-                                        (*success) = true;
-                                        return this->get_none(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, c, object, isBuiltIn]() -> value * {
-                    return this->new_function(
-                            c, isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+    // Empty when the error was made outside of any instruction with a position
+    static std::string error_position(const value *error) {
+        if (error->errorLine < 0) {
+            return "";
+        }
+        return " at " + std::to_string(error->errorLine) + ":" + std::to_string(error->errorColumn);
+    }
 
-                                        (*success) = true;
-                                        return this->new_string(
-                                                c, false,
-                                                self->get_type(c, this)->name + ": " + self->string
-                                        );
-                                    }
-                            )
-                    );
-                }
+    static value *
+    runtime_error_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_string(
+                c, false,
+                self->get_type(c, vm)->name + ": " + self->string + error_position(self)
         );
+    }
+}
+
+std::string plasma::vm::error_report(const value *error) {
+    return error->typeName + ": " + error->string.str() + error_position(error);
+}
+
+const plasma::vm::native_registry &plasma::vm::runtime_error_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Initialize, {1, runtime_error_init}},
+            {ToString, {0, runtime_error_to_string}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::runtime_error_initialize(bool isBuiltIn) {
+    return [](context *c, struct value *object) -> value * {
+        object->nativeMethods = &runtime_error_methods();
+        size_t line = 0;
+        size_t column = 0;
+        if (c->source_position(&line, &column)) {
+            object->errorLine = (int) line;
+            object->errorColumn = (int) column;
+        }
         return nullptr;
     };
 }
\ No newline at end of file
@@ -46,7 +46,7 @@ plasma::vm::virtual_machine::invalid_number_of_arguments_error_initialize(bool i
                             c, isBuiltIn, object,
                             new_builtin_callable(
                                     2,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
+                                    [this, c](value *self, arguments_span arguments,
                                               bool *success) -> value * {
                                         if (arguments[0]->typeId != Integer) {
                                             (*success) = false;
@@ -83,7 +83,7 @@ plasma::vm::virtual_machine::object_with_name_not_found_error_initialize(bool is
                             c, isBuiltIn, object,
                             new_builtin_callable(
                                     2,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
+                                    [this, c](value *self, arguments_span arguments,
                                               bool *success) -> value * {
                                         if (arguments[1]->typeId != String) {
                                             (*success) = false;
@@ -128,4 +128,22 @@ plasma::vm::constructor_callback plasma::vm::virtual_machine::object_not_callabl
     return [this, isBuiltIn](context *c, value *object) {
         return nullptr;
     };
-}
\ No newline at end of file
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::memory_error_initialize(bool isBuiltIn) {
+    return [this, isBuiltIn](context *c, value *object) {
+        return nullptr;
+    };
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::recursion_error_initialize(bool isBuiltIn) {
+    return [this, isBuiltIn](context *c, value *object) {
+        return nullptr;
+    };
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::value_error_initialize(bool isBuiltIn) {
+    return [this, isBuiltIn](context *c, value *object) {
+        return nullptr;
+    };
+}
@@ -0,0 +1,163 @@
+#include <cstring>
+
+#include "tools.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define PLASMA_SEARCH_X86
+
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+
+#include <intrin.h>
+
+#define PLASMA_TARGET_AVX2
+#else
+#define PLASMA_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+/*
+ * Substring search shared by the Contains of String and Bytes
+ * Blocks of the haystack are compared against the first and the last byte of the needle at once,
+ * only the positions where both match are verified with memcmp
+ */
+
+typedef size_t (*search_function)(const uint8_t *, size_t, const uint8_t *, size_t);
+
+static size_t search_scalar(const uint8_t *haystack, size_t haystackLength,
+                            const uint8_t *needle, size_t needleLength) {
+    // Tails of the block searches may be shorter than the needle, work with indexes so no pointer leaves the haystack
+    if (needleLength > haystackLength) {
+        return plasma::general_tooling::NotFound;
+    }
+    size_t candidates = haystackLength - needleLength + 1;
+    size_t index = 0;
+    while (index < candidates) {
+        const void *position = std::memchr(haystack + index, needle[0], candidates - index);
+        if (position == nullptr) {
+            return plasma::general_tooling::NotFound;
+        }
+        index = (const uint8_t *) position - haystack;
+        if (std::memcmp(haystack + index + 1, needle + 1, needleLength - 1) == 0) {
+            return index;
+        }
+        index++;
+    }
+    return plasma::general_tooling::NotFound;
+}
+
+#ifdef PLASMA_SEARCH_X86
+
+static inline uint32_t lowest_set(uint32_t mask) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+// SSE2 is part of x86-64, so this one is always available
+// Needles reaching the block searches have at least two bytes, the first and last are already checked
+static size_t search_sse2(const uint8_t *haystack, size_t haystackLength,
+                          const uint8_t *needle, size_t needleLength) {
+    const __m128i first = _mm_set1_epi8((char) needle[0]);
+    const __m128i last = _mm_set1_epi8((char) needle[needleLength - 1]);
+    size_t index = 0;
+    for (; index + needleLength + 15 <= haystackLength; index += 16) {
+        const __m128i blockFirst = _mm_loadu_si128((const __m128i *) (haystack + index));
+        const __m128i blockLast = _mm_loadu_si128((const __m128i *) (haystack + index + needleLength - 1));
+        auto mask = (uint32_t) _mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast))
+        );
+        while (mask != 0) {
+            uint32_t bit = lowest_set(mask);
+            if (std::memcmp(haystack + index + bit + 1, needle + 1, needleLength - 2) == 0) {
+                return index + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    size_t rest = search_scalar(haystack + index, haystackLength - index, needle, needleLength);
+    return rest == plasma::general_tooling::NotFound ? rest : index + rest;
+}
+
+PLASMA_TARGET_AVX2
+static size_t search_avx2(const uint8_t *haystack, size_t haystackLength,
+                          const uint8_t *needle, size_t needleLength) {
+    const __m256i first = _mm256_set1_epi8((char) needle[0]);
+    const __m256i last = _mm256_set1_epi8((char) needle[needleLength - 1]);
+    size_t index = 0;
+    for (; index + needleLength + 31 <= haystackLength; index += 32) {
+        const __m256i blockFirst = _mm256_loadu_si256((const __m256i *) (haystack + index));
+        const __m256i blockLast = _mm256_loadu_si256((const __m256i *) (haystack + index + needleLength - 1));
+        auto mask = (uint32_t) _mm256_movemask_epi8(
+                _mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast))
+        );
+        while (mask != 0) {
+            uint32_t bit = lowest_set(mask);
+            if (std::memcmp(haystack + index + bit + 1, needle + 1, needleLength - 2) == 0) {
+                return index + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+    size_t rest = search_sse2(haystack + index, haystackLength - index, needle, needleLength);
+    return rest == plasma::general_tooling::NotFound ? rest : index + rest;
+}
+
+bool plasma::general_tooling::supports_avx2() {
+#ifdef _MSC_VER
+    int information[4];
+    __cpuid(information, 0);
+    if (information[0] < 7) {
+        return false;
+    }
+    __cpuidex(information, 7, 0);
+    bool avx2 = (information[1] & (1 << 5)) != 0;
+    // The operating system must also save the AVX registers
+    __cpuid(information, 1);
+    bool osxsave = (information[2] & (1 << 27)) != 0;
+    return avx2 && osxsave && (_xgetbv(0) & 6) == 6;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+static search_function select_search() {
+    if (plasma::general_tooling::supports_avx2()) {
+        return search_avx2;
+    }
+    return search_sse2;
+}
+
+#else
+
+bool plasma::general_tooling::supports_avx2() {
+    return false;
+}
+
+static search_function select_search() {
+    return search_scalar;
+}
+
+#endif
+
+size_t plasma::general_tooling::search(const uint8_t *haystack, size_t haystackLength,
+                                       const uint8_t *needle, size_t needleLength) {
+    static const search_function implementation = select_search();
+    if (needleLength == 0) {
+        return 0;
+    }
+    if (needleLength > haystackLength) {
+        return NotFound;
+    }
+    if (needleLength == 1) {
+        const void *position = std::memchr(haystack, needle[0], haystackLength);
+        return position == nullptr ? NotFound : (const uint8_t *) position - haystack;
+    }
+    return implementation(haystack, haystackLength, needle, needleLength);
+}
@@ -0,0 +1,84 @@
+#include <algorithm>
+
+#include "vm/shared_content.h"
+
+plasma::vm::shared_content::shared_content(const std::vector<value *> &elements) {
+    this->length = elements.size();
+    this->objects = std::make_shared<std::vector<value *>>(elements);
+}
+
+plasma::vm::shared_content::shared_content(std::vector<value *> &&elements) {
+    this->length = elements.size();
+    this->objects = std::make_shared<std::vector<value *>>(std::move(elements));
+}
+
+plasma::vm::shared_content::shared_content(content_kind kind, std::vector<int64_t> &&elements) {
+    this->kind_ = kind;
+    this->length = elements.size();
+    this->packedElements = std::make_shared<std::vector<int64_t>>(std::move(elements));
+}
+
+plasma::vm::shared_content plasma::vm::shared_content::slice(size_t start, size_t count) const {
+    shared_content result;
+    result.kind_ = this->kind_;
+    if (count == 0) {
+        return result;
+    }
+    result.objects = this->objects;
+    result.packedElements = this->packedElements;
+    result.offset = this->offset + start;
+    result.length = count;
+    return result;
+}
+
+plasma::vm::shared_content plasma::vm::shared_content::reversed() const {
+    if (this->packed()) {
+        return shared_content(this->kind_, std::vector<int64_t>(
+                std::make_reverse_iterator(this->packed_data() + this->length),
+                std::make_reverse_iterator(this->packed_data())
+        ));
+    }
+    return shared_content(std::vector<value *>(
+            std::make_reverse_iterator(this->end()),
+            std::make_reverse_iterator(this->begin())
+    ));
+}
+
+void plasma::vm::shared_content::set(size_t index, value *element) {
+    if (this->objects.use_count() > 1) {
+        this->objects = std::make_shared<std::vector<value *>>(this->begin(), this->end());
+        this->offset = 0;
+    }
+    (*this->objects)[this->offset + index] = element;
+}
+
+void plasma::vm::shared_content::set_packed(size_t index, int64_t element) {
+    if (this->packedElements.use_count() > 1) {
+        this->packedElements = std::make_shared<std::vector<int64_t>>(this->packed_data(),
+                                                                      this->packed_data() + this->length);
+        this->offset = 0;
+    }
+    (*this->packedElements)[this->offset + index] = element;
+}
+
+size_t plasma::vm::shared_content::memory_usage() const {
+    size_t result = 0;
+    if (this->objects != nullptr) {
+        result += this->objects->capacity() * sizeof(value *);
+    }
+    if (this->packedElements != nullptr) {
+        result += this->packedElements->capacity() * sizeof(int64_t);
+    }
+    return result;
+}
+
+size_t plasma::vm::shared_content::shared_memory_usage() const {
+    size_t result = 0;
+    if (this->objects != nullptr) {
+        result += this->objects->capacity() * sizeof(value *) / this->objects.use_count();
+    }
+    if (this->packedElements != nullptr) {
+        result += this->packedElements->capacity() * sizeof(int64_t) / this->packedElements.use_count();
+    }
+    return result;
+}
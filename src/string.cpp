@@ -1,494 +1,277 @@
 #include "vm/virtual_machine.h"
 #include "tools.h"
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::string_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                Add,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != String) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    right->get_type(c, this),
-                                                    std::vector<std::string>{StringName}
-                                            );
-                                        }
-                                        std::string result;
-                                        result.reserve(self->string.size() + right->string.size());
-                                        result.insert(result.end(), self->string.begin(), self->string.end());
-                                        result.insert(result.end(), right->string.begin(), right->string.end());
+namespace plasma::vm {
+    static value *string_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != String) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    right->get_type(c, vm),
+                    std::vector<std::string>{StringName}
+            );
+        }
+        (*success) = true;
+        return vm->new_string(c, false, immutable_string::concatenate(self->string, right->string));
+    }
+
+    static value *
+    string_right_add(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != String) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    left->get_type(c, vm),
+                    std::vector<std::string>{StringName}
+            );
+        }
+        (*success) = true;
+        return vm->new_string(c, false, immutable_string::concatenate(left->string, self->string));
+    }
+
+    static value *string_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Integer) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    right->get_type(c, vm),
+                    std::vector<std::string>{IntegerName}
+            );
+        }
+        std::string repeatedContent;
+        value *multiplicationError = plasma::vm::virtual_machine::string_repeat(self,
+                                                                                std::abs(
+                                                                                        right->integer),
+                                                                                &repeatedContent);
+        if (multiplicationError != nullptr) {
+            (*success) = false;
+            return multiplicationError;
+        }
+        if (right->integer < 0) {
+            std::reverse(repeatedContent.begin(), repeatedContent.end());
+        }
+        (*success) = true;
+        return vm->new_string(c, false, std::move(repeatedContent));
+    }
+
+    static value *
+    string_right_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Integer) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    left->get_type(c, vm),
+                    std::vector<std::string>{IntegerName}
+            );
+        }
+        std::string repeatedContent;
+        value *multiplicationError = plasma::vm::virtual_machine::string_repeat(self,
+                                                                                std::abs(
+                                                                                        left->integer),
+                                                                                &repeatedContent);
+        if (multiplicationError != nullptr) {
+            (*success) = false;
+            return multiplicationError;
+        }
+        if (left->integer < 0) {
+            std::reverse(repeatedContent.begin(), repeatedContent.end());
+        }
+        (*success) = true;
+        return vm->new_string(c, false, std::move(repeatedContent));
+    }
+
+    static value *string_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != String) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = plasma::vm::virtual_machine::string_equals(self, right,
+                                                                            &comparison);
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, comparison);
+    }
+
+    static value *
+    string_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != String) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = plasma::vm::virtual_machine::string_equals(left, self,
+                                                                            &comparison);
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, comparison);
+    }
+
+    static value *
+    string_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != String) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = plasma::vm::virtual_machine::string_equals(self, right,
+                                                                            &comparison);
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !comparison);
+    }
+
+    static value *
+    string_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != String) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = plasma::vm::virtual_machine::string_equals(left, self,
+                                                                            &comparison);
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !comparison);
+    }
+
+    static value *
+    string_contains(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *element = arguments[0];
+        bool contains = false;
+        value *containsError = plasma::vm::virtual_machine::string_contains(self,
+                                                                            element,
+                                                                            &contains);
+        if (containsError != nullptr) {
+            (*success) = false;
+            return containsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, contains);
+    }
+
+    static value *string_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        if (self->string.cached_hash() == 0) {
+            self->string.cache_hash(vm->hash_string(self->string));
+        }
+        (*success) = true;
+        return vm->new_integer(c, false, self->string.cached_hash());
+    }
 
-                                        (*success) = true;
-                                        return this->new_string(c, false, result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightAdd,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != String) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    left->get_type(c, this),
-                                                    std::vector<std::string>{StringName}
-                                            );
-                                        }
-                                        std::string result;
-                                        result.reserve(left->string.size() + self->string.size());
-                                        result.insert(result.end(), left->string.begin(), left->string.end());
-                                        result.insert(result.end(), self->string.begin(), self->string.end());
+    static value *string_copy(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_string(c, false, self->string);
+    }
 
-                                        (*success) = true;
-                                        return this->new_string(c, false, result);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Mul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Integer) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    right->get_type(c, this),
-                                                    std::vector<std::string>{IntegerName}
-                                            );
-                                        }
-                                        std::string repeatedContent;
-                                        value *multiplicationError = plasma::vm::virtual_machine::string_repeat(self,
-                                                                                                                std::abs(
-                                                                                                                        right->integer),
-                                                                                                                &repeatedContent);
-                                        if (multiplicationError != nullptr) {
-                                            (*success) = false;
-                                            return multiplicationError;
-                                        }
-                                        if (right->integer < 0) {
-                                            std::reverse(repeatedContent.begin(), repeatedContent.end());
-                                        }
-                                        (*success) = true;
-                                        return this->new_string(c, false, repeatedContent);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightMul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Integer) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    left->get_type(c, this),
-                                                    std::vector<std::string>{IntegerName}
-                                            );
-                                        }
-                                        std::string repeatedContent;
-                                        value *multiplicationError = plasma::vm::virtual_machine::string_repeat(self,
-                                                                                                                std::abs(
-                                                                                                                        left->integer),
-                                                                                                                &repeatedContent);
-                                        if (multiplicationError != nullptr) {
-                                            (*success) = false;
-                                            return multiplicationError;
-                                        }
-                                        if (left->integer < 0) {
-                                            std::reverse(repeatedContent.begin(), repeatedContent.end());
-                                        }
-                                        (*success) = true;
-                                        return this->new_string(c, false, repeatedContent);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != String) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = plasma::vm::virtual_machine::string_equals(self, right,
-                                                                                                            &comparison);
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != String) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = plasma::vm::virtual_machine::string_equals(left, self,
-                                                                                                            &comparison);
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != String) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = plasma::vm::virtual_machine::string_equals(self, right,
-                                                                                                            &comparison);
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != String) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = plasma::vm::virtual_machine::string_equals(left, self,
-                                                                                                            &comparison);
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Contains,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *element = arguments[0];
-                                        bool contains = false;
-                                        value *containsError = plasma::vm::virtual_machine::string_contains(self,
-                                                                                                            element,
-                                                                                                            &contains);
-                                        if (containsError != nullptr) {
-                                            (*success) = false;
-                                            return containsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, contains);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        if (self->hash == 0) {
-                                            self->hash = this->hash_string(self->string);
-                                        }
-                                        (*success) = true;
-                                        return this->new_integer(c, false, self->hash);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Copy,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_string(c, false, self->string);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Index,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->string_index(c, self, arguments[0], success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Iter,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->string_iterator(c, self);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToInteger,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        bool parsingSuccess = false;
-                                        auto result = plasma::general_tooling::parse_integer(self->string,
-                                                                                             &parsingSuccess);
-                                        if (parsingSuccess) {
-                                            (*success) = true;
-                                            return this->new_integer(c, false, result);
-                                        }
-                                        (*success) = false;
-                                        return this->new_integer_parsing_error(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToFloat,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        bool parsingSuccess = false;
-                                        auto result = plasma::general_tooling::parse_float(self->string,
-                                                                                           &parsingSuccess);
-                                        if (parsingSuccess) {
-                                            (*success) = true;
-                                            return this->new_float(c, false, result);
-                                        }
-                                        (*success) = false;
-                                        return this->NewFloatParsingError(c);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+    static value *string_index(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->string_index(c, self, arguments[0], success);
+    }
 
-                                        (*success) = true;
-                                        return this->new_string(c, false, self->string);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_boolean(c, !self->string.empty());
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToArray,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_array(c, false, this->string_to_integer_content(c, self));
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToTuple,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->new_tuple(c, false, this->string_to_integer_content(c, self));
-                                    }
-                            )
-                    );
-                }
-        );
+    static value *string_iter(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->string_iterator(c, self);
+    }
+
+    static value *
+    string_to_integer(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        bool parsingSuccess = false;
+        auto result = plasma::general_tooling::parse_integer(self->string.str(),
+                                                             &parsingSuccess);
+        if (parsingSuccess) {
+            (*success) = true;
+            return vm->new_integer(c, false, result);
+        }
+        (*success) = false;
+        return vm->new_integer_parsing_error(c);
+    }
+
+    static value *
+    string_to_float(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        bool parsingSuccess = false;
+        auto result = plasma::general_tooling::parse_float(self->string.str(),
+                                                           &parsingSuccess);
+        if (parsingSuccess) {
+            (*success) = true;
+            return vm->new_float(c, false, result);
+        }
+        (*success) = false;
+        return vm->NewFloatParsingError(c);
+    }
+
+    static value *
+    string_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_string(c, false, self->string);
+    }
+
+    static value *
+    string_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_boolean(c, !self->string.empty());
+    }
+
+    static value *
+    string_to_array(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_array(c, false, shared_content(IntegerContent,
+                                                      std::vector<int64_t>(self->string.begin(), self->string.end())));
+    }
+
+    static value *
+    string_to_tuple(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_tuple(c, false, vm->string_to_integer_content(c, self));
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::string_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Add, {1, string_add}},
+            {RightAdd, {1, string_right_add}},
+            {Mul, {1, string_mul}},
+            {RightMul, {1, string_right_mul}},
+            {Equals, {1, string_equals}},
+            {RightEquals, {1, string_right_equals}},
+            {NotEquals, {1, string_not_equals}},
+            {RightNotEquals, {1, string_right_not_equals}},
+            {Contains, {1, string_contains}},
+            {Hash, {0, string_hash}},
+            {Copy, {0, string_copy}},
+            {Index, {1, string_index}},
+            {Iter, {0, string_iter}},
+            {ToInteger, {0, string_to_integer}},
+            {ToFloat, {0, string_to_float}},
+            {ToString, {0, string_to_string}},
+            {ToBool, {0, string_to_bool}},
+            {ToArray, {0, string_to_array}},
+            {ToTuple, {0, string_to_tuple}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::string_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &string_methods();
         return nullptr;
     };
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <exception>
+#include <memory>
+
+#include "compiler/thread_pool.h"
+
+plasma::bytecode_compiler::thread_pool::thread_pool(unsigned int threads) {
+    for (unsigned int thread = 0; thread < threads; thread++) {
+        this->threads.emplace_back(&thread_pool::loop, this);
+    }
+}
+
+plasma::bytecode_compiler::thread_pool::~thread_pool() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->available.notify_all();
+    for (std::thread &thread : this->threads) {
+        thread.join();
+    }
+}
+
+void plasma::bytecode_compiler::thread_pool::loop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->available.wait(lock, [this]() { return this->stopping || !this->tasks.empty(); });
+            if (this->tasks.empty()) {
+                return;
+            }
+            task = std::move(this->tasks.front());
+            this->tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void plasma::bytecode_compiler::thread_pool::run(unsigned int helpers, const std::function<void()> &work) {
+    // Shared with the queued tasks, they may start after this call returned
+    struct job {
+        std::mutex mutex;
+        std::condition_variable finished;
+        const std::function<void()> *work;
+        unsigned int running = 0;
+        bool closed = false;
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<job>();
+    state->work = &work;
+    // Even when work throws, no helper may call it once this call returned
+    std::shared_ptr<void> closeJob(nullptr, [&state](...) {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->closed = true;
+        state->finished.wait(lock, [&state]() { return state->running == 0; });
+    });
+    helpers = (unsigned int) std::min<size_t>(helpers, this->threads.size());
+    if (helpers > 0) {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            for (unsigned int helper = 0; helper < helpers; helper++) {
+                this->tasks.emplace_back([state]() {
+                    {
+                        std::lock_guard<std::mutex> lock(state->mutex);
+                        if (state->closed) {
+                            return;
+                        }
+                        state->running++;
+                    }
+                    std::exception_ptr error;
+                    try {
+                        (*state->work)();
+                    } catch (...) {
+                        error = std::current_exception();
+                    }
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    if (error != nullptr && state->error == nullptr) {
+                        state->error = error;
+                    }
+                    state->running--;
+                    state->finished.notify_all();
+                });
+            }
+        }
+        this->available.notify_all();
+    }
+    work();
+    closeJob.reset();
+    // The first exception thrown by a helper is thrown again in the calling thread
+    if (state->error != nullptr) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+plasma::bytecode_compiler::thread_pool &plasma::bytecode_compiler::thread_pool::shared() {
+    static thread_pool pool(std::max(std::thread::hardware_concurrency(), 1u));
+    return pool;
+}
@@ -1,204 +1,212 @@
-#include <string>
 #include <algorithm>
-#include <regex>
+#include <array>
+#include <charconv>
+#include <string>
 
 #include "tools.h"
 
-static std::string directCharEscapeValue(char target) {
-    switch (target) {
-        case 'a':
-            return "\a";
-        case 'b':
-            return "\b";
-        case 'e':
-            return "\\e";
-        case 'f':
-            return "\f";
-        case 'n':
-            return "\n";
-        case 'r':
-            return "\r";
-        case 't':
-            return "\t";
-        case '?':
-            return "\\?";
-        default:
-            return "";
+// Value of every hexadecimal digit, -1 for the other characters
+static constexpr std::array<int8_t, 256> hexadecimalValues = [] {
+    std::array<int8_t, 256> values{};
+    values.fill(-1);
+    for (int digit = 0; digit < 10; digit++) {
+        values['0' + digit] = (int8_t) digit;
+    }
+    for (int digit = 0; digit < 6; digit++) {
+        values['a' + digit] = (int8_t) (10 + digit);
+        values['A' + digit] = (int8_t) (10 + digit);
     }
+    return values;
+}();
+
+// Character written by the escapes of one character, 0 for the characters that are not one of them
+static constexpr std::array<char, 256> escapedValues = [] {
+    std::array<char, 256> values{};
+    values['a'] = '\a';
+    values['b'] = '\b';
+    values['f'] = '\f';
+    values['n'] = '\n';
+    values['r'] = '\r';
+    values['t'] = '\t';
+    for (char character : {'\\', '\'', '"', '`'}) {
+        values[(uint8_t) character] = character;
+    }
+    return values;
+}();
+
+// Value of the digits, reading stops at the first character that is not hexadecimal
+static unsigned int hexadecimal_value(std::string_view digits) {
+    unsigned int value = 0;
+    for (char digit : digits) {
+        int8_t digitValue = hexadecimalValues[(uint8_t) digit];
+        if (digitValue < 0) {
+            break;
+        }
+        value = value * 16 + digitValue;
+    }
+    return value;
 }
 
-std::string UnicodeToUTF8(unsigned int codepoint) {
-    std::string out;
-
-    if (codepoint <= 0x7f)
-        out.append(1, static_cast<char>(codepoint));
-    else if (codepoint <= 0x7ff) {
-        out.append(1, static_cast<char>(0xc0 | ((codepoint >> 6) & 0x1f)));
-        out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
-    } else if (codepoint <= 0xffff) {
-        out.append(1, static_cast<char>(0xe0 | ((codepoint >> 12) & 0x0f)));
-        out.append(1, static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
-        out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
+static void append_utf8(std::string *out, uint16_t codepoint) {
+    if (codepoint <= 0x7f) {
+        out->push_back(static_cast<char>(codepoint));
+    } else if (codepoint <= 0x7ff) {
+        out->push_back(static_cast<char>(0xc0 | ((codepoint >> 6) & 0x1f)));
+        out->push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
     } else {
-        out.append(1, static_cast<char>(0xf0 | ((codepoint >> 18) & 0x07)));
-        out.append(1, static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
-        out.append(1, static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
-        out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
+        out->push_back(static_cast<char>(0xe0 | ((codepoint >> 12) & 0x0f)));
+        out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+        out->push_back(static_cast<char>(0x80 | (codepoint & 0x3f)));
     }
-    return out;
 }
 
-std::string plasma::general_tooling::replace_escaped(const std::string &string) {
-    bool escaped = false;
+std::string plasma::general_tooling::replace_escaped(std::string_view string) {
+    // The quotes and the b of byte strings are not part of the content
+    size_t prefix = string[0] == 'b' ? 2 : 1;
+    if (string.size() <= prefix) {
+        return "";
+    }
+    std::string_view content = string.substr(prefix, string.size() - prefix - 1);
+    size_t escape = content.find('\\');
+    if (escape == std::string_view::npos) {
+        return std::string(content);
+    }
     std::string result;
-    std::string hexOrUnicode;
-    std::stringstream buffer;
-    uint8_t hexChar;
-    uint16_t unicodeChar;
-    bool isBytes = string[0] == 'b';
-    for (size_t index = 0; index < string.length(); index++) {
-        if (index == 0 || index == string.length() - 1) {
-            continue;
-        } else if (index == 1 && isBytes) {
-            continue;
+    // Escapes never decode to more bytes than they are written with
+    result.reserve(content.size());
+    size_t index = 0;
+    while (escape != std::string_view::npos) {
+        result.append(content, index, escape - index);
+        index = escape + 1;
+        if (index == content.size()) {
+            break;
         }
-        uint8_t first, second, third, fourth;
-        char character = string[index];
-        if (escaped) {
-            switch (character) {
-                case 'a':
-                case 'b':
-                case 'e':
-                case 'f':
-                case 'n':
-                case 'r':
-                case 't':
-                case '?':
-                    result += directCharEscapeValue(character);
-                    break;
-                case '\\':
-                case '\'':
-                case '"':
-                case '`':
-                    result.push_back(character);
-                    break;
-                case 'x':
-                case 'X':
-                    hexOrUnicode.clear();
-                    buffer.clear();
-
-                    index++;
-                    hexOrUnicode.push_back(string[index++]);
-                    hexOrUnicode.push_back(string[index]);
-
-                    hexChar = std::strtoul(hexOrUnicode.c_str(), nullptr, 16);
-
-                    result.push_back(hexChar);
-                    break;
-                case 'u':
-                    hexOrUnicode.clear();
-                    buffer.clear();
-
-                    index++;
-                    first = string[index++];
-                    second = string[index++];
-                    third = string[index++];
-                    fourth = string[index];
-
-                    hexOrUnicode.push_back(first);
-                    hexOrUnicode.push_back(second);
-                    hexOrUnicode.push_back(third);
-                    hexOrUnicode.push_back(fourth);
-
-                    unicodeChar = std::strtoul(hexOrUnicode.c_str(), nullptr, 16);
-
-                    result += UnicodeToUTF8(unicodeChar);
-                    break;
-                default:
-                    break;
-            }
-            escaped = false;
-        } else if (character == '\\') {
-            escaped = true;
-        } else {
-            result.push_back(character);
+        char character = content[index++];
+        switch (character) {
+            case 'e':
+            case '?':
+                result.push_back('\\');
+                result.push_back(character);
+                break;
+            case 'x':
+            case 'X':
+                result.push_back((char) hexadecimal_value(content.substr(index, 2)));
+                index += 2;
+                break;
+            case 'u':
+                append_utf8(&result, (uint16_t) hexadecimal_value(content.substr(index, 4)));
+                index += 4;
+                break;
+            default:
+                if (escapedValues[(uint8_t) character] != 0) {
+                    result.push_back(escapedValues[(uint8_t) character]);
+                }
+                break;
         }
+        index = std::min(index, content.size());
+        escape = content.find('\\', index);
     }
+    result.append(content, index);
     return result;
 }
 
-std::string plasma::general_tooling::remove_integer_definition(std::string string) {
-    string.erase(0, 2);
-    return string;
+// Whether the digits are not empty, start with a digit and only have digits or _ after it
+static bool valid_digits(std::string_view digits, bool (*isDigit)(char)) {
+    if (digits.empty() || !isDigit(digits[0])) {
+        return false;
+    }
+    for (char character : digits) {
+        if (character != '_' && !isDigit(character)) {
+            return false;
+        }
+    }
+    return true;
 }
 
-std::string plasma::general_tooling::remove_floor(std::string string) {
-    string.erase(std::remove(string.begin(), string.end(), '_'), string.end());
-    return string;
+// The digits are given to from_chars as they are, they are only copied when they have _ separators
+template<typename T, typename... Format>
+static bool from_digits(std::string_view digits, T *result, Format... format) {
+    std::string withoutSeparators;
+    if (digits.find('_') != std::string_view::npos) {
+        withoutSeparators.reserve(digits.size());
+        for (char character : digits) {
+            if (character != '_') {
+                withoutSeparators.push_back(character);
+            }
+        }
+        digits = withoutSeparators;
+    }
+    auto [end, error] = std::from_chars(digits.data(), digits.data() + digits.size(), *result, format...);
+    return error == std::errc() && end == digits.data() + digits.size();
 }
 
-bool isBase10(const std::string &string) {
-    return std::regex_search(string, std::regex("^[0-9]+[0-9_]*$"));
+static bool is_decimal(char character) {
+    return character >= '0' && character <= '9';
 }
 
-bool isBase16(const std::string &string) {
-    return std::regex_search(string, std::regex("^0[xX][0-9a-fA-F]+[0-9a-fA-F_]*$"));
+static bool is_hexadecimal(char character) {
+    return is_decimal(character) || (character >= 'a' && character <= 'f') || (character >= 'A' && character <= 'F');
 }
 
-bool isBase2(const std::string &string) {
-    return std::regex_search(string, std::regex("^0[bB][01]+[01_]*$"));
+static bool is_binary(char character) {
+    return character == '0' || character == '1';
 }
 
-bool isBase8(const std::string &string) {
-    return std::regex_search(string, std::regex("^0[oO][0-7]+[0-7_]*$"));
+static bool is_octal(char character) {
+    return character >= '0' && character <= '7';
 }
 
-int64_t plasma::general_tooling::parse_integer(const std::string &string, bool *success) {
-    (*success) = true;
-    if (isBase10(string)) {
-        return (int64_t) std::stoll(
-                plasma::general_tooling::remove_floor(string), nullptr,
-                10);
-    } else if (isBase16(string)) {
-        return (int64_t) std::stoll(
-                plasma::general_tooling::remove_integer_definition(
-                        plasma::general_tooling::remove_floor(string)),
-                nullptr,
-                16);
-    } else if (isBase2(string)) {
-        return (int64_t) std::stoll(
-                plasma::general_tooling::remove_integer_definition(
-                        plasma::general_tooling::remove_floor(string)),
-                nullptr,
-                2);
-    } else if (isBase8(string)) {
-        return (int64_t) std::stoll(
-                plasma::general_tooling::remove_integer_definition(
-                        plasma::general_tooling::remove_floor(string)),
-                nullptr,
-                8);
+int64_t plasma::general_tooling::parse_integer(std::string_view string, bool *success) {
+    int base = 10;
+    bool (*isDigit)(char) = is_decimal;
+    if (string.size() > 1 && string[0] == '0') {
+        switch (string[1]) {
+            case 'x':
+            case 'X':
+                base = 16;
+                isDigit = is_hexadecimal;
+                break;
+            case 'b':
+            case 'B':
+                base = 2;
+                isDigit = is_binary;
+                break;
+            case 'o':
+            case 'O':
+                base = 8;
+                isDigit = is_octal;
+                break;
+            default:
+                break;
+        }
+        if (base != 10) {
+            string.remove_prefix(2);
+        }
     }
-    (*success) = false;
-    return 0;
+    int64_t result = 0;
+    (*success) = valid_digits(string, isDigit) && from_digits(string, &result, base);
+    return (*success) ? result : 0;
 }
 
-static bool isFloat(const std::string &string) {
-    if (std::regex_search(string, std::regex("^[0-9]+[0-9_]*\\.[0-9]+[0-9_]*$"))) {
-        return true;
-    } else if (std::regex_search(string, std::regex("^[0-9]+[0-9_]*[eE][-+][0-9]+[0-9_]*$"))) {
-        return true;
-    } else if (std::regex_search(string, std::regex("^[0-9]+[0-9_]*\\.[0-9]+[0-9_]*[eE][-+][0-9]+[0-9_]*$"))) {
-        return true;
+double plasma::general_tooling::parse_float(std::string_view string, bool *success) {
+    (*success) = false;
+    // Integer part, then an optional fraction and an optional exponent with its sign, one of them is required
+    size_t integerEnd = string.find_first_of(".eE");
+    if (integerEnd == std::string_view::npos || !valid_digits(string.substr(0, integerEnd), is_decimal)) {
+        return 0;
     }
-    return false;
-}
-
-double plasma::general_tooling::parse_float(const std::string &string, bool *success) {
-    if (isFloat(string)) {
-        (*success) = true;
-        return std::stod(plasma::general_tooling::remove_floor(string));
+    size_t exponentStart = string.find_first_of("eE", integerEnd);
+    if (string[integerEnd] == '.' &&
+        !valid_digits(string.substr(integerEnd + 1, exponentStart - integerEnd - 1), is_decimal)) {
+        return 0;
     }
-    (*success) = false;
-    return 0;
+    if (exponentStart != std::string_view::npos) {
+        char sign = exponentStart + 1 < string.size() ? string[exponentStart + 1] : '\0';
+        if ((sign != '-' && sign != '+') || !valid_digits(string.substr(exponentStart + 2), is_decimal)) {
+            return 0;
+        }
+    }
+    double result = 0;
+    (*success) = from_digits(string, &result, std::chars_format::general);
+    return (*success) ? result : 0;
 }
-
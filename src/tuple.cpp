@@ -1,445 +1,271 @@
 #include <algorithm>
 #include "vm/virtual_machine.h"
 
+namespace plasma::vm {
+    static value *tuple_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Integer) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    right->get_type(c, vm),
+                    std::vector<std::string>{IntegerName}
+            );
+        }
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content repeatedContent;
+        value *multiplicationError = vm->content_repeat(c, self->content,
+                                                        std::abs(right->integer),
+                                                        &repeatedContent);
+        if (multiplicationError != nullptr) {
+            (*success) = false;
+            return multiplicationError;
+        }
+        if (right->integer < 0) {
+            repeatedContent = repeatedContent.reversed();
+        }
+        (*success) = true;
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::tuple_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                Mul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Integer) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    right->get_type(c, this),
-                                                    std::vector<std::string>{IntegerName}
-                                            );
-                                        }
-                                        std::vector<value *> repeatedContent;
-                                        value *multiplicationError = this->content_repeat(c, self->content,
-                                                                                          std::abs(right->integer),
-                                                                                          &repeatedContent);
-                                        if (multiplicationError != nullptr) {
-                                            (*success) = false;
-                                            return multiplicationError;
-                                        }
-                                        if (right->integer < 0) {
-                                            std::reverse(repeatedContent.begin(), repeatedContent.end());
-                                        }
-                                        (*success) = true;
-
-                                        return this->new_tuple(c, false, repeatedContent);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightMul,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Integer) {
-                                            (*success) = false;
-                                            return this->new_invalid_type_error(
-                                                    c,
-                                                    left->get_type(c, this),
-                                                    std::vector<std::string>{IntegerName}
-                                            );
-                                        }
-                                        std::vector<value *> repeatedContent;
-                                        value *multiplicationError = this->content_repeat(c, self->content,
-                                                                                          std::abs(left->integer),
-                                                                                          &repeatedContent);
-                                        if (multiplicationError != nullptr) {
-                                            (*success) = false;
-                                            return multiplicationError;
-                                        }
-                                        if (left->integer < 0) {
-                                            std::reverse(repeatedContent.begin(), repeatedContent.end());
-                                        }
-                                        (*success) = true;
-                                        return this->new_tuple(c, false, repeatedContent);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Equals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+        return vm->new_tuple(c, false, std::move(repeatedContent));
+    }
 
-                                        value *right = arguments[0];
-                                        if (right->typeId != Tuple) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
+    static value *
+    tuple_right_mul(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Integer) {
+            (*success) = false;
+            return vm->new_invalid_type_error(
+                    c,
+                    left->get_type(c, vm),
+                    std::vector<std::string>{IntegerName}
+            );
+        }
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content repeatedContent;
+        value *multiplicationError = vm->content_repeat(c, self->content,
+                                                        std::abs(left->integer),
+                                                        &repeatedContent);
+        if (multiplicationError != nullptr) {
+            (*success) = false;
+            return multiplicationError;
+        }
+        if (left->integer < 0) {
+            repeatedContent = repeatedContent.reversed();
+        }
+        (*success) = true;
+        return vm->new_tuple(c, false, std::move(repeatedContent));
+    }
 
-                                        bool comparison = false;
-                                        value *comparisonError = this->content_equals(
-                                                c,
-                                                self,
-                                                right,
-                                                &comparison
-                                        );
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
+    static value *tuple_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Tuple) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
 
-                                        return this->get_boolean(c, comparison);
-                                    }
-                            )
-                    );
-                }
+        bool comparison = false;
+        value *comparisonError = vm->content_equals(
+                c,
+                self,
+                right,
+                &comparison
         );
-        object->set_on_demand_symbol(
-                RightEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Tuple) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = this->content_equals(
-                                                c,
-                                                left,
-                                                self,
-                                                &comparison
-                                        );
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                NotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *right = arguments[0];
-                                        if (right->typeId != Tuple) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = this->content_equals(
-                                                c,
-                                                self,
-                                                right,
-                                                &comparison
-                                        );
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                RightNotEquals,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        value *left = arguments[0];
-                                        if (left->typeId != Tuple) {
-                                            (*success) = true;
-                                            return this->get_false(c);
-                                        }
-                                        bool comparison = false;
-                                        value *comparisonError = this->content_equals(
-                                                c,
-                                                left,
-                                                self,
-                                                &comparison
-                                        );
-                                        if (comparisonError != nullptr) {
-                                            (*success) = false;
-                                            return comparisonError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, !comparison);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Contains,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
 
-                                        value *target = arguments[0];
-                                        bool contains = false;
-                                        value *containsError = this->content_contains(
-                                                c,
-                                                self,
-                                                target,
-                                                &contains
-                                        );
-                                        if (containsError != nullptr) {
-                                            (*success) = false;
-                                            return containsError;
-                                        }
-                                        (*success) = true;
-                                        return this->get_boolean(c, contains);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Hash,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        std::vector<int64_t> hashes;
-                                        hashes.reserve(self->content.size());
-                                        for (const auto &element : self->content) {
-                                            int64_t elementHash;
-                                            auto calculationError = calculate_hash(c, element, &elementHash);
-                                            if (calculationError != nullptr) {
-                                                (*success) = false;
-                                                return calculationError;
-                                            }
-                                            hashes.push_back(elementHash);
-                                        }
-                                        (*success) = true;
-                                        return this->new_integer(c, false, hash_array(hashes));
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Copy,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        std::vector<value *> copy;
-                                        value *copyError = this->content_repeat(c, self->content, 1, &copy);
-                                        if (copyError != nullptr) {
-                                            (*success) = false;
-                                            return copyError;
-                                        }
-                                        (*success) = true;
-                                        return this->new_tuple(c, false, copy);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Index,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->content_index(c, arguments[0], self, success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Assign,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    1,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        return this->content_assign(c, self, arguments[0], arguments[1], success);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                Iter,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->content_iterator(c, self);
-                                    }
-                            )
-                    );
-                }
-        );
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+        return vm->get_boolean(c, comparison);
+    }
 
-                                        return this->content_to_string(c, self, success);
-                                    }
-                            )
-                    );
-                }
+    static value *
+    tuple_right_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Tuple) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = vm->content_equals(
+                c,
+                left,
+                self,
+                &comparison
         );
-        object->set_on_demand_symbol(
-                ToBool,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        (*success) = true;
-                                        return this->get_boolean(c, !self->content.empty());
-                                    }
-                            )
-                    );
-                }
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, comparison);
+    }
+
+    static value *
+    tuple_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *right = arguments[0];
+        if (right->typeId != Tuple) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = vm->content_equals(
+                c,
+                self,
+                right,
+                &comparison
         );
-        object->set_on_demand_symbol(
-                ToArray,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        std::vector<value *> copy;
-                                        value *copyError = this->content_repeat(c, self->content, 1, &copy);
-                                        if (copyError != nullptr) {
-                                            (*success) = false;
-                                            return copyError;
-                                        }
-                                        (*success) = true;
-                                        return this->new_array(c, false, copy);
-                                    }
-                            )
-                    );
-                }
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !comparison);
+    }
+
+    static value *
+    tuple_right_not_equals(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *left = arguments[0];
+        if (left->typeId != Tuple) {
+            (*success) = true;
+            return vm->get_false(c);
+        }
+        bool comparison = false;
+        value *comparisonError = vm->content_equals(
+                c,
+                left,
+                self,
+                &comparison
         );
-        object->set_on_demand_symbol(
-                ToTuple,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn,
-                            object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
-                                        std::vector<value *> copy;
-                                        value *copyError = this->content_repeat(c, self->content, 1, &copy);
-                                        if (copyError != nullptr) {
-                                            (*success) = false;
-                                            return copyError;
-                                        }
-                                        (*success) = true;
-                                        return this->new_tuple(c, false, copy);
-                                    }
-                            )
-                    );
-                }
+        if (comparisonError != nullptr) {
+            (*success) = false;
+            return comparisonError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, !comparison);
+    }
+
+    static value *
+    tuple_contains(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        value *target = arguments[0];
+        bool contains = false;
+        value *containsError = vm->content_contains(
+                c,
+                self,
+                target,
+                &contains
         );
+        if (containsError != nullptr) {
+            (*success) = false;
+            return containsError;
+        }
+        (*success) = true;
+        return vm->get_boolean(c, contains);
+    }
+
+    static value *tuple_hash(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        int64_t hash_;
+        value *calculationError = vm->calculate_hash(c, self, &hash_);
+        if (calculationError != nullptr) {
+            (*success) = false;
+            return calculationError;
+        }
+        (*success) = true;
+        return vm->new_integer(c, false, hash_);
+    }
+
+    static value *tuple_copy(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content copy;
+        value *copyError = vm->content_repeat(c, self->content, 1, &copy);
+        if (copyError != nullptr) {
+            (*success) = false;
+            return copyError;
+        }
+        (*success) = true;
+        return vm->new_tuple(c, false, std::move(copy));
+    }
+
+    static value *tuple_index(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->content_index(c, arguments[0], self, success);
+    }
+
+    static value *tuple_assign(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->content_assign(c, self, arguments[0], arguments[1], success);
+    }
+
+    static value *tuple_iter(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->content_iterator(c, self);
+    }
+
+    static value *
+    tuple_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        return vm->content_to_string(c, self, success);
+    }
+
+    static value *tuple_to_bool(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->get_boolean(c, !self->content.empty());
+    }
+
+    static value *
+    tuple_to_array(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content copy;
+        value *copyError = vm->content_repeat(c, self->content, 1, &copy);
+        if (copyError != nullptr) {
+            (*success) = false;
+            return copyError;
+        }
+        (*success) = true;
+        return vm->new_array(c, false, std::move(copy));
+    }
+
+    static value *
+    tuple_to_tuple(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        shared_content copy;
+        value *copyError = vm->content_repeat(c, self->content, 1, &copy);
+        if (copyError != nullptr) {
+            (*success) = false;
+            return copyError;
+        }
+        (*success) = true;
+        return vm->new_tuple(c, false, std::move(copy));
+    }
+}
+
+const plasma::vm::native_registry &plasma::vm::tuple_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {Mul, {1, tuple_mul}},
+            {RightMul, {1, tuple_right_mul}},
+            {Equals, {1, tuple_equals}},
+            {RightEquals, {1, tuple_right_equals}},
+            {NotEquals, {1, tuple_not_equals}},
+            {RightNotEquals, {1, tuple_right_not_equals}},
+            {Contains, {1, tuple_contains}},
+            {Hash, {0, tuple_hash}},
+            {Copy, {0, tuple_copy}},
+            {Index, {1, tuple_index}},
+            {Assign, {1, tuple_assign}},
+            {Iter, {0, tuple_iter}},
+            {ToString, {0, tuple_to_string}},
+            {ToBool, {0, tuple_to_bool}},
+            {ToArray, {0, tuple_to_array}},
+            {ToTuple, {0, tuple_to_tuple}},
+    });
+    return registry;
+}
+
+plasma::vm::constructor_callback plasma::vm::virtual_machine::tuple_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &tuple_methods();
         return nullptr;
     };
 }
@@ -1,26 +1,23 @@
 #include "vm/virtual_machine.h"
 
+namespace plasma::vm {
+    static value *
+    type_to_string(context *c, virtual_machine *vm, value *self, arguments_span arguments, bool *success) {
+        (*success) = true;
+        return vm->new_string(c, false, "Type@" + self->name);
+    }
+}
 
-plasma::vm::constructor_callback plasma::vm::virtual_machine::type_initialize(bool isBuiltIn) {
-    return [this, isBuiltIn](context *c, value *object) -> value * {
-        object->set_on_demand_symbol(
-                ToString,
-                [this, isBuiltIn, c, object]() -> value * {
-                    return this->new_function(
-                            c,
-                            isBuiltIn, object,
-                            new_builtin_callable(
-                                    0,
-                                    [this, c](value *self, const std::vector<value *> &arguments,
-                                              bool *success) -> value * {
+const plasma::vm::native_registry &plasma::vm::type_methods() {
+    static const native_registry registry = inherit_methods(object_methods(), {
+            {ToString, {0, type_to_string}},
+    });
+    return registry;
+}
 
-                                        (*success) = true;
-                                        return this->new_string(c, false, "Type@" + self->name);
-                                    }
-                            )
-                    );
-                }
-        );
+plasma::vm::constructor_callback plasma::vm::virtual_machine::type_initialize(bool isBuiltIn) {
+    return [](context *c, value *object) -> value * {
+        object->nativeMethods = &type_methods();
         return nullptr;
     };
 }
@@ -20,6 +20,17 @@ void plasma::vm::value::set(const std::string &s, value *v) const {
 
 }
 
+static const plasma::vm::native_method *find_native_method(const plasma::vm::value *v, const std::string &symbol) {
+    if (v->nativeMethods == nullptr) {
+        return nullptr;
+    }
+    auto method = v->nativeMethods->find(symbol);
+    if (method == v->nativeMethods->end()) {
+        return nullptr;
+    }
+    return &method->second;
+}
+
 plasma::vm::value *
 plasma::vm::value::get(context *c, virtual_machine *vm, const std::string &symbol, bool *success) {
     value *result = this->symbols->get_self(symbol);
@@ -34,6 +45,15 @@ plasma::vm::value::get(context *c, virtual_machine *vm, const std::string &symbo
             result = onDemandResult->second();
             this->set(symbol, result);
             (*success) = true;
+        } else if (const native_method *method = find_native_method(this, symbol); method != nullptr) {
+            // Materialize the built-in method bound to this object
+            auto state = c->protected_values_state();
+            defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+            c->protect_value(this);
+            result = vm->new_function(c, this->isBuiltIn, this,
+                                      new_native_callable(method->numberOfArguments, method->function));
+            this->set(symbol, result);
+            (*success) = true;
         } else {
 
             (*success) = false;
@@ -57,6 +77,11 @@ std::unordered_map<std::string, uint8_t> plasma::vm::value::dir() {
     for (auto &onDemandSymbol : this->onDemandSymbols) {
         result[onDemandSymbol.first] = 0;
     }
+    if (this->nativeMethods != nullptr) {
+        for (auto &nativeMethod : *this->nativeMethods) {
+            result[nativeMethod.first] = 0;
+        }
+    }
     for (auto &symbol : this->symbols->symbols) {
         result[symbol.first] = 0;
     }
@@ -91,37 +116,16 @@ bool plasma::vm::value::implements(context *c, virtual_machine *vm, value *v) {
 
 plasma::vm::value *plasma::vm::value::add_key_value(context *c, virtual_machine *vm, value *key, value *v) {
     int64_t hash_ = 0;
-    value *hashingError = vm->calculate_hash(c, key, &hash_);
-    if (hashingError != nullptr) {
-        return hashingError;
+    key_value *entry;
+    value *findError = vm->hashtable_find(c, this, key, &hash_, &entry);
+    if (findError != nullptr) {
+        return findError;
     }
-    auto kValues = this->keyValues.find(hash_);
-    if (kValues == this->keyValues.end()) {
-        this->keyValues[hash_] = std::vector(1,
-                                             key_value{
-                                                     .key = key,
-                                                     .value = v,
-                                             }
-        );
+    if (entry != nullptr) {
+        entry->key = key;
+        entry->value = v;
         return nullptr;
     }
-    for (auto &kValueEntry : kValues->second) {
-        bool equals = false;
-        value *equalsError = vm->equals(c, key, kValueEntry.key, &equals);
-        if (equalsError != nullptr) {
-            return equalsError;
-        }
-        if (equals) {
-            kValueEntry.key = key;
-            kValueEntry.value = v;
-            return nullptr;
-        }
-    }
-    kValues->second.push_back(
-            key_value{
-                    .key = key,
-                    .value = v,
-            }
-    );
+    this->keyValues.insert(hash_, key, v);
     return nullptr;
 }
\ No newline at end of file
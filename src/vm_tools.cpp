@@ -1,9 +1,38 @@
 #include <vector>
 #include <algorithm>
+#include <bit>
+#include <charconv>
 
 #include "vm/virtual_machine.h"
+#include "tools.h"
 
 // Content
+
+// Whether the element can be stored in packed content of the kind
+static bool packs_into(plasma::vm::content_kind kind, plasma::vm::value *element) {
+    switch (kind) {
+        case plasma::vm::IntegerContent:
+            return element->typeId == plasma::vm::Integer;
+        case plasma::vm::FloatContent:
+            return element->typeId == plasma::vm::Float;
+        case plasma::vm::BooleanContent:
+            return element->typeId == plasma::vm::Boolean;
+        default:
+            return false;
+    }
+}
+
+static int64_t packed_element(plasma::vm::value *element) {
+    switch (element->typeId) {
+        case plasma::vm::Float:
+            return plasma::vm::shared_content::pack_float(element->floating);
+        case plasma::vm::Boolean:
+            return element->boolean;
+        default:
+            return element->integer;
+    }
+}
+
 plasma::vm::value *
 plasma::vm::virtual_machine::content_index(context *c, value *index, value *source,
                                            bool *success) {
@@ -15,7 +44,7 @@ plasma::vm::virtual_machine::content_index(context *c, value *index, value *sour
             return this->new_index_out_of_range_error(c, source->content.size(), index->integer);
         }
         (*success) = true;
-        return source->content[realIndex];
+        return this->content_element(c, source->content, realIndex);
     } else if (index->typeId == Tuple) {
         if (index->content.size() != 2) {
             (*success) = false;
@@ -52,18 +81,15 @@ plasma::vm::virtual_machine::content_index(context *c, value *index, value *sour
             return this->new_index_out_of_range_error(c, source->content.size(), end->integer);
         }
         (*success) = true;
-        if (startRealIndex > endRealIndex) {
-            if (source->typeId == Array) {
-                return this->new_array(c, false, std::vector<value *>());
-            }
-            return this->new_tuple(c, false, std::vector<value *>());
+        // Slices are views over the source elements, Arrays copy them only when one of both is assigned
+        shared_content slice;
+        if (startRealIndex < endRealIndex) {
+            slice = source->content.slice(startRealIndex, endRealIndex - startRealIndex);
         }
         if (source->typeId == Array) {
-            return this->new_array(c, false, std::vector<value *>(&source->content[startRealIndex],
-                                                                  &source->content[endRealIndex]));
+            return this->new_array(c, false, std::move(slice));
         }
-        return this->new_tuple(c, false, std::vector<value *>(&source->content[startRealIndex],
-                                                              &source->content[endRealIndex]));
+        return this->new_tuple(c, false, std::move(slice));
     }
     (*success) = false;
     return this->new_invalid_type_error(
@@ -89,14 +115,55 @@ plasma::vm::virtual_machine::content_assign(context *c, value *container, value
         return this->new_index_out_of_range_error(c, container->content.size(), index->integer);
     }
 
-    container->content[realIndex] = object;
+    if (!container->content.packed()) {
+        container->content.set(realIndex, object);
+    } else if (packs_into(container->content.kind(), object)) {
+        container->content.set_packed(realIndex, packed_element(object));
+    } else {
+        // Widen to values, the new ones are referenced by the container before the state is restored
+        auto state = c->protected_values_state();
+        defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+        c->protect_value(container);
+        c->protect_value(object);
+        container->content = this->materialize_content(c, container->content);
+        container->content.set(realIndex, object);
+    }
 
     (*success) = true;
     return this->get_none(c);
 }
 
+// Text of the packed elements, the same produced by the ToString of Integer, Float and Bool
+static void append_packed_elements(const plasma::vm::shared_content &content, std::string *result) {
+    char buffer[512];
+    for (size_t index = 0; index < content.size(); index++) {
+        if (index != 0) {
+            result->append(", ");
+        }
+        switch (content.kind()) {
+            case plasma::vm::IntegerContent:
+                result->append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), content.integer(index)).ptr);
+                break;
+            case plasma::vm::FloatContent:
+                result->append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), content.floating(index),
+                                                     std::chars_format::fixed, 20).ptr);
+                break;
+            default:
+                result->append(content.boolean(index) ? plasma::vm::True : plasma::vm::False);
+                break;
+        }
+    }
+}
+
 plasma::vm::value *plasma::vm::virtual_machine::content_to_string(context *c, value *container, bool *success) {
-    std::string result;
+    // The text is built in place and moved into the string object
+    std::string result(1, container->typeId == Array ? '[' : '(');
+    if (container->content.packed()) {
+        append_packed_elements(container->content, &result);
+        result.push_back(']');
+        (*success) = true;
+        return this->new_string(c, false, std::move(result));
+    }
     bool first = true;
     bool found;
     bool callSuccess;
@@ -108,7 +175,7 @@ plasma::vm::value *plasma::vm::virtual_machine::content_to_string(context *c, va
             (*success) = false;
             return objectToString;
         }
-        value *objectAsString = this->call_function(c, objectToString, std::vector<value *>(), &callSuccess);
+        value *objectAsString = this->call_function(c, objectToString, arguments_span(), &callSuccess);
         if (!callSuccess) {
             (*success) = false;
             return objectAsString;
@@ -125,11 +192,9 @@ plasma::vm::value *plasma::vm::virtual_machine::content_to_string(context *c, va
         }
         result += objectAsString->string;
     }
+    result.push_back(container->typeId == Array ? ']' : ')');
     (*success) = true;
-    if (container->typeId == Array) {
-        return this->new_string(c, false, "[" + result + "]");
-    }
-    return this->new_string(c, false, "(" + result + ")");
+    return this->new_string(c, false, std::move(result));
 }
 
 plasma::vm::value *plasma::vm::virtual_machine::content_iterator(context *c, value *source) {
@@ -149,7 +214,7 @@ plasma::vm::value *plasma::vm::virtual_machine::content_iterator(context *c, val
                           new_builtin_callable(
                                   0,
                                   [=](value *self,
-                                      const std::vector<value *> &arguments,
+                                      arguments_span arguments,
                                       bool *success) -> value * {
                                       (*success) = true;
                                       return this->get_boolean(c, self->iterIndex < iterator->source->content.size());
@@ -165,10 +230,11 @@ plasma::vm::value *plasma::vm::virtual_machine::content_iterator(context *c, val
                           new_builtin_callable(
                                   0,
                                   [=](value *self,
-                                      const std::vector<value *> &arguments,
+                                      arguments_span arguments,
                                       bool *success) -> value * {
                                       (*success) = true;
-                                      return iterator->source->content[self->iterIndex++];
+                                      return this->content_element(c, iterator->source->content,
+                                                                   self->iterIndex++);
                                   }
                           )
                   )
@@ -182,10 +248,29 @@ plasma::vm::value *plasma::vm::virtual_machine::content_equals(context *c, value
         (*result) = false;
         return nullptr;
     }
-    for (size_t index = 0; index < leftHandSide->content.size(); index++) {
+    const shared_content &left = leftHandSide->content;
+    const shared_content &right = rightHandSide->content;
+    if (left.packed() && left.kind() == right.kind()) {
+        if (left.kind() == FloatContent) {
+            (*result) = std::equal(left.packed_data(), left.packed_data() + left.size(), right.packed_data(),
+                                   [](int64_t leftElement, int64_t rightElement) {
+                                       return std::bit_cast<double>(leftElement) ==
+                                              std::bit_cast<double>(rightElement);
+                                   });
+        } else {
+            (*result) = std::equal(left.packed_data(), left.packed_data() + left.size(), right.packed_data());
+        }
+        return nullptr;
+    }
+    auto state = c->protected_values_state();
+    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+    for (size_t index = 0; index < left.size(); index++) {
         bool objectsComparison = false;
-        value *comparisonError = this->equals(c, leftHandSide->content[index], rightHandSide->content[index],
-                                              &objectsComparison);
+        value *leftElement = this->content_element(c, left, index);
+        c->protect_value(leftElement);
+        value *rightElement = this->content_element(c, right, index);
+        c->protect_value(rightElement);
+        value *comparisonError = this->equals(c, leftElement, rightElement, &objectsComparison);
         if (comparisonError != nullptr) {
             (*result) = false;
             return comparisonError;
@@ -205,8 +290,27 @@ plasma::vm::virtual_machine::content_contains(context *c, value *container, valu
         (*result) = false;
         return nullptr;
     }
-    for (const auto &contentObject : container->content) {
-
+    const shared_content &content = container->content;
+    if (content.packed() && packs_into(content.kind(), object)) {
+        int64_t element = packed_element(object);
+        if (content.kind() == FloatContent) {
+            (*result) = std::find_if(content.packed_data(), content.packed_data() + content.size(),
+                                     [element](int64_t contentElement) {
+                                         return std::bit_cast<double>(contentElement) ==
+                                                std::bit_cast<double>(element);
+                                     }) != content.packed_data() + content.size();
+        } else {
+            (*result) = std::find(content.packed_data(), content.packed_data() + content.size(), element) !=
+                        content.packed_data() + content.size();
+        }
+        return nullptr;
+    }
+    auto state = c->protected_values_state();
+    defer _(nullptr, [c, state](...) { c->restore_protected_state(state); });
+    c->protect_value(object);
+    for (size_t index = 0; index < content.size(); index++) {
+        value *contentObject = this->content_element(c, content, index);
+        c->protect_value(contentObject);
         value *comparisonError = this->equals(c, object, contentObject, result);
         if (comparisonError != nullptr) {
             (*result) = false;
@@ -222,16 +326,29 @@ plasma::vm::virtual_machine::content_contains(context *c, value *container, valu
 }
 
 plasma::vm::value *
-plasma::vm::virtual_machine::content_repeat(context *c, const std::vector<plasma::vm::value *> &content,
+plasma::vm::virtual_machine::content_repeat(context *c, const shared_content &content,
                                             size_t times,
-                                            std::vector<plasma::vm::value *> *result) {
+                                            shared_content *result) {
     if (times == 0) {
         return nullptr;
     }
+    // Packed elements are numbers, their copies are the same numbers
+    if (content.packed()) {
+        if (times == 1) {
+            (*result) = content;
+            return nullptr;
+        }
+        std::vector<int64_t> repeated;
+        repeated.reserve(content.size() * times);
+        for (size_t time = 0; time < times; time++) {
+            repeated.insert(repeated.end(), content.packed_data(), content.packed_data() + content.size());
+        }
+        (*result) = shared_content(content.kind(), std::move(repeated));
+        return nullptr;
+    }
 
-    result->clear();
-    result->shrink_to_fit();
-    result->reserve(content.size() * times);
+    std::vector<value *> copies;
+    copies.reserve(content.size() * times);
 
     std::vector<value *> copyFunctions;
     copyFunctions.reserve(content.size());
@@ -243,6 +360,7 @@ plasma::vm::virtual_machine::content_repeat(context *c, const std::vector<plasma
         if (!getSuccess) {
             return copyFunction;
         }
+        c->protect_value(copyFunction);
         copyFunctions.push_back(copyFunction);
     }
 
@@ -252,17 +370,75 @@ plasma::vm::virtual_machine::content_repeat(context *c, const std::vector<plasma
         for (size_t index = 0; index < content.size(); index++) {
             copySuccess = false;
             copyFunction = copyFunctions[index];
-            copyFunctionResult = this->call_function(c, copyFunction, std::vector<value *>(), &copySuccess);
+            copyFunctionResult = this->call_function(c, copyFunction, arguments_span(), &copySuccess);
             if (!copySuccess) {
                 return copyFunctionResult;
             }
-            result->push_back(copyFunctionResult);
+            c->protect_value(copyFunctionResult);
+            copies.push_back(copyFunctionResult);
         }
     }
-
+    (*result) = std::move(copies);
     return nullptr;
 }
 
+plasma::vm::value *plasma::vm::virtual_machine::content_element(context *c, const shared_content &content,
+                                                                size_t index) {
+    switch (content.kind()) {
+        case IntegerContent:
+            return this->new_integer(c, false, content.integer(index));
+        case FloatContent:
+            return this->new_float(c, false, content.floating(index));
+        case BooleanContent:
+            return this->get_boolean(c, content.boolean(index));
+        default:
+            return content[index];
+    }
+}
+
+plasma::vm::shared_content
+plasma::vm::virtual_machine::materialize_content(context *c, const shared_content &content) {
+    if (!content.packed()) {
+        return content;
+    }
+    std::vector<value *> elements;
+    elements.reserve(content.size());
+    for (size_t index = 0; index < content.size(); index++) {
+        elements.push_back(this->content_element(c, content, index));
+        c->protect_value(elements.back());
+    }
+    return elements;
+}
+
+plasma::vm::shared_content plasma::vm::virtual_machine::pack_content(const shared_content &content) {
+    if (content.packed() || content.empty() || content.shared()) {
+        return content;
+    }
+    content_kind kind;
+    switch (content[0]->typeId) {
+        case Integer:
+            kind = IntegerContent;
+            break;
+        case Float:
+            kind = FloatContent;
+            break;
+        case Boolean:
+            kind = BooleanContent;
+            break;
+        default:
+            return content;
+    }
+    std::vector<int64_t> elements;
+    elements.reserve(content.size());
+    for (value *element : content) {
+        if (!packs_into(kind, element)) {
+            return content;
+        }
+        elements.push_back(packed_element(element));
+    }
+    return shared_content(kind, std::move(elements));
+}
+
 // Bytes
 
 plasma::vm::value *plasma::vm::virtual_machine::bytes_index(context *c, value *source, value *index, bool *success) {
@@ -312,10 +488,9 @@ plasma::vm::value *plasma::vm::virtual_machine::bytes_index(context *c, value *s
         }
         (*success) = true;
         if (startRealIndex > endRealIndex) {
-            return this->new_bytes(c, false, std::vector<uint8_t>());
+            return this->new_bytes(c, false, immutable_bytes());
         }
-        return this->new_bytes(c, false, std::vector<uint8_t>(&source->bytes[startRealIndex],
-                                                              &source->bytes[endRealIndex]));
+        return this->new_bytes(c, false, source->bytes.slice(startRealIndex, endRealIndex - startRealIndex));
     }
     (*success) = false;
     return this->new_invalid_type_error(
@@ -326,12 +501,7 @@ plasma::vm::value *plasma::vm::virtual_machine::bytes_index(context *c, value *s
 }
 
 plasma::vm::value *plasma::vm::virtual_machine::bytes_to_string(context *c, value *bytesObject) {
-    std::string result;
-    result.reserve(bytesObject->bytes.size());
-    for (const auto &byte : bytesObject->bytes) {
-        result.push_back(byte);
-    }
-    return this->new_string(c, false, result);
+    return this->new_string(c, false, std::string(bytesObject->bytes.begin(), bytesObject->bytes.end()));
 }
 
 std::vector<plasma::vm::value *> plasma::vm::virtual_machine::bytes_to_integer_content(context *c, value *bytes) {
@@ -360,7 +530,7 @@ plasma::vm::value *plasma::vm::virtual_machine::bytes_iterator(context *c, value
                           new_builtin_callable(
                                   0,
                                   [=](value *self,
-                                      const std::vector<value *> &arguments,
+                                      arguments_span arguments,
                                       bool *success) -> value * {
                                       (*success) = true;
                                       return this->get_boolean(c, self->iterIndex < iterator->source->bytes.size());
@@ -376,7 +546,7 @@ plasma::vm::value *plasma::vm::virtual_machine::bytes_iterator(context *c, value
                           new_builtin_callable(
                                   0,
                                   [=](value *self,
-                                      const std::vector<value *> &arguments,
+                                      arguments_span arguments,
                                       bool *success) -> value * {
                                       (*success) = true;
                                       return this->new_integer(c, false,
@@ -399,15 +569,12 @@ plasma::vm::virtual_machine::bytes_contains(context *c, value *bytes, value *sub
     if (subBytes->typeId != Bytes) {
         return this->new_invalid_type_error(c, subBytes->get_type(c, this), std::vector<std::string>{Bytes});
     }
-    if (subBytes->bytes.size() == 1) {
-        (*result) = std::find(bytes->bytes.begin(), bytes->bytes.end(), subBytes->bytes[0]) != bytes->bytes.end();
-        return nullptr;
-    } else if (subBytes->bytes.empty()) {
+    if (subBytes->bytes.empty()) {
         (*result) = false;
         return nullptr;
     }
-    (*result) = std::search(bytes->bytes.begin(), bytes->bytes.end(), subBytes->bytes.begin(), subBytes->bytes.end()) !=
-                bytes->bytes.end();
+    (*result) = general_tooling::search(bytes->bytes.data(), bytes->bytes.size(),
+                                        subBytes->bytes.data(), subBytes->bytes.size()) != general_tooling::NotFound;
     return nullptr;
 }
 
@@ -474,10 +641,9 @@ plasma::vm::virtual_machine::string_index(context *c, value *source, value *inde
         }
         (*success) = true;
         if (startRealIndex > endRealIndex) {
-            return this->new_string(c, false, std::string());
+            return this->new_string(c, false, immutable_string());
         }
-        return this->new_string(c, false, std::string(&source->string[startRealIndex],
-                                                      &source->string[endRealIndex]));
+        return this->new_string(c, false, source->string.substring(startRealIndex, endRealIndex - startRealIndex));
     }
     (*success) = false;
     return this->new_invalid_type_error(
@@ -513,7 +679,7 @@ plasma::vm::value *plasma::vm::virtual_machine::string_iterator(context *c, valu
                           new_builtin_callable(
                                   0,
                                   [=](value *self,
-                                      const std::vector<value *> &arguments,
+                                      arguments_span arguments,
                                       bool *success) -> value * {
                                       (*success) = true;
                                       return this->get_boolean(c, self->iterIndex < iterator->source->string.size());
@@ -529,7 +695,7 @@ plasma::vm::value *plasma::vm::virtual_machine::string_iterator(context *c, valu
                           new_builtin_callable(
                                   0,
                                   [=](value *self,
-                                      const std::vector<value *> &arguments,
+                                      arguments_span arguments,
                                       bool *success) -> value * {
                                       (*success) = true;
                                       return this->new_string(c, false, std::string(1,
@@ -549,7 +715,9 @@ plasma::vm::virtual_machine::string_equals(value *leftHandSide, plasma::vm::valu
 
 plasma::vm::value *
 plasma::vm::virtual_machine::string_contains(value *string, plasma::vm::value *subString, bool *result) {
-    (*result) = string->string.find(subString->string) != std::string::npos;
+    (*result) = general_tooling::search((const uint8_t *) string->string.data(), string->string.size(),
+                                        (const uint8_t *) subString->string.data(), subString->string.size()) !=
+                general_tooling::NotFound;
     return nullptr;
 }
 
@@ -566,73 +734,51 @@ plasma::vm::value *plasma::vm::virtual_machine::string_repeat(value *string, siz
 
 // HashTable
 
+plasma::vm::value *
+plasma::vm::virtual_machine::hashtable_find(context *c, value *source, value *key, int64_t *hash, key_value **entry) {
+    value *hashCalculationError = this->calculate_hash(c, key, hash);
+    if (hashCalculationError != nullptr) {
+        return hashCalculationError;
+    }
+    return source->keyValues.find(
+            *hash,
+            [this, c, key](value *entryKey, bool *result) -> value * {
+                return this->equals(c, entryKey, key, result);
+            },
+            entry
+    );
+}
+
 plasma::vm::value *plasma::vm::virtual_machine::hashtable_index(context *c, value *source, value *key, bool *success) {
     int64_t hashKey;
-    value *hashCalculationError = this->calculate_hash(c, key, &hashKey);
-    if (hashCalculationError != nullptr) {
+    key_value *entry;
+    value *findError = this->hashtable_find(c, source, key, &hashKey, &entry);
+    if (findError != nullptr) {
         (*success) = false;
-        return hashCalculationError;
+        return findError;
     }
-    if (!source->keyValues.contains(hashKey)) {
+    if (entry == nullptr) {
         (*success) = false;
         return this->new_key_not_found_error(c, key);
     }
-    bool comparison;
-    value *comparisonError;
-    for (const auto &entry : source->keyValues[hashKey]) {
-        comparisonError = this->equals(c, entry.key, key, &comparison);
-        if (comparisonError != nullptr) {
-            (*success) = false;
-            return comparisonError;
-        }
-        if (comparison) {
-            (*success) = true;
-            return entry.value;
-        }
-    }
-    (*success) = false;
-    return this->new_key_not_found_error(c, key);
+    (*success) = true;
+    return entry->value;
 }
 
 plasma::vm::value *
 plasma::vm::virtual_machine::hashtable_assign(context *c, value *source, value *key, value *object, bool *success) {
     int64_t hashKey;
-    value *hashCalculationError = this->calculate_hash(c, key, &hashKey);
-    if (hashCalculationError != nullptr) {
+    key_value *entry;
+    value *findError = this->hashtable_find(c, source, key, &hashKey, &entry);
+    if (findError != nullptr) {
         (*success) = false;
-        return hashCalculationError;
+        return findError;
     }
-    if (!source->keyValues.contains(hashKey)) {
-        source->keyValues[hashKey] = std::vector<key_value>{
-                key_value{
-                        .key = key,
-                        .value = object
-                }
-        };
-        (*success) = true;
-        return this->get_none(c);
+    if (entry != nullptr) {
+        entry->value = object;
+    } else {
+        source->keyValues.insert(hashKey, key, object);
     }
-    bool comparison;
-    value *comparisonError;
-    for (size_t index = 0; index < source->keyValues[hashKey].size(); index++) {
-
-        comparisonError = this->equals(c, source->keyValues[hashKey][index].key, key, &comparison);
-        if (comparisonError != nullptr) {
-            (*success) = false;
-            return comparisonError;
-        }
-        if (comparison) {
-            source->keyValues[hashKey][index].value = object;
-            (*success) = true;
-            return this->get_none(c);
-        }
-    }
-    source->keyValues[hashKey].push_back(
-            key_value{
-                    .key = key,
-                    .value = object
-            }
-    );
     (*success) = true;
     return this->get_none(c);
 }
@@ -650,10 +796,7 @@ plasma::vm::value *plasma::vm::virtual_machine::hashtable_iterator(context *c, v
     result->source = hashtable;
     result->iterIndex = 0;
 
-    /*
-     * Nasty code here, find a way to just iterate over the existing map and not iterate over a new vector
-     */
-    auto content = plasma::vm::virtual_machine::hashtable_to_content(hashtable); // Fixme
+    // Entries are only appended, so the position stays valid while the table grows
     result->set(
             HasNext,
             this->new_function(
@@ -662,10 +805,10 @@ plasma::vm::value *plasma::vm::virtual_machine::hashtable_iterator(context *c, v
                     result,
                     new_builtin_callable(
                             0,
-                            [this, c, content](value *self, const std::vector<value *> &arguments,
-                                               bool *success) -> value * {
+                            [this, c](value *self, arguments_span arguments,
+                                      bool *success) -> value * {
                                 (*success) = true;
-                                return this->get_boolean(c, self->iterIndex < content.size());
+                                return this->get_boolean(c, self->iterIndex < self->source->keyValues.size());
                             }
                     )
             )
@@ -678,10 +821,10 @@ plasma::vm::value *plasma::vm::virtual_machine::hashtable_iterator(context *c, v
                     result,
                     new_builtin_callable(
                             0,
-                            [this, c, content](value *self, const std::vector<value *> &arguments,
-                                               bool *success) -> value * {
+                            [](value *self, arguments_span arguments,
+                               bool *success) -> value * {
                                 (*success) = true;
-                                return content[self->iterIndex++];
+                                return (self->source->keyValues.begin() + (self->iterIndex++))->key;
                             }
                     )
             )
@@ -690,60 +833,58 @@ plasma::vm::value *plasma::vm::virtual_machine::hashtable_iterator(context *c, v
 }
 
 plasma::vm::value *plasma::vm::virtual_machine::hashtable_to_string(context *c, value *hashtableObject, bool *success) {
-
-    std::string result;
+    std::string result = "{";
     bool first = true;
     value *objectToString;
     value *objectAsString;
-    for (const auto &entry : hashtableObject->keyValues) {
-        for (const auto &keyValue : entry.second) {
-            if (first) {
-                first = false;
-            } else {
-                result += ", ";
-            }
-            objectToString = keyValue.key->get(c, this, ToString, success);
-            if (!(*success)) {
-                return objectToString;
-            }
-            objectAsString = this->call_function(c, objectToString, std::vector<value *>(), success);
-            if (!(*success)) {
-                return objectAsString;
-            }
-            if (objectAsString->typeId != String) {
-                (*success) = false;
-                return this->new_invalid_type_error(c, objectAsString->get_type(c, this),
-                                                    std::vector<std::string>{StringName}
-                );
-            }
-            result += objectAsString->string + ": ";
-            objectToString = keyValue.value->get(c, this, ToString, success);
-            if (!(*success)) {
-                return objectToString;
-            }
-            objectAsString = this->call_function(c, objectToString, std::vector<value *>(), success);
-            if (!(*success)) {
-                return objectAsString;
-            }
-            if (objectAsString->typeId != String) {
-                (*success) = false;
-                return this->new_invalid_type_error(c, objectAsString->get_type(c, this),
-                                                    std::vector<std::string>{StringName}
-                );
-            }
-            result += objectAsString->string;
+    for (const auto &keyValue : hashtableObject->keyValues) {
+        if (first) {
+            first = false;
+        } else {
+            result += ", ";
+        }
+        objectToString = keyValue.key->get(c, this, ToString, success);
+        if (!(*success)) {
+            return objectToString;
+        }
+        objectAsString = this->call_function(c, objectToString, arguments_span(), success);
+        if (!(*success)) {
+            return objectAsString;
         }
+        if (objectAsString->typeId != String) {
+            (*success) = false;
+            return this->new_invalid_type_error(c, objectAsString->get_type(c, this),
+                                                std::vector<std::string>{StringName}
+            );
+        }
+        result += objectAsString->string;
+        result += ": ";
+        objectToString = keyValue.value->get(c, this, ToString, success);
+        if (!(*success)) {
+            return objectToString;
+        }
+        objectAsString = this->call_function(c, objectToString, arguments_span(), success);
+        if (!(*success)) {
+            return objectAsString;
+        }
+        if (objectAsString->typeId != String) {
+            (*success) = false;
+            return this->new_invalid_type_error(c, objectAsString->get_type(c, this),
+                                                std::vector<std::string>{StringName}
+            );
+        }
+        result += objectAsString->string;
     }
+    result.push_back('}');
     (*success) = true;
-    return this->new_string(c, false, "{" + result + "}");
+    return this->new_string(c, false, std::move(result));
 }
 
 std::vector<plasma::vm::value *> plasma::vm::virtual_machine::hashtable_to_content(value *source) {
     std::vector<value *> result;
-    for (const auto &entry : source->keyValues) {
-        for (const auto &keyValue : entry.second) {
-            result.push_back(keyValue.key);
-        }
+    result.reserve(source->keyValues.size());
+    for (const auto &keyValue : source->keyValues) {
+        result.push_back(keyValue.key);
     }
     return result;
 }
@@ -754,38 +895,25 @@ plasma::vm::virtual_machine::hashtable_equals(context *c, value *leftHandSide, v
     if (leftHandSide->keyValues.size() != rightHandSide->keyValues.size()) {
         return nullptr;
     }
-    bool indexSuccess;
+    int64_t hashKey;
+    key_value *entry;
     bool valueComparison;
-    value *indexResult;
     value *comparisonError;
-    for (const auto &entry : leftHandSide->keyValues) {
-        for (const key_value &keyValue : entry.second) {
-            indexResult = this->hashtable_index(c, rightHandSide, keyValue.key, &indexSuccess);
-            if (!indexSuccess) {
-                return indexResult;
-            }
-            comparisonError = this->hashtable_equals(c, keyValue.value, indexResult, &valueComparison);
-            if (comparisonError != nullptr) {
-                return comparisonError;
-            }
-            if (!valueComparison) {
-                return nullptr;
-            }
+    // Keys are unique, so with the same size every key of the left must be in the right
+    for (const key_value &keyValue : leftHandSide->keyValues) {
+        comparisonError = this->hashtable_find(c, rightHandSide, keyValue.key, &hashKey, &entry);
+        if (comparisonError != nullptr) {
+            return comparisonError;
         }
-    }
-    for (const auto &entry : rightHandSide->keyValues) {
-        for (const key_value &keyValue : entry.second) {
-            indexResult = this->hashtable_index(c, rightHandSide, keyValue.key, &indexSuccess);
-            if (!indexSuccess) {
-                return indexResult;
-            }
-            comparisonError = this->hashtable_equals(c, keyValue.value, indexResult, &valueComparison);
-            if (comparisonError != nullptr) {
-                return comparisonError;
-            }
-            if (!valueComparison) {
-                return nullptr;
-            }
+        if (entry == nullptr) {
+            return nullptr;
+        }
+        comparisonError = this->equals(c, keyValue.value, entry->value, &valueComparison);
+        if (comparisonError != nullptr) {
+            return comparisonError;
+        }
+        if (!valueComparison) {
+            return nullptr;
         }
     }
     (*result) = true;
@@ -794,25 +922,22 @@ plasma::vm::virtual_machine::hashtable_equals(context *c, value *leftHandSide, v
 
 plasma::vm::value *
 plasma::vm::virtual_machine::hashtable_contains(context *c, value *hashTable, value *key, bool *success) {
-    value *indexedObject = this->hashtable_index(c, hashTable, key, success);
-    if (!(*success)) {
-        return indexedObject;
+    int64_t hashKey;
+    key_value *entry;
+    value *findError = this->hashtable_find(c, hashTable, key, &hashKey, &entry);
+    if (findError != nullptr) {
+        return findError;
     }
+    (*success) = entry != nullptr;
     return nullptr;
-
 }
 
 plasma::vm::value *plasma::vm::virtual_machine::hashtable_copy(context *c, value *hashTable, bool *success) {
     value *result = this->new_hash_table(c, false);
-    value *assignError;
-    for (const auto &entry : hashTable->keyValues) {
-        for (const auto &keyValue : entry.second) {
-            assignError = this->hashtable_assign(c, result, keyValue.key, keyValue.value, success);
-            if (!(*success)) {
-                (*success) = false;
-                return assignError;
-            }
-        }
+    // Keys are already unique, the cached hashes are reused
+    result->keyValues.reserve(hashTable->keyValues.size());
+    for (const auto &keyValue : hashTable->keyValues) {
+        result->keyValues.insert(keyValue.hash, keyValue.key, keyValue.value);
     }
     (*success) = true;
     return result;
@@ -836,10 +961,69 @@ size_t plasma::vm::virtual_machine::calculate_index(int64_t index, size_t length
 }
 
 
+/*
+ * Compare builtin values without going through the Equals protocol
+ * - Returns true when the comparison was resolved
+ * - Returns false when the values should be compared with their methods
+ */
+static bool builtin_equals(plasma::vm::value *leftHandSide, plasma::vm::value *rightHandSide, bool *result) {
+    switch (leftHandSide->typeId) {
+        case plasma::vm::Integer:
+            if (rightHandSide->typeId == plasma::vm::Integer) {
+                (*result) = leftHandSide->integer == rightHandSide->integer;
+                return true;
+            } else if (rightHandSide->typeId == plasma::vm::Float) {
+                (*result) = leftHandSide->integer == rightHandSide->floating;
+                return true;
+            }
+            return false;
+        case plasma::vm::Float:
+            if (rightHandSide->typeId == plasma::vm::Integer) {
+                (*result) = leftHandSide->floating == rightHandSide->integer;
+                return true;
+            } else if (rightHandSide->typeId == plasma::vm::Float) {
+                (*result) = leftHandSide->floating == rightHandSide->floating;
+                return true;
+            }
+            return false;
+        case plasma::vm::String:
+        case plasma::vm::Bytes:
+        case plasma::vm::Boolean:
+        case plasma::vm::NoneType:
+            if (rightHandSide->typeId != leftHandSide->typeId) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    switch (leftHandSide->typeId) {
+        case plasma::vm::String:
+            // Different cached hashes short-circuit the comparison
+            (*result) = leftHandSide->string == rightHandSide->string;
+            return true;
+        case plasma::vm::Bytes:
+            (*result) = leftHandSide->bytes == rightHandSide->bytes;
+            return true;
+        case plasma::vm::Boolean:
+            (*result) = leftHandSide->boolean == rightHandSide->boolean;
+            return true;
+        default: // NoneType
+            (*result) = true;
+            return true;
+    }
+}
+
 plasma::vm::value *
 plasma::vm::virtual_machine::equals(context *c, value *leftHandSide, value *rightHandSide,
                                     bool *result) {
     (*result) = false;
+    if (builtin_equals(leftHandSide, rightHandSide, result)) {
+        return nullptr;
+    }
+    if (leftHandSide->typeId == Tuple && rightHandSide->typeId == Tuple) {
+        return this->content_equals(c, leftHandSide, rightHandSide, result);
+    }
     bool success = false;
     value *resultValue;
     value *equalsFunction = leftHandSide->get(c, this, Equals, &success);
@@ -850,14 +1034,14 @@ plasma::vm::virtual_machine::equals(context *c, value *leftHandSide, value *righ
             return equalsFunction;
         }
         success = false;
-        resultValue = this->call_function(c, equalsFunction, std::vector<value *>{leftHandSide}, &success);
+        resultValue = this->call_function(c, equalsFunction, arguments_span(&leftHandSide, 1), &success);
         if (!success) {
             return resultValue;
         }
         return this->interpret_as_boolean(c, resultValue, result);
     }
     success = false;
-    resultValue = this->call_function(c, equalsFunction, std::vector<value *>{rightHandSide}, &success);
+    resultValue = this->call_function(c, equalsFunction, arguments_span(&rightHandSide, 1), &success);
     if (!success) {
         return resultValue;
     }
@@ -866,13 +1050,55 @@ plasma::vm::virtual_machine::equals(context *c, value *leftHandSide, value *righ
 
 plasma::vm::value *
 plasma::vm::virtual_machine::calculate_hash(plasma::vm::context *c, plasma::vm::value *v, int64_t *hash_) {
+    // Builtin values are hashed directly, the results match their Hash methods
+    switch (v->typeId) {
+        case Integer:
+            (*hash_) = v->integer;
+            return nullptr;
+        case Boolean:
+            (*hash_) = v->boolean ? 1 : 0;
+            return nullptr;
+        case NoneType:
+            (*hash_) = -1;
+            return nullptr;
+        case String:
+            if (v->string.cached_hash() == 0) {
+                v->string.cache_hash(this->hash_string(v->string));
+            }
+            (*hash_) = v->string.cached_hash();
+            return nullptr;
+        case Bytes:
+            if (v->bytes.cached_hash() == 0) {
+                v->bytes.cache_hash(this->hash_bytes(v->bytes.span()));
+            }
+            (*hash_) = v->bytes.cached_hash();
+            return nullptr;
+        case Float:
+            (*hash_) = this->hash_float(v->floating);
+            return nullptr;
+        case Tuple: {
+            auto result = (int64_t) (this->seed ^ v->content.size());
+            for (const auto &element : v->content) {
+                int64_t elementHash;
+                value *calculationError = this->calculate_hash(c, element, &elementHash);
+                if (calculationError != nullptr) {
+                    return calculationError;
+                }
+                result = this->hash_combine(result, elementHash);
+            }
+            (*hash_) = result;
+            return nullptr;
+        }
+        default:
+            break;
+    }
     bool success = false;
     value *hashFunction = v->get(c, this, Hash, &success);
     if (!success) {
         return hashFunction;
     }
     success = false;
-    value *hashValue = this->call_function(c, hashFunction, std::vector<value *>(), &success);
+    value *hashValue = this->call_function(c, hashFunction, arguments_span(), &success);
     if (!success) {
         return hashValue;
     }
@@ -896,7 +1122,7 @@ plasma::vm::virtual_machine::interpret_as_boolean(context *c, plasma::vm::value
         return toBoolFunction;
     }
     success = false;
-    value *toBoolResult = this->call_function(c, toBoolFunction, std::vector<value *>(), &success);
+    value *toBoolResult = this->call_function(c, toBoolFunction, arguments_span(), &success);
     if (!success) {
         return toBoolResult;
     }
@@ -924,7 +1150,7 @@ plasma::vm::value *plasma::vm::virtual_machine::interpret_as_iterator(context *c
         (*success) = false;
         return iterFunc;
     }
-    return this->call_function(c, iterFunc, std::vector<value *>{}, success);
+    return this->call_function(c, iterFunc, arguments_span(), success);
 }
 
 plasma::vm::value *
@@ -950,7 +1176,7 @@ plasma::vm::virtual_machine::unpack_values(context *c, struct value *v, size_t e
     bool callSuccess = false;
     for (size_t argumentIndex = 0; argumentIndex < expect; argumentIndex++) {
         // Check if there are more values to unpack
-        auto doesHaveNextValue = this->call_function(c, hasNext, std::vector<value *>{}, &callSuccess);
+        auto doesHaveNextValue = this->call_function(c, hasNext, arguments_span(), &callSuccess);
         if (!callSuccess) {
             return doesHaveNextValue;
         }
@@ -965,7 +1191,7 @@ plasma::vm::virtual_machine::unpack_values(context *c, struct value *v, size_t e
         }
         // Capture the child value
         callSuccess = false;
-        auto childValue = this->call_function(c, next, std::vector<value *>{}, &callSuccess);
+        auto childValue = this->call_function(c, next, arguments_span(), &callSuccess);
         if (!callSuccess) {
             return childValue;
         }
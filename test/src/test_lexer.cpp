@@ -385,6 +385,54 @@ static void tokenize_scientific_floats(int *number_of_tests, int *success) {
     }
 }
 
+static void tokenize_numeric_values(int *number_of_tests, int *success) {
+    {
+        std::string title = "Numeric values";
+        (*number_of_tests)++;
+
+        std::string testString = "1_000 0x1F 0b101 0o17 100_000.000_001 2.5e+3";
+        plasma::reader::string_reader reader;
+        plasma::reader::string_reader_new(&reader, testString);
+        plasma::lexer::lexer lexer(&reader);
+
+        plasma::error::error error;
+        plasma::lexer::token tokens[6];
+
+        bool tokenizationSuccess = true;
+        for (plasma::lexer::token &token : tokens) {
+            tokenizationSuccess = tokenizationSuccess && lexer.next(&token, &error);
+        }
+        if (tokenizationSuccess && tokens[0].number.integer == 1000 && tokens[1].number.integer == 31 &&
+            tokens[2].number.integer == 5 && tokens[3].number.integer == 15 &&
+            tokens[4].number.floating == 100000.000001 && tokens[5].number.floating == 2500) {
+            (*success)++;
+            SUCCESS(title);
+        } else {
+            FAIL(title);
+        }
+    }
+    {
+        std::string title = "Integer out of range";
+        (*number_of_tests)++;
+
+        std::string testString = "9_223_372_036_854_775_808";
+        plasma::reader::string_reader reader;
+        plasma::reader::string_reader_new(&reader, testString);
+        plasma::lexer::lexer lexer(&reader);
+
+        plasma::error::error error;
+        plasma::lexer::token token;
+
+        bool tokenizationSuccess = lexer.next(&token, &error);
+        if (!tokenizationSuccess && error.type == plasma::error::LexingError) {
+            (*success)++;
+            SUCCESS(title);
+        } else {
+            FAIL(title);
+        }
+    }
+}
+
 static void tokenize_literals(int *number_of_tests, int *success) {
     int tests = 0;
     int n_success = 0;
@@ -396,6 +444,7 @@ static void tokenize_literals(int *number_of_tests, int *success) {
     tokenize_oct_integers(&tests, &n_success);
     tokenize_floats(&tests, &n_success);
     tokenize_scientific_floats(&tests, &n_success);
+    tokenize_numeric_values(&tests, &n_success);
     (*number_of_tests) += tests;
     (*success) += n_success;
     TEST_FINISH("Tokenize Literals", tests, n_success);
@@ -427,7 +476,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Integer) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         {
@@ -436,7 +485,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Add) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         {
@@ -445,7 +494,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Integer) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         tests++;
@@ -474,7 +523,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Integer) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         {
@@ -483,7 +532,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Add) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         {
@@ -492,7 +541,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Integer) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         {
@@ -501,7 +550,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Div) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         {
@@ -510,7 +559,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Integer) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         {
@@ -519,7 +568,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::PowerOf) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         {
@@ -528,7 +577,7 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
                 token.directValue == plasma::lexer::Integer) {
                 local_success++;
             } else {
-                FAIL(token.string);
+                FAIL(std::string(token.string));
             }
         }
         tests++;
@@ -544,8 +593,60 @@ static void tokenize_binary_expressions(int *number_of_tests, int *success) {
     TEST_FINISH("Tokenize Binary Expressions", tests, n_success);
 }
 
+static void tokenize_keywords(int *number_of_tests, int *success) {
+    int tests = 0;
+    int n_success = 0;
+    LOG("Tokenize Keywords");
+    {
+        std::string title = "Keywords and identifiers";
+
+        std::string testString = "while whilex await True None and END end_ x_1 # comment\nb'a'";
+        plasma::reader::string_reader reader;
+        plasma::reader::string_reader_new(&reader, testString);
+        plasma::lexer::lexer lexer(&reader);
+
+        plasma::error::error error;
+        plasma::lexer::token token;
+
+        const plasma::lexer::token expected[] = {
+                {"while",  plasma::lexer::While,      plasma::lexer::Keyboard,       0},
+                {"whilex", plasma::lexer::Unknown,    plasma::lexer::IdentifierKind, 0},
+                {"await",  plasma::lexer::Await,      plasma::lexer::AwaitKeyboard,  0},
+                {"True",   plasma::lexer::True,       plasma::lexer::Boolean,        0},
+                {"None",   plasma::lexer::None,       plasma::lexer::NoneType,       0},
+                {"and",    plasma::lexer::And,        plasma::lexer::Operator,       0},
+                {"END",    plasma::lexer::END,        plasma::lexer::Keyboard,       0},
+                {"end_",   plasma::lexer::Unknown,    plasma::lexer::IdentifierKind, 0},
+                {"x_1",    plasma::lexer::Unknown,    plasma::lexer::IdentifierKind, 0},
+                {"\n",    plasma::lexer::NewLine,    plasma::lexer::Separator,      0},
+                {"b'a'",   plasma::lexer::ByteString, plasma::lexer::Literal,        1},
+        };
+        size_t local_success = 0;
+        for (const plasma::lexer::token &expectedToken : expected) {
+            bool tokenizationSuccess = lexer.next(&token, &error);
+            if (tokenizationSuccess && token.string == expectedToken.string && token.kind == expectedToken.kind &&
+                token.directValue == expectedToken.directValue && token.line == expectedToken.line) {
+                local_success++;
+            } else {
+                FAIL(std::string(token.string));
+            }
+        }
+        tests++;
+        if (local_success == std::size(expected)) {
+            n_success++;
+            SUCCESS(title);
+        } else {
+            FAIL(title);
+        }
+    }
+    (*number_of_tests) += tests;
+    (*success) += n_success;
+    TEST_FINISH("Tokenize Keywords", tests, n_success);
+}
+
 void test_lexer(int *number_of_tests, int *success) {
     tokenize_literals(number_of_tests, success);
+    tokenize_keywords(number_of_tests, success);
     tokenize_binary_expressions(number_of_tests, success);
     TEST_FINISH("LEXER", *number_of_tests, *success);
 }
\ No newline at end of file
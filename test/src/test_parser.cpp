@@ -224,7 +224,7 @@ static std::string reconstruct_unless_one_liner_expression(plasma::ast::UnlessOn
 }
 
 static std::string reconstruct_binary_expression(plasma::ast::BinaryExpression *x) {
-    return reconstruct_node(x->LeftHandSide) + " " + x->Operator.string + " " + reconstruct_node(x->RightHandSide);
+    return reconstruct_node(x->LeftHandSide) + " " + std::string(x->Operator.string) + " " + reconstruct_node(x->RightHandSide);
 }
 
 static std::string reconstruct_method_invocation_expression(plasma::ast::MethodInvocationExpression *x) {
@@ -254,9 +254,9 @@ static std::string reconstruct_selector_expression(plasma::ast::SelectorExpressi
 
 static std::string reconstruct_unary_expression(plasma::ast::UnaryExpression *x) {
     if (x->Operator.directValue == plasma::lexer::Not) {
-        return x->Operator.string + " " + reconstruct_node(x->X);
+        return std::string(x->Operator.string) + " " + reconstruct_node(x->X);
     }
-    return x->Operator.string + reconstruct_node(x->X);
+    return std::string(x->Operator.string) + reconstruct_node(x->X);
 }
 
 static std::string reconstruct_index_expression(plasma::ast::IndexExpression *x) {
@@ -327,7 +327,7 @@ static std::string reconstruct_generator_expression(plasma::ast::GeneratorExpres
  * Reconstruct statements
  */
 static std::string reconstruct_assign_statement(plasma::ast::AssignStatement *s) {
-    return reconstruct_node(s->LeftHandSide) + " " + s->AssignOperator.string + " " +
+    return reconstruct_node(s->LeftHandSide) + " " + std::string(s->AssignOperator.string) + " " +
            reconstruct_node(s->RightHandSide);
 }
 
@@ -605,9 +605,9 @@ static std::string reconstruct_node(plasma::ast::Node *node) {
         case plasma::ast::UnaryID:
             return reconstruct_unary_expression(dynamic_cast<plasma::ast::UnaryExpression *>(node));
         case plasma::ast::BasicLiteralID:
-            return dynamic_cast<plasma::ast::BasicLiteralExpression *>(node)->Token.string;
+            return std::string(dynamic_cast<plasma::ast::BasicLiteralExpression *>(node)->Token.string);
         case plasma::ast::IdentifierID:
-            return dynamic_cast<plasma::ast::Identifier *>(node)->Token.string;
+            return std::string(dynamic_cast<plasma::ast::Identifier *>(node)->Token.string);
         case plasma::ast::ArrayID:
             return reconstruct_array_expression(dynamic_cast<plasma::ast::ArrayExpression *>(node));
         case plasma::ast::TupleID:
@@ -707,6 +707,44 @@ static int check_parser_result(plasma::ast::Program *result, const std::string &
     return 0;
 }
 
+static void test_error_recovery(int *number_of_tests, int *success) {
+    std::string title = "Every syntax error is reported in one parse";
+    (*number_of_tests)++;
+
+    plasma::reader::string_reader test_reader;
+    plasma::reader::string_reader_new(&test_reader,
+                                      "a = 1\n"
+                                      "def (x)\n"
+                                      "    if x\n"
+                                      "        return x\n"
+                                      "    end\n"
+                                      "end\n"
+                                      "while True\n"
+                                      "    b = )\n"
+                                      "    c = 2\n"
+                                      "end\n"
+                                      "class\n"
+                                      "end\n"
+                                      "d = 3\n");
+    plasma::lexer::lexer test_lexer(&test_reader);
+    plasma::parser::parser test_parser(&test_lexer);
+    plasma::ast::Program *result = test_parser.parse();
+    std::string errors;
+    for (plasma::error::error &syntaxError : test_parser.Errors) {
+        errors += " [" + syntaxError.string() + "]";
+    }
+    // The valid statements around the errors are still parsed
+    std::string expected = "a = 1\nwhile True\n\tc = 2\nend\nd = 3";
+    std::string reconstructed = reconstruct_code(result);
+    if (test_parser.Errors.size() != 3 || test_parser.Errors[0].line != 1 || test_parser.Errors[1].line != 7 ||
+        test_parser.Errors[2].line != 11 || reconstructed != expected) {
+        FAIL(title + ":" + errors + " " + reconstructed);
+        return;
+    }
+    (*success)++;
+    SUCCESS(title);
+}
+
 void test_parser(int *number_of_tests, int *success) {
     std::vector<std::string> parsing_tests = initialize_parser_tests();
     int number_of_parsing_tests = parsing_tests.size();
@@ -720,11 +758,17 @@ void test_parser(int *number_of_tests, int *success) {
         plasma::parser::parser test_parser(&test_lexer);
         // Parse
         plasma::ast::Program *result = test_parser.parse();
+        if (!test_parser.Errors.empty()) {
+            for (plasma::error::error &syntaxError : test_parser.Errors) {
+                FAIL(syntaxError.string() + ": " + test);
+            }
+            continue;
+        }
         number_of_success_parsing_tests += check_parser_result(result, test);
-        delete result;
     }
 
     TEST_FINISH("Parse samples", number_of_parsing_tests, number_of_success_parsing_tests);
     (*number_of_tests) += number_of_parsing_tests;
     (*success) += number_of_success_parsing_tests;
+    test_error_recovery(number_of_tests, success);
 }
\ No newline at end of file
@@ -2,11 +2,17 @@
 #include "compiler/lexer.h"
 #include "compiler/parser.h"
 #include "compiler/bytecode_compiler.h"
+#include "compiler/thread_pool.h"
 #include "test_vm.h"
 #include "print.h"
 
+#include <algorithm>
+#include <any>
+#include <atomic>
 #include <filesystem>
 #include <chrono>
+#include <stdexcept>
+#include <thread>
 
 const size_t initialMemory = 1;
 
@@ -17,8 +23,9 @@ static void test_success_expression(int *number_of_tests, int *success) {
         for (const auto &script : std::filesystem::directory_iterator(expressionDirectory.path())) {
             std::cout << "[?] Testing: " << script.path().string() << std::endl;
             vmTests++;
-            plasma::reader::string_reader scriptReader;
-            if (!plasma::reader::string_reader_new_from_file(&scriptReader, script.path().string())) {
+            plasma::reader::file_reader scriptReader;
+            if (!plasma::reader::file_reader_new(&scriptReader, script.path().string())) {
+                FAIL("could not read " + script.path().string());
                 continue;
             }
             plasma::lexer::lexer scriptLexer(&scriptReader);
@@ -27,7 +34,12 @@ static void test_success_expression(int *number_of_tests, int *success) {
             plasma::error::error compilationError;
             plasma::vm::bytecode sourceCode;
             if (!compiler.compile(&sourceCode, &compilationError)) {
-                FAIL(compilationError.string() + ": " + script.path().string());
+                if (scriptParser.Errors.empty()) {
+                    FAIL(compilationError.string() + ": " + script.path().string());
+                }
+                for (plasma::error::error &syntaxError : scriptParser.Errors) {
+                    FAIL(syntaxError.string() + ": " + script.path().string());
+                }
                 continue;
             }
             std::istringstream stdinFile;
@@ -43,7 +55,7 @@ static void test_success_expression(int *number_of_tests, int *success) {
             auto end = std::chrono::steady_clock::now();
             if (!executionSuccess) {
                 std::cout << stdoutFile.str() << " - ";
-                FAIL(result->typeName + ": " + result->string);
+                FAIL(plasma::vm::error_report(result));
                 continue;
             }
             auto output = stdoutFile.str();
@@ -69,8 +81,9 @@ static void test_success_statements(int *number_of_tests, int *success) {
         for (const auto &script : std::filesystem::directory_iterator(expressionDirectory.path())) {
             std::cout << "[?] Testing: " << script.path().string() << std::endl;
             vmTests++;
-            plasma::reader::string_reader scriptReader;
-            if (!plasma::reader::string_reader_new_from_file(&scriptReader, script.path().string())) {
+            plasma::reader::file_reader scriptReader;
+            if (!plasma::reader::file_reader_new(&scriptReader, script.path().string())) {
+                FAIL("could not read " + script.path().string());
                 continue;
             }
             plasma::lexer::lexer scriptLexer(&scriptReader);
@@ -79,7 +92,12 @@ static void test_success_statements(int *number_of_tests, int *success) {
             plasma::error::error compilationError;
             plasma::vm::bytecode sourceCode;
             if (!compiler.compile(&sourceCode, &compilationError)) {
-                FAIL(compilationError.string() + ": " + script.path().string());
+                if (scriptParser.Errors.empty()) {
+                    FAIL(compilationError.string() + ": " + script.path().string());
+                }
+                for (plasma::error::error &syntaxError : scriptParser.Errors) {
+                    FAIL(syntaxError.string() + ": " + script.path().string());
+                }
                 continue;
             }
             std::istringstream stdinFile;
@@ -95,7 +113,7 @@ static void test_success_statements(int *number_of_tests, int *success) {
             auto end = std::chrono::steady_clock::now();
             if (!executionSuccess) {
                 std::cout << stdoutFile.str() << " - ";
-                FAIL(result->typeName + ": " + result->string);
+                FAIL(plasma::vm::error_report(result));
                 continue;
             }
             auto output = stdoutFile.str();
@@ -114,8 +132,485 @@ static void test_success_statements(int *number_of_tests, int *success) {
     (*success) += vmSuccess;
 }
 
+/*
+ * Compiles source and executes it in a new virtual machine with c
+ * - Returns false when source does not compile, compilationError tells why
+ * - output receives what the script printed
+ */
+static bool run_source(const std::string &source, plasma::vm::context *c, std::string *output,
+                       plasma::vm::value **result, bool *executionSuccess, plasma::error::error *compilationError) {
+    plasma::reader::string_reader scriptReader;
+    plasma::reader::string_reader_new(&scriptReader, source);
+    plasma::lexer::lexer scriptLexer(&scriptReader);
+    plasma::parser::parser scriptParser(&scriptLexer);
+    plasma::bytecode_compiler::compiler compiler(&scriptParser);
+    plasma::vm::bytecode sourceCode;
+    if (!compiler.compile(&sourceCode, compilationError)) {
+        return false;
+    }
+    std::istringstream stdinFile;
+    std::stringstream stdoutFile;
+    std::stringstream stderrFile;
+    plasma::vm::virtual_machine plasmaVM(stdinFile, stdoutFile, stderrFile);
+    plasmaVM.initialize_context(c);
+    (*result) = plasmaVM.execute(c, &sourceCode, executionSuccess);
+    (*output) = stdoutFile.str();
+    return true;
+}
+
+static void test_heap_statistics(int *number_of_tests, int *success) {
+    std::string title = "Heap statistics dump";
+    (*number_of_tests)++;
+
+    plasma::vm::context c(initialMemory);
+    c.set_allocation_sampling(1);
+    std::string output;
+    plasma::vm::value *result = nullptr;
+    bool executionSuccess = false;
+    plasma::error::error compilationError;
+    if (!run_source("a = []\nfor i in range(0, 100, 1)\n    a = a + [i * 2]\nend\n",
+                    &c, &output, &result, &executionSuccess, &compilationError)) {
+        FAIL(title + ": " + compilationError.string());
+        return;
+    }
+    auto dump = c.heap_statistics_json();
+    if (executionSuccess && c.statistics.collections > 0 && !c.statistics.allocationSites.empty() &&
+        dump.find("\"live\": {") != std::string::npos && dump.find("\"Array\"") != std::string::npos) {
+        (*success)++;
+        SUCCESS(title);
+    } else {
+        FAIL(title + ": " + dump);
+    }
+}
+
+static void test_heap_limit(int *number_of_tests, int *success) {
+    std::string title = "Maximum heap size raises MemoryError";
+    (*number_of_tests)++;
+
+    const size_t maximumHeapSize = 4096 * sizeof(plasma::vm::value);
+    plasma::vm::context c(plasma::vm::heap_configuration{
+            .initialPageLength = 64,
+            .collectionThreshold = 64 * sizeof(plasma::vm::value),
+            .maximumHeapSize = maximumHeapSize,
+    });
+    std::string output;
+    plasma::vm::value *result = nullptr;
+    bool executionSuccess = false;
+    plasma::error::error compilationError;
+    if (!run_source("a = []\n"
+                    "caught = False\n"
+                    "try\n"
+                    "    while True\n"
+                    "        a = a + [1]\n"
+                    "    end\n"
+                    "except MemoryError\n"
+                    "    caught = True\n"
+                    "end\n"
+                    "a = None\n"
+                    "println(caught)\n",
+                    &c, &output, &result, &executionSuccess, &compilationError)) {
+        FAIL(title + ": " + compilationError.string());
+        return;
+    }
+    if (!executionSuccess) {
+        FAIL(title + ": " + plasma::vm::error_report(result));
+        return;
+    }
+    if (output != "True\n" || c.heap_size() > maximumHeapSize + c.memory_reserve_size()) {
+        FAIL(title + ": " + output + std::to_string(c.heap_size()) + " bytes");
+        return;
+    }
+    (*success)++;
+    SUCCESS(title);
+}
+
+static void test_heap_limit_payloads(int *number_of_tests, int *success) {
+    std::string title = "Buffers of strings count toward the maximum heap size";
+    (*number_of_tests)++;
+
+    const size_t maximumHeapSize = 4096 * sizeof(plasma::vm::value);
+    plasma::vm::context c(plasma::vm::heap_configuration{
+            .initialPageLength = 64,
+            .maximumHeapSize = maximumHeapSize,
+    });
+    std::string output;
+    plasma::vm::value *result = nullptr;
+    bool executionSuccess = false;
+    plasma::error::error compilationError;
+    if (!run_source("length = 0\n"
+                    "caught = False\n"
+                    "try\n"
+                    "    while True\n"
+                    "        length += 4096\n"
+                    "        text = \"a\" * length\n"
+                    "    end\n"
+                    "except MemoryError\n"
+                    "    caught = True\n"
+                    "end\n"
+                    "text = None\n"
+                    "println(caught)\n",
+                    &c, &output, &result, &executionSuccess, &compilationError)) {
+        FAIL(title + ": " + compilationError.string());
+        return;
+    }
+    if (!executionSuccess) {
+        FAIL(title + ": " + plasma::vm::error_report(result));
+        return;
+    }
+    if (output != "True\n" || c.heap_size() > maximumHeapSize + c.memory_reserve_size()) {
+        FAIL(title + ": " + output + std::to_string(c.heap_size()) + " bytes");
+        return;
+    }
+    (*success)++;
+    SUCCESS(title);
+}
+
+static void test_heap_reserve(int *number_of_tests, int *success) {
+    std::string title = "Catching MemoryError in a loop does not grow the heap past its reserve";
+    (*number_of_tests)++;
+
+    const size_t maximumHeapSize = 4096 * sizeof(plasma::vm::value);
+    plasma::vm::context c(plasma::vm::heap_configuration{
+            .initialPageLength = 64,
+            .collectionThreshold = 64 * sizeof(plasma::vm::value),
+            .maximumHeapSize = maximumHeapSize,
+    });
+    std::string output;
+    plasma::vm::value *result = nullptr;
+    bool executionSuccess = true;
+    plasma::error::error compilationError;
+    // Once the reserve is spent the script stops with a MemoryError the except can not catch
+    if (!run_source("a = []\n"
+                    "while True\n"
+                    "    try\n"
+                    "        while True\n"
+                    "            a = [a]\n"
+                    "        end\n"
+                    "    except MemoryError\n"
+                    "        pass\n"
+                    "    end\n"
+                    "end\n",
+                    &c, &output, &result, &executionSuccess, &compilationError)) {
+        FAIL(title + ": " + compilationError.string());
+        return;
+    }
+    if (executionSuccess || result == nullptr || result != c.fatalMemoryError || !c.frames.empty()) {
+        FAIL(title + ": the script did not stop with the fatal MemoryError");
+        return;
+    }
+    if (c.heap_size() > maximumHeapSize + c.memory_reserve_size()) {
+        FAIL(title + ": " + std::to_string(c.heap_size()) + " bytes");
+        return;
+    }
+    (*success)++;
+    SUCCESS(title);
+}
+
+static void test_error_position(int *number_of_tests, int *success) {
+    std::string title = "Runtime errors know their line and column";
+    (*number_of_tests)++;
+
+    plasma::vm::context c(initialMemory);
+    std::string output;
+    plasma::vm::value *result = nullptr;
+    bool executionSuccess = true;
+    plasma::error::error compilationError;
+    if (!run_source("a = 1\nb = [a,\n     a + \"text\"]\n",
+                    &c, &output, &result, &executionSuccess, &compilationError)) {
+        FAIL(title + ": " + compilationError.string());
+        return;
+    }
+    // Lines and columns start at 0, the error comes from the + of the third line
+    if (executionSuccess || result->errorLine != 2 || result->errorColumn != 7 ||
+        plasma::vm::error_report(result).find(" at 2:7") == std::string::npos) {
+        FAIL(title + ": " + plasma::vm::error_report(result));
+        return;
+    }
+    (*success)++;
+    SUCCESS(title);
+}
+
+static void test_shared_string_concatenation(int *number_of_tests, int *success) {
+    std::string title = "Concatenation does not grow a buffer other strings share";
+    (*number_of_tests)++;
+
+    plasma::vm::immutable_string left(std::string(64, 'a'));
+    plasma::vm::immutable_string shared = left;
+    const char *sharedData = shared.data();
+    size_t sharedMemory = shared.memory_usage();
+    auto result = plasma::vm::immutable_string::concatenate(left, "tail");
+    if (shared.data() != sharedData || shared.memory_usage() != sharedMemory ||
+        shared.view() != std::string(64, 'a') || result.view() != std::string(64, 'a') + "tail") {
+        FAIL(title);
+        return;
+    }
+    (*success)++;
+    SUCCESS(title);
+}
+
+static void test_repeated_string_concatenation(int *number_of_tests, int *success) {
+    std::string title = "Repeated concatenation appends in place while older strings share the buffer";
+    (*number_of_tests)++;
+
+    // previous plays the dead String value that still holds the last text until the collector reuses it
+    plasma::vm::immutable_string report;
+    plasma::vm::immutable_string previous;
+    std::string expected;
+    std::vector<const char *> buffers;
+    const std::string piece = "0123456789abcdefghijklmnopqrstuvwxyz0123456789abcd";
+    for (size_t iteration = 0; iteration < 100000; iteration++) {
+        previous = report;
+        report = plasma::vm::immutable_string::concatenate(report, piece);
+        expected += piece;
+        if (buffers.empty() || buffers.back() != report.data()) {
+            buffers.push_back(report.data());
+        }
+    }
+    // The buffer doubles when it runs out of room, so it only moves a logarithmic number of times
+    if (buffers.size() > 32 || report.view() != expected ||
+        previous.view() != std::string_view(expected).substr(0, expected.size() - piece.size())) {
+        FAIL(title + ": " + std::to_string(buffers.size()) + " buffers");
+        return;
+    }
+    // Two strings ending the same text can not both append in place
+    auto left = plasma::vm::immutable_string::concatenate(previous, "left side");
+    auto right = plasma::vm::immutable_string::concatenate(previous, "right side");
+    if (left.view() != previous.str() + "left side" || right.view() != previous.str() + "right side" ||
+        report.view() != expected) {
+        FAIL(title);
+        return;
+    }
+    (*success)++;
+    SUCCESS(title);
+}
+
+static bool compile_script(const std::string &path, bool streaming, unsigned int workers,
+                           plasma::vm::bytecode *sourceCode, plasma::error::error *compilationError) {
+    plasma::reader::file_reader scriptReader;
+    if (!plasma::reader::file_reader_new(&scriptReader, path)) {
+        (*compilationError) = plasma::error::error("ReadError", "could not read " + path, 0);
+        return false;
+    }
+    plasma::lexer::lexer scriptLexer(&scriptReader);
+    plasma::parser::parser scriptParser(&scriptLexer);
+    plasma::bytecode_compiler::compiler compiler(&scriptParser);
+    compiler.workers = workers;
+    if (streaming) {
+        return compiler.compile_streaming(sourceCode, compilationError);
+    }
+    return compiler.compile(sourceCode, compilationError);
+}
+
+static bool same_instructions(const plasma::vm::instruction_list &expected,
+                              const plasma::vm::instruction_list &received);
+
+// Values of the types the compiler stores in instructions, nested code is compared instruction by instruction
+static bool same_instruction_value(const std::any &expected, const std::any &received) {
+    if (expected.type() != received.type()) {
+        return false;
+    }
+    if (!expected.has_value()) {
+        return true;
+    }
+    if (expected.type() == typeid(uint8_t)) {
+        return std::any_cast<uint8_t>(expected) == std::any_cast<uint8_t>(received);
+    }
+    if (expected.type() == typeid(size_t)) {
+        return std::any_cast<size_t>(expected) == std::any_cast<size_t>(received);
+    }
+    if (expected.type() == typeid(int64_t)) {
+        return std::any_cast<int64_t>(expected) == std::any_cast<int64_t>(received);
+    }
+    if (expected.type() == typeid(double)) {
+        return std::any_cast<double>(expected) == std::any_cast<double>(received);
+    }
+    if (expected.type() == typeid(std::string)) {
+        return std::any_cast<std::string>(expected) == std::any_cast<std::string>(received);
+    }
+    if (expected.type() == typeid(std::vector<std::string>)) {
+        return std::any_cast<std::vector<std::string>>(expected) ==
+               std::any_cast<std::vector<std::string>>(received);
+    }
+    if (expected.type() == typeid(plasma::vm::immutable_string)) {
+        return std::any_cast<plasma::vm::immutable_string>(expected) ==
+               std::any_cast<plasma::vm::immutable_string>(received);
+    }
+    if (expected.type() == typeid(plasma::vm::immutable_bytes)) {
+        auto expectedBytes = std::any_cast<plasma::vm::immutable_bytes>(expected);
+        auto receivedBytes = std::any_cast<plasma::vm::immutable_bytes>(received);
+        return std::equal(expectedBytes.begin(), expectedBytes.end(), receivedBytes.begin(), receivedBytes.end());
+    }
+    if (expected.type() == typeid(plasma::vm::function_information)) {
+        auto expectedInformation = std::any_cast<plasma::vm::function_information>(expected);
+        auto receivedInformation = std::any_cast<plasma::vm::function_information>(received);
+        return expectedInformation.name == receivedInformation.name &&
+               expectedInformation.bodyLength == receivedInformation.bodyLength &&
+               expectedInformation.numberOfArguments == receivedInformation.numberOfArguments;
+    }
+    if (expected.type() == typeid(plasma::vm::class_information)) {
+        auto expectedInformation = std::any_cast<plasma::vm::class_information>(expected);
+        auto receivedInformation = std::any_cast<plasma::vm::class_information>(received);
+        return expectedInformation.name == receivedInformation.name &&
+               expectedInformation.bodyLength == receivedInformation.bodyLength &&
+               expectedInformation.numberOfBases == receivedInformation.numberOfBases;
+    }
+    if (expected.type() == typeid(plasma::vm::generator_information)) {
+        auto expectedInformation = std::any_cast<plasma::vm::generator_information>(expected);
+        auto receivedInformation = std::any_cast<plasma::vm::generator_information>(received);
+        return expectedInformation.numberOfReceivers == receivedInformation.numberOfReceivers &&
+               expectedInformation.operationLength == receivedInformation.operationLength;
+    }
+    if (expected.type() == typeid(plasma::vm::condition_information)) {
+        auto expectedInformation = std::any_cast<plasma::vm::condition_information>(expected);
+        auto receivedInformation = std::any_cast<plasma::vm::condition_information>(received);
+        return same_instructions(expectedInformation.body, receivedInformation.body) &&
+               same_instructions(expectedInformation.elseBody, receivedInformation.elseBody);
+    }
+    if (expected.type() == typeid(plasma::vm::loop_information)) {
+        auto expectedInformation = std::any_cast<plasma::vm::loop_information>(expected);
+        auto receivedInformation = std::any_cast<plasma::vm::loop_information>(received);
+        return same_instructions(expectedInformation.body, receivedInformation.body) &&
+               same_instructions(expectedInformation.condition, receivedInformation.condition) &&
+               expectedInformation.receivers == receivedInformation.receivers;
+    }
+    if (expected.type() == typeid(plasma::vm::try_information)) {
+        auto expectedInformation = std::any_cast<plasma::vm::try_information>(expected);
+        auto receivedInformation = std::any_cast<plasma::vm::try_information>(received);
+        if (expectedInformation.exceptBlocks.size() != receivedInformation.exceptBlocks.size()) {
+            return false;
+        }
+        for (size_t index = 0; index < expectedInformation.exceptBlocks.size(); index++) {
+            const auto &expectedBlock = expectedInformation.exceptBlocks[index];
+            const auto &receivedBlock = receivedInformation.exceptBlocks[index];
+            if (expectedBlock.captureName != receivedBlock.captureName ||
+                !same_instructions(expectedBlock.targets, receivedBlock.targets) ||
+                !same_instructions(expectedBlock.body, receivedBlock.body)) {
+                return false;
+            }
+        }
+        return same_instructions(expectedInformation.body, receivedInformation.body) &&
+               same_instructions(expectedInformation.elseBody, receivedInformation.elseBody) &&
+               same_instructions(expectedInformation.finally, receivedInformation.finally);
+    }
+    // A type this comparison does not know yet
+    return false;
+}
+
+// Same op codes, values and source positions
+static bool same_instructions(const plasma::vm::instruction_list &expected,
+                              const plasma::vm::instruction_list &received) {
+    if (expected.size() != received.size()) {
+        return false;
+    }
+    for (size_t index = 0; index < expected.size(); index++) {
+        if (expected[index].op_code != received[index].op_code ||
+            !same_instruction_value(expected[index].value, received[index].value)) {
+            return false;
+        }
+        size_t expectedLine = 0, expectedColumn = 0, receivedLine = 0, receivedColumn = 0;
+        bool expectedFound = expected.lines.find(index, &expectedLine, &expectedColumn);
+        bool receivedFound = received.lines.find(index, &receivedLine, &receivedColumn);
+        if (expectedFound != receivedFound || expectedLine != receivedLine || expectedColumn != receivedColumn) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_streaming_compile(int *number_of_tests, int *success) {
+    for (const auto &script : std::filesystem::recursive_directory_iterator("tests-samples/success")) {
+        if (!script.is_regular_file()) {
+            continue;
+        }
+        std::string title = "Streaming compile of " + script.path().string();
+        (*number_of_tests)++;
+        plasma::error::error compilationError;
+        plasma::vm::bytecode expected;
+        plasma::vm::bytecode streamed;
+        if (!compile_script(script.path().string(), false, 1, &expected, &compilationError) ||
+            !compile_script(script.path().string(), true, 1, &streamed, &compilationError)) {
+            FAIL(title + ": " + compilationError.string());
+            continue;
+        }
+        if (!same_instructions(expected.instructions, streamed.instructions)) {
+            FAIL(title);
+            continue;
+        }
+        (*success)++;
+        SUCCESS(title);
+    }
+}
+
+static void test_parallel_compile(int *number_of_tests, int *success) {
+    for (const auto &script : std::filesystem::recursive_directory_iterator("tests-samples/success")) {
+        if (!script.is_regular_file()) {
+            continue;
+        }
+        std::string title = "Parallel compile of " + script.path().string();
+        (*number_of_tests)++;
+        plasma::error::error compilationError;
+        plasma::vm::bytecode expected;
+        plasma::vm::bytecode parallel;
+        if (!compile_script(script.path().string(), false, 1, &expected, &compilationError) ||
+            !compile_script(script.path().string(), false, 4, &parallel, &compilationError)) {
+            FAIL(title + ": " + compilationError.string());
+            continue;
+        }
+        if (!same_instructions(expected.instructions, parallel.instructions)) {
+            FAIL(title);
+            continue;
+        }
+        (*success)++;
+        SUCCESS(title);
+    }
+}
+
+static void test_thread_pool_exceptions(int *number_of_tests, int *success) {
+    std::string title = "Thread pool hands exceptions back to the caller once every call returned";
+    (*number_of_tests)++;
+
+    plasma::bytecode_compiler::thread_pool pool(2);
+    std::thread::id caller = std::this_thread::get_id();
+    for (bool callerThrows : {false, true}) {
+        std::atomic<unsigned int> entered = 0;
+        std::atomic<unsigned int> returned = 0;
+        bool caught = false;
+        try {
+            // Every thread waits for the others, so the helpers are running when the exceptions are thrown
+            pool.run(2, [&]() {
+                entered++;
+                while (entered < 3) {
+                    std::this_thread::yield();
+                }
+                returned++;
+                if ((std::this_thread::get_id() == caller) == callerThrows) {
+                    throw std::runtime_error("work failed");
+                }
+            });
+        } catch (const std::runtime_error &) {
+            caught = returned == 3;
+        }
+        if (!caught) {
+            FAIL(title + (callerThrows ? ": exception of the caller" : ": exception of a helper"));
+            return;
+        }
+    }
+    (*success)++;
+    SUCCESS(title);
+}
+
 void test_vm(int *number_of_tests, int *success) {
     test_success_expression(number_of_tests, success);
     test_success_statements(number_of_tests, success);
+    test_heap_statistics(number_of_tests, success);
+    test_heap_limit(number_of_tests, success);
+    test_heap_limit_payloads(number_of_tests, success);
+    test_heap_reserve(number_of_tests, success);
+    test_error_position(number_of_tests, success);
+    test_shared_string_concatenation(number_of_tests, success);
+    test_repeated_string_concatenation(number_of_tests, success);
+    test_streaming_compile(number_of_tests, success);
+    test_parallel_compile(number_of_tests, success);
+    test_thread_pool_exceptions(number_of_tests, success);
 }
 
@@ -0,0 +1,7 @@
+numbers = [0] * 2000000
+numbers.Fill(3)
+total = 0
+for index in range(0, 50, 1)
+    total += numbers.AddEach(index).Sum()
+end
+println(total)
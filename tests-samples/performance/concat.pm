@@ -0,0 +1,5 @@
+report = ""
+for index in range(0, 1000000, 1)
+    report += "a log line of about fifty characters in length..."
+end
+println(report[(0, 5)])
\ No newline at end of file
@@ -0,0 +1,6 @@
+words = {}
+for n in range(0, 100000, 1)
+    words[n.ToString()] = n
+    words[(n, "pair")] = words[n.ToString()]
+end
+println(words["99999"])
\ No newline at end of file
@@ -0,0 +1,6 @@
+numbers = [0] * 1000000
+for index in range(0, 1000000, 1)
+    numbers[index] = index
+end
+println(500000 in numbers)
+println(numbers == numbers.Copy())
@@ -0,0 +1,8 @@
+numbers = [1] * 200000
+total = 0
+for index in range(0, 2000, 1)
+    half = numbers[(index, 100000 + index)]
+    quarter = half[(0, 50000)]
+    total += quarter[index]
+end
+println(total)
@@ -36,4 +36,10 @@ class A
     end
 end
 println(A() == A())
-println((A(), A(), A(), A()) * 2 == (A(), A(), A(), A(), A(), A(), A(), A()))
\ No newline at end of file
+println((A(), A(), A(), A()) * 2 == (A(), A(), A(), A(), A(), A(), A(), A()))
+println("World" in "Hello World")
+println("" in "Hello")
+println(not ("Worlds" in "Hello World"))
+long = "abcdefghijklmnopqrstuvwxyz0123456789" * 4 + "needle" + "abcdefghijklmnopqrstuvwxyz"
+println("needle" in long and "z0" in long and not ("needles" in long) and "xyz" in long)
+println(b"lo W" in b"Hello World" and not (b"low" in b"Hello World"))
@@ -15,4 +15,62 @@ a = [
                    6
 ]
 
-println(a.ToString() == "[1, 2, 3, 4, 5, 6]")
\ No newline at end of file
+println(a.ToString() == "[1, 2, 3, 4, 5, 6]")
+# Arrays of numbers and booleans
+integers = [1, 2, 3] * 2
+println(integers.ToString() == "[1, 2, 3, 1, 2, 3]")
+println([1.5, 2.5].ToString() == "[1.50000000000000000000, 2.50000000000000000000]")
+println([True, False].ToString() == "[True, False]")
+println(integers == [1, 2, 3, 1, 2, 3])
+println(integers == [1.0, 2.0, 3.0, 1.0, 2.0, 3.0])
+println(3 in integers)
+println(3.0 in integers)
+println(integers[(1, 3)] + [4] == [2, 3, 4])
+integers[0] = 7
+println(integers[0] == 7)
+integers[1] = "mixed"
+println(integers.ToString() == "[7, mixed, 3, 1, 2, 3]")
+println(integers.ToTuple() == (7, "mixed", 3, 1, 2, 3))
+println(b"AB".ToArray() == [65, 66])
+total = 0
+for number in [1, 2, 3, 4]
+    total += number
+end
+println(total == 10)
+
+# Bulk operations
+values = [3, 1, 4, 1, 5, 9, 2, 6, 5, 3]
+println(values.Sum() == 39)
+println(values.Min() == 1)
+println(values.Max() == 9)
+println([0.5, 1.5, 2.0].Sum() == 4.0)
+println([1, 2.5].Max() == 2.5)
+println([].Sum() == 0)
+println([1, 2, 3].Dot([4, 5, 6]) == 32)
+println([1, 2, 3].Dot([0.5, 0.5, 0.5]) == 3.0)
+try
+    [1, 2, 3].Dot([1, 2])
+except ValueError as error
+    println("lengths 3 and 2" in error.ToString())
+end
+try
+    [].Min()
+except ValueError as error
+    println("Min of an empty array" in error.ToString())
+end
+# NaN is the result wherever it is, with or without the vector kernels
+nan = 0.0 / 0.0
+println(nan != nan)
+for extreme in ([nan].Max(), [1.0, nan].Min(), [1.0, 2.0, 3.0, nan, 5.0, 6.0, 7.0, 8.0, 9.0].Max(),
+                [1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, nan].Min(), [nan, 1.0, 2.0, 3.0, 4.0].Max())
+    println(extreme != extreme)
+end
+println(values.AddEach(1) == [4, 2, 5, 2, 6, 10, 3, 7, 6, 4])
+println(values.SubEach(values) == [0, 0, 0, 0, 0, 0, 0, 0, 0, 0])
+println([1, 2, 3, 4, 5].MulEach(2.0) == [2.0, 4.0, 6.0, 8.0, 10.0])
+println(values.GreaterThanMask(4) == [False, False, False, False, True, True, False, True, True, False])
+println(values.LessThanMask(2) == [False, True, False, True, False, False, False, False, False, False])
+println([1.5, 2.5, 1.5].EqualsMask(1.5) == [True, False, True])
+filled = [1, 2, 3, 4, 5]
+filled.Fill(7)
+println(filled == [7, 7, 7, 7, 7])
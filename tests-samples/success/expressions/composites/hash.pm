@@ -17,4 +17,37 @@ a = {
     2: 3
 }
 
-println(a[1] == 2 and a[2] == 3)
\ No newline at end of file
+println(a[1] == 2 and a[2] == 3)
+
+# Growth and insertion order
+big = {}
+for index in range(0, 1000, 1)
+    big[(index, "key")] = index * 2
+end
+println(big[(999, "key")] == 1998 and big[(0, "key")] == 0)
+println(big.ToArray()[0] == (0, "key") and big.ToArray()[999] == (999, "key"))
+println(not ((1000, "key") in big))
+println({1: 2} != {1: 3})
+
+# Equals growing the table it is compared in
+class GrowingKey
+    def Initialize(table)
+        self.table = table
+    end
+
+    def Hash()
+        return 7
+    end
+
+    def Equals(other)
+        for index in range(0, 100, 1)
+            self.table[(index, "grown")] = index
+        end
+        return True
+    end
+end
+grown = {}
+first = GrowingKey(grown)
+grown[first] = 1
+grown[GrowingKey(grown)] = 2
+println(grown[first] == 2 and grown[(99, "grown")] == 99 and grown.ToArray()[0] == first)
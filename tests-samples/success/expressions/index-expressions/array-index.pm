@@ -0,0 +1,12 @@
+numbers = [0, 1, 2, 3, 4, 5, 6, 7]
+middle = numbers[(2, 6)]
+println(middle == [2, 3, 4, 5])
+println(middle[(1, 3)] == [3, 4])
+# Assigning to a slice leaves the source untouched and the other way around
+middle[0] = 20
+println(middle == [20, 3, 4, 5])
+println(numbers == [0, 1, 2, 3, 4, 5, 6, 7])
+numbers[3] = 30
+println(middle == [20, 3, 4, 5])
+println(numbers[(2, 5)] == [2, 30, 4])
+println(numbers[(5, 2)] == [])
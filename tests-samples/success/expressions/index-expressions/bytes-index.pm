@@ -1,4 +1,14 @@
 println(b"ABCDE"[(0, 4)])# == b"ABCD")
 println(b"ABCDE"[(0, 4)] == b"ABCD")
 println(b"ABCDE"[0] == 65)
-println(b"ABCDE"[(1, 4)][2] == 68)
\ No newline at end of file
+println(b"ABCDE"[(1, 4)][2] == 68)
+whole = b"0123456789ABCDEF"
+middle = whole[(4, 12)]
+println(middle == b"456789AB")
+println(middle[(2, 6)] == b"6789")
+println(middle[(2, 6)][0] == 54)
+println(middle.Copy() == middle)
+println(middle.Hash() == b"456789AB".Hash())
+table = {middle: 1}
+println(table[b"456789AB"] == 1)
+println(whole == b"0123456789ABCDEF")
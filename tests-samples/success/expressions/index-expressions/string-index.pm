@@ -1,3 +1,8 @@
 println("ABCDE"[(0, 4)] == "ABCD")
 println("ABCDE"[0] == "A")
-println("ABCDE"[(1, 4)][2] == "D")
\ No newline at end of file
+println("ABCDE"[(1, 4)][2] == "D")
+long = "The quick brown fox jumps over the lazy dog"
+middle = long[(4, 39)]
+println(middle == "quick brown fox jumps over the lazy")
+println(middle[(6, 11)] == "brown")
+println({middle: 1}["quick brown fox jumps over the lazy"] == 1)
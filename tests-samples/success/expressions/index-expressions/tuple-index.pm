@@ -1,2 +1,6 @@
 println((1, 2, 3, 4, 5)[4] == 5)
-println((1, 2, 3, 4, 5)[5 - 5] == 1)
\ No newline at end of file
+println((1, 2, 3, 4, 5)[5 - 5] == 1)
+letters = ("a", "b", "c", "d", "e")
+println(letters[(1, 4)] == ("b", "c", "d"))
+println(letters[(1, 4)][(1, 2)] == ("c",))
+println({letters[(0, 2)]: 1}[("a", "b")] == 1)
@@ -13,4 +13,22 @@ println("Hello\x41World" == "HelloAWorld")
 println("\u0041ntonio" == "Antonio")
 println("Hello\\x41World" == "Hello" + "\\" + "x41World")
 println("500\u20ac" == "500€")
-println("500\\u20ac" == "500" + "\\" + "u20ac")
\ No newline at end of file
+println("500\\u20ac" == "500" + "\\" + "u20ac")
+println("\x41" == "A")
+println(b'\x41\x42'[1] == 66)
+println("\"quoted\"" == '"quoted"')
+println("\u00e9t\u00e9" == "été")
+
+# Concatenation reuses the buffer of the left string without changing it
+base = "A string long enough to own a buffer"
+first = base + "-first"
+second = base + "-second"
+println(base == "A string long enough to own a buffer")
+println(first == "A string long enough to own a buffer-first")
+println(second == "A string long enough to own a buffer-second")
+println(first + first == "A string long enough to own a buffer-firstA string long enough to own a buffer-first")
+report = ""
+for index in range(0, 1000, 1)
+    report += "piece"
+end
+println(report[(4990, 4995)] == "piece" and report == "piece" * 1000)
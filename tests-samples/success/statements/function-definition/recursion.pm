@@ -0,0 +1,46 @@
+def count(n)
+    if n == 0
+        return 0
+    end
+    return 1 + count(n - 1)
+end
+
+println(count(5000) == 5000)
+
+def forever(n)
+    return forever(n + 1)
+end
+
+caught = False
+try
+    forever(0)
+except RecursionError
+    caught = True
+end
+println(caught)
+
+def return_from_try()
+    a = 0
+    try
+        return True
+    finally
+        a = 1
+    end
+    return False
+end
+
+println(return_from_try())
+
+def break_from_try()
+    a = 0
+    while True
+        try
+            break
+        finally
+            a += 1
+        end
+    end
+    return a
+end
+
+println(break_from_try() == 1)